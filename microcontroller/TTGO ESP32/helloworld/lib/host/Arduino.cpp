@@ -0,0 +1,832 @@
+#include "Arduino.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <malloc.h>
+#include <mutex>
+#include <new>
+#include <random>
+#include <stdarg.h>
+#include <thread>
+
+#include "Esp.h"
+#include "driver/gpio.h"
+#include "hal/gpio_ll.h"
+#include "host.hpp"
+
+
+/**
+ * The number of pins that can be read, written and interrupted.
+ */
+static const size_t PIN_COUNT = 40;
+
+/**
+ * The runs of a level interrupt in a row after which it is given up on. The
+ * device would be reset by the interrupt watchdog long before.
+ */
+static const unsigned long STORM_INTERRUPTS = 1000;
+
+struct pin_state {
+    int level;
+    void (*handler)(void*);
+    void* arg;
+    int mode;
+    bool running;
+    unsigned long interrupts;
+};
+
+static pin_state pins[PIN_COUNT];
+
+struct gpio_dev_s {
+};
+
+gpio_dev_t GPIO;
+
+static std::atomic<bool> simulated_clock(false);
+static std::atomic<uint64_t> simulated_us(0);
+static const std::chrono::steady_clock::time_point start_time =
+    std::chrono::steady_clock::now();
+
+/**
+ * A task is a thread with a notification count.
+ */
+struct host_task {
+    std::mutex mutex;
+    std::condition_variable notified;
+    uint32_t count;
+    uint32_t stack_size;
+};
+
+static thread_local host_task* current_task = NULL;
+static thread_local unsigned long allocations = 0;
+static thread_local long heap_in_use = 0;
+static thread_local long heap_peak = 0;
+
+HardwareSerial Serial;
+EspClass ESP;
+
+
+/******************************************************************************/
+/* Time                                                                       */
+/******************************************************************************/
+
+
+static uint64_t hostMicros()
+{
+    if (simulated_clock.load())
+    {
+        return simulated_us.load();
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time).count();
+}
+
+
+unsigned long millis()
+{
+    return (unsigned long)(hostMicros() / 1000);
+}
+
+
+unsigned long micros()
+{
+    return (unsigned long)hostMicros();
+}
+
+
+void delay(unsigned long ms)
+{
+    if (simulated_clock.load())
+    {
+        simulated_us += (uint64_t)ms * 1000;
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+
+void delayMicroseconds(unsigned int us)
+{
+    if (simulated_clock.load())
+    {
+        simulated_us += us;
+        return;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+
+void yield()
+{
+    std::this_thread::yield();
+}
+
+
+void hostUseSimulatedClock(uint64_t start_us)
+{
+    simulated_us = start_us;
+    simulated_clock = true;
+}
+
+
+void hostUseRealClock()
+{
+    simulated_clock = false;
+}
+
+
+void hostAdvanceClock(uint64_t us)
+{
+    simulated_us += us;
+}
+
+
+/******************************************************************************/
+/* Pins                                                                       */
+/******************************************************************************/
+
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    // Pulled up inputs read high until something pulls them down
+    if (pin < PIN_COUNT && (mode & PULLUP) != 0)
+    {
+        pins[pin].level = HIGH;
+    }
+}
+
+
+int digitalRead(uint8_t pin)
+{
+    return pin < PIN_COUNT ? pins[pin].level : LOW;
+}
+
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    if (pin < PIN_COUNT)
+    {
+        pins[pin].level = value ? HIGH : LOW;
+    }
+}
+
+
+/**
+ * Returns true if the interrupt of the pin is triggered, by an edge that was
+ * just made or by the level it is at.
+ */
+static bool isTriggered(const pin_state& state, bool edge)
+{
+    bool high = state.level == HIGH;
+    switch (state.mode)
+    {
+        case RISING:
+            return edge && high;
+        case FALLING:
+            return edge && !high;
+        case CHANGE:
+            return edge;
+        case ONLOW:
+            return !high;
+        case ONHIGH:
+            return high;
+        default:
+            return false;
+    }
+}
+
+
+/**
+ * Runs the interrupt of the pin for as long as it is triggered: once for an
+ * edge, and over again while a level interrupt still sees its level. A
+ * handler that changes the interrupt type of its own pin is not run again
+ * from inside itself; the new type is checked once it returns.
+ */
+static void runInterrupt(uint8_t pin, bool edge)
+{
+    pin_state& state = pins[pin];
+    if (state.handler == NULL || state.running)
+    {
+        return;
+    }
+
+    for (unsigned long runs = 0;
+         runs < STORM_INTERRUPTS && isTriggered(state, edge); runs++)
+    {
+        state.running = true;
+        state.handler(state.arg);
+        state.running = false;
+        state.interrupts++;
+        edge = false;
+    }
+}
+
+
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg,
+                        int mode)
+{
+    if (pin < PIN_COUNT)
+    {
+        pins[pin].handler = handler;
+        pins[pin].arg = arg;
+        pins[pin].mode = mode;
+        pins[pin].interrupts = 0;
+    }
+}
+
+
+void detachInterrupt(uint8_t pin)
+{
+    if (pin < PIN_COUNT)
+    {
+        pins[pin].handler = NULL;
+    }
+}
+
+
+esp_err_t gpio_set_intr_type(gpio_num_t pin, gpio_int_type_t type)
+{
+    if (pin < 0 || (size_t)pin >= PIN_COUNT || type >= GPIO_INTR_MAX)
+    {
+        return ESP_FAIL;
+    }
+    pins[pin].mode = type;
+    runInterrupt(pin, false);
+    return ESP_OK;
+}
+
+
+esp_err_t gpio_wakeup_enable(gpio_num_t pin, gpio_int_type_t type)
+{
+    if (type != GPIO_INTR_LOW_LEVEL && type != GPIO_INTR_HIGH_LEVEL)
+    {
+        return ESP_FAIL;
+    }
+    return gpio_set_intr_type(pin, type);
+}
+
+
+esp_err_t gpio_wakeup_disable(gpio_num_t pin)
+{
+    return gpio_set_intr_type(pin, GPIO_INTR_DISABLE);
+}
+
+
+void hostSetPin(uint8_t pin, int level)
+{
+    if (pin >= PIN_COUNT)
+    {
+        return;
+    }
+
+    pin_state& state = pins[pin];
+    int previous = state.level;
+    state.level = level ? HIGH : LOW;
+    if (state.level != previous)
+    {
+        runInterrupt(pin, true);
+    }
+}
+
+
+unsigned long hostGetInterrupts(uint8_t pin)
+{
+    return pin < PIN_COUNT ? pins[pin].interrupts : 0;
+}
+
+
+int hostGetPin(uint8_t pin)
+{
+    return digitalRead(pin);
+}
+
+
+/******************************************************************************/
+/* FreeRTOS                                                                   */
+/******************************************************************************/
+
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name,
+                                   uint32_t stack_size, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* created,
+                                   BaseType_t core)
+{
+    (void)name;
+    (void)priority;
+    (void)core;
+
+    host_task* task = new host_task();
+    task->count = 0;
+    task->stack_size = stack_size;
+    if (created != NULL)
+    {
+        *created = task;
+    }
+    std::thread([function, arg, task]() {
+        current_task = task;
+        function(arg);
+    }).detach();
+    return pdPASS;
+}
+
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    if (current_task == NULL)
+    {
+        static thread_local host_task task;
+        current_task = &task;
+    }
+    return current_task;
+}
+
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+    if (task == NULL)
+    {
+        task = xTaskGetCurrentTaskHandle();
+    }
+    return ((host_task*)task)->stack_size;
+}
+
+
+void vTaskDelay(TickType_t ticks)
+{
+    delay(ticks);
+}
+
+
+BaseType_t xTaskNotifyGive(TaskHandle_t handle)
+{
+    host_task& task = *static_cast<host_task*>(handle);
+    std::lock_guard<std::mutex> lock(task.mutex);
+    task.count++;
+    task.notified.notify_all();
+    return pdPASS;
+}
+
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken)
+{
+    xTaskNotifyGive(task);
+    if (woken != NULL)
+    {
+        *woken = pdFALSE;
+    }
+}
+
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks)
+{
+    host_task& task = *static_cast<host_task*>(xTaskGetCurrentTaskHandle());
+    std::unique_lock<std::mutex> lock(task.mutex);
+    auto given = [&task]() { return task.count > 0; };
+    if (ticks == portMAX_DELAY)
+    {
+        task.notified.wait(lock, given);
+    }
+    else
+    {
+        task.notified.wait_for(lock, std::chrono::milliseconds(ticks), given);
+    }
+
+    uint32_t count = task.count;
+    if (count > 0)
+    {
+        task.count = clear ? 0 : count - 1;
+    }
+    return count;
+}
+
+
+uint32_t esp_random()
+{
+    static thread_local std::mt19937 generator(std::random_device{}());
+    return (uint32_t)generator();
+}
+
+
+/******************************************************************************/
+/* Allocations                                                                */
+/******************************************************************************/
+
+
+unsigned long hostGetAllocations()
+{
+    return allocations;
+}
+
+
+void hostResetHeapPeak()
+{
+    heap_peak = heap_in_use;
+}
+
+
+long hostGetHeapPeak()
+{
+    return heap_peak - heap_in_use;
+}
+
+
+void* operator new(size_t size)
+{
+    allocations++;
+    void* pointer = malloc(size > 0 ? size : 1);
+    if (pointer == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    heap_in_use += malloc_usable_size(pointer);
+    heap_peak = max(heap_peak, heap_in_use);
+    return pointer;
+}
+
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+
+void operator delete(void* pointer) noexcept
+{
+    heap_in_use -= malloc_usable_size(pointer);
+    free(pointer);
+}
+
+
+void operator delete[](void* pointer) noexcept
+{
+    operator delete(pointer);
+}
+
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+
+/******************************************************************************/
+/* String                                                                     */
+/******************************************************************************/
+
+
+String::String(const char* text)
+    : inline_(), heap_(NULL), capacity_(INLINE_CAPACITY), length_(0)
+{
+    if (text != NULL)
+    {
+        assign(text, strlen(text));
+    }
+}
+
+
+String::String(const String& other)
+    : inline_(), heap_(NULL), capacity_(INLINE_CAPACITY), length_(0)
+{
+    assign(other.c_str(), other.length_);
+}
+
+
+String::String(String&& other) noexcept
+    : inline_(), heap_(other.heap_), capacity_(other.capacity_),
+      length_(other.length_)
+{
+    if (heap_ == NULL)
+    {
+        memcpy(inline_, other.inline_, sizeof(inline_));
+    }
+    other.heap_ = NULL;
+    other.capacity_ = INLINE_CAPACITY;
+    other.length_ = 0;
+    other.inline_[0] = '\0';
+}
+
+
+String::String(int value)
+    : String()
+{
+    char text[12];
+    snprintf(text, sizeof(text), "%d", value);
+    assign(text, strlen(text));
+}
+
+
+String::String(unsigned int value)
+    : String()
+{
+    char text[12];
+    snprintf(text, sizeof(text), "%u", value);
+    assign(text, strlen(text));
+}
+
+
+String::String(long value)
+    : String()
+{
+    char text[24];
+    snprintf(text, sizeof(text), "%ld", value);
+    assign(text, strlen(text));
+}
+
+
+String::String(unsigned long value)
+    : String()
+{
+    char text[24];
+    snprintf(text, sizeof(text), "%lu", value);
+    assign(text, strlen(text));
+}
+
+
+String::~String()
+{
+    delete[] heap_;
+}
+
+
+String& String::operator=(const String& other)
+{
+    if (this != &other)
+    {
+        assign(other.c_str(), other.length_);
+    }
+    return *this;
+}
+
+
+String& String::operator=(String&& other) noexcept
+{
+    if (this != &other)
+    {
+        delete[] heap_;
+        heap_ = other.heap_;
+        capacity_ = other.capacity_;
+        length_ = other.length_;
+        if (heap_ == NULL)
+        {
+            memcpy(inline_, other.inline_, sizeof(inline_));
+        }
+        other.heap_ = NULL;
+        other.capacity_ = INLINE_CAPACITY;
+        other.length_ = 0;
+        other.inline_[0] = '\0';
+    }
+    return *this;
+}
+
+
+String& String::operator=(const char* text)
+{
+    if (text == NULL)
+    {
+        text = "";
+    }
+    assign(text, strlen(text));
+    return *this;
+}
+
+
+bool String::reserve(unsigned int length)
+{
+    if (length <= capacity_)
+    {
+        return true;
+    }
+
+    // Like the device core, the buffer is made exactly as large as needed
+    char* heap = new char[length + 1];
+    memcpy(heap, buffer(), length_ + 1);
+    delete[] heap_;
+    heap_ = heap;
+    capacity_ = length;
+    return true;
+}
+
+
+bool String::equals(const String& other) const
+{
+    return length_ == other.length_ && strcmp(c_str(), other.c_str()) == 0;
+}
+
+
+bool String::equals(const char* other) const
+{
+    return strcmp(c_str(), other != NULL ? other : "") == 0;
+}
+
+
+bool String::concat(const String& other)
+{
+    return concat(other.c_str(), other.length_);
+}
+
+
+bool String::concat(const char* other)
+{
+    return other != NULL && concat(other, strlen(other));
+}
+
+
+bool String::concat(const char* other, unsigned int length)
+{
+    if (!reserve(length_ + length))
+    {
+        return false;
+    }
+    memmove(buffer() + length_, other, length);
+    length_ += length;
+    buffer()[length_] = '\0';
+    return true;
+}
+
+
+bool String::concat(char c)
+{
+    return concat(&c, 1);
+}
+
+
+char String::charAt(unsigned int index) const
+{
+    return index < length_ ? c_str()[index] : '\0';
+}
+
+
+void String::assign(const char* text, unsigned int length)
+{
+    if (!reserve(length))
+    {
+        return;
+    }
+    memmove(buffer(), text, length);
+    length_ = length;
+    buffer()[length_] = '\0';
+}
+
+
+/******************************************************************************/
+/* Print and Stream                                                           */
+/******************************************************************************/
+
+
+size_t Print::write(const uint8_t* data, size_t length)
+{
+    size_t written = 0;
+    while (written < length && write(data[written]) == 1)
+    {
+        written++;
+    }
+    return written;
+}
+
+
+size_t Print::write(const char* text)
+{
+    return text != NULL ? write((const uint8_t*)text, strlen(text)) : 0;
+}
+
+
+size_t Print::print(const char* text)
+{
+    return write(text);
+}
+
+
+size_t Print::print(const String& text)
+{
+    return write(text.c_str());
+}
+
+
+size_t Print::print(char c)
+{
+    return write((uint8_t)c);
+}
+
+
+size_t Print::print(int value)
+{
+    return printf("%d", value);
+}
+
+
+size_t Print::print(unsigned int value)
+{
+    return printf("%u", value);
+}
+
+
+size_t Print::print(long value)
+{
+    return printf("%ld", value);
+}
+
+
+size_t Print::print(unsigned long value)
+{
+    return printf("%lu", value);
+}
+
+
+size_t Print::print(long long value)
+{
+    return printf("%lld", value);
+}
+
+
+size_t Print::print(unsigned long long value)
+{
+    return printf("%llu", value);
+}
+
+
+size_t Print::print(double value, int digits)
+{
+    return printf("%.*f", digits, value);
+}
+
+
+size_t Print::println()
+{
+    return write("\r\n");
+}
+
+
+size_t Print::printf(const char* format, ...)
+{
+    char buffer[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0)
+    {
+        return 0;
+    }
+    if ((size_t)length >= sizeof(buffer))
+    {
+        length = sizeof(buffer) - 1;
+    }
+    return write((const uint8_t*)buffer, length);
+}
+
+
+size_t Stream::readBytes(char* buffer, size_t length)
+{
+    size_t count = 0;
+    while (count < length)
+    {
+        int c = timedRead();
+        if (c < 0)
+        {
+            break;
+        }
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+
+int Stream::timedRead()
+{
+    unsigned long start = millis();
+    do
+    {
+        int c = read();
+        if (c >= 0)
+        {
+            return c;
+        }
+        delay(1);
+    } while (millis() - start < timeout_ms_);
+    return -1;
+}
+
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    return fwrite(&c, 1, 1, stdout);
+}
+
+
+size_t HardwareSerial::write(const uint8_t* data, size_t length)
+{
+    return fwrite(data, 1, length, stdout);
+}
+
+
+void HardwareSerial::flush()
+{
+    fflush(stdout);
+}
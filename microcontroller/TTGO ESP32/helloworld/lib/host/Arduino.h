@@ -0,0 +1,283 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <algorithm>
+#include <string>
+
+
+/**
+ * Host implementation of the parts of the Arduino core and FreeRTOS that the
+ * firmware modules use, so that they build and run on Linux in the native
+ * environment. Time comes from the monotonic clock of the host, or from a
+ * simulated clock that tests advance themselves, see host.hpp. Pins are held
+ * in memory and interrupts run on the thread that changes a pin.
+ */
+
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define LOW    0x0
+#define HIGH   0x1
+
+#define INPUT        0x01
+#define OUTPUT       0x03
+#define PULLUP       0x04
+#define INPUT_PULLUP 0x05
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+#define ONLOW   0x04
+#define ONHIGH  0x05
+
+#define IRAM_ATTR
+
+using std::max;
+using std::min;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+#define digitalPinToInterrupt(pin) (pin)
+void attachInterruptArg(uint8_t pin, void (*handler)(void*), void* arg,
+                        int mode);
+void detachInterrupt(uint8_t pin);
+
+/**
+ * Returns random bits, from the hardware generator on the device.
+ */
+uint32_t esp_random();
+
+
+/******************************************************************************/
+/* FreeRTOS                                                                   */
+/******************************************************************************/
+
+
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define pdFAIL  0
+#define pdPASS  1
+#define portMAX_DELAY ((TickType_t)0xffffffff)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+/**
+ * Each task is a host thread, with a notification count of its own. A thread
+ * that was not created as a task becomes one when it first asks for its
+ * handle. Ticks are milliseconds of the clock of the host; the simulated
+ * clock does not time out waits.
+ */
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name,
+                                   uint32_t stack_size, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* created,
+                                   BaseType_t core);
+TaskHandle_t xTaskGetCurrentTaskHandle();
+void vTaskDelay(TickType_t ticks);
+
+/**
+ * The stack of a host thread is not measured, so the whole stack asked for is
+ * reported as never used.
+ */
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+
+#define portYIELD_FROM_ISR() do {} while (0)
+#define portDISABLE_INTERRUPTS() do {} while (0)
+#define portENABLE_INTERRUPTS() do {} while (0)
+
+
+/******************************************************************************/
+/* String                                                                     */
+/******************************************************************************/
+
+
+/**
+ * Text on the heap, which grows as the String of the device core does: up to
+ * 11 characters are held inline, and longer text is moved to a buffer of
+ * exactly its size each time it grows. Allocation counts of code that uses
+ * String are therefore those of the device.
+ */
+class String
+{
+public:
+    String(const char* text = "");
+    String(const String& other);
+    String(String&& other) noexcept;
+    explicit String(int value);
+    explicit String(unsigned int value);
+    explicit String(long value);
+    explicit String(unsigned long value);
+    ~String();
+
+    String& operator=(const String& other);
+    String& operator=(String&& other) noexcept;
+    String& operator=(const char* text);
+
+    const char* c_str() const noexcept { return buffer(); }
+    unsigned int length() const noexcept { return length_; }
+    bool isEmpty() const noexcept { return length_ == 0; }
+
+    /**
+     * Makes room for the length without growing again. Returns false if it
+     * could not be allocated.
+     */
+    bool reserve(unsigned int length);
+
+    bool equals(const String& other) const;
+    bool equals(const char* other) const;
+    bool operator==(const String& other) const { return equals(other); }
+    bool operator==(const char* other) const { return equals(other); }
+    bool operator!=(const String& other) const { return !equals(other); }
+    bool operator!=(const char* other) const { return !equals(other); }
+
+    bool concat(const String& other);
+    bool concat(const char* other);
+    bool concat(const char* other, unsigned int length);
+    bool concat(char c);
+    String& operator+=(const String& other) { concat(other); return *this; }
+    String& operator+=(const char* other) { concat(other); return *this; }
+    String& operator+=(char c) { concat(c); return *this; }
+
+    char charAt(unsigned int index) const;
+    char operator[](unsigned int index) const { return charAt(index); }
+
+private:
+    /**
+     * The longest text held without an allocation.
+     */
+    static const unsigned int INLINE_CAPACITY = 11;
+
+    char* buffer() noexcept { return heap_ != NULL ? heap_ : inline_; }
+    const char* buffer() const noexcept
+    {
+        return heap_ != NULL ? heap_ : inline_;
+    }
+    void assign(const char* text, unsigned int length);
+
+    char inline_[INLINE_CAPACITY + 1];
+    char* heap_;
+    unsigned int capacity_;
+    unsigned int length_;
+};
+
+
+/******************************************************************************/
+/* Print and Stream                                                           */
+/******************************************************************************/
+
+
+class Print
+{
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* data, size_t length);
+    size_t write(const char* text);
+    size_t write(const char* data, size_t length)
+    {
+        return write((const uint8_t*)data, length);
+    }
+    virtual void flush() {}
+
+    size_t print(const char* text);
+    size_t print(const String& text);
+    size_t print(char c);
+    size_t print(int value);
+    size_t print(unsigned int value);
+    size_t print(long value);
+    size_t print(unsigned long value);
+    size_t print(long long value);
+    size_t print(unsigned long long value);
+    size_t print(double value, int digits = 2);
+
+    size_t println();
+    template <typename T>
+    size_t println(const T& value)
+    {
+        size_t length = print(value);
+        return length + println();
+    }
+
+    size_t printf(const char* format, ...)
+        __attribute__((format(printf, 2, 3)));
+};
+
+
+class Stream : public Print
+{
+public:
+    Stream() : timeout_ms_(1000) {}
+
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    /**
+     * Reads bytes until the buffer is full or none arrive for the timeout.
+     */
+    virtual size_t readBytes(char* buffer, size_t length);
+    size_t readBytes(uint8_t* buffer, size_t length)
+    {
+        return readBytes((char*)buffer, length);
+    }
+
+    void setTimeout(unsigned long timeout_ms) { timeout_ms_ = timeout_ms; }
+
+protected:
+    /**
+     * Returns the next byte, or -1 if none arrives for the timeout.
+     */
+    int timedRead();
+
+    unsigned long timeout_ms_;
+};
+
+
+/**
+ * The serial port is the standard output of the host. Nothing is ever read
+ * from it.
+ */
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long baud) { (void)baud; }
+
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t length) override;
+    using Print::write;
+    void flush() override;
+};
+
+extern HardwareSerial Serial;
+
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef HOST_ESP_H
+#define HOST_ESP_H
+
+
+#include <stdint.h>
+
+
+/**
+ * The host has no heap statistics of its own to report, so they read as zero.
+ */
+class EspClass
+{
+public:
+    uint32_t getFreeHeap() { return 0; }
+    uint32_t getMinFreeHeap() { return 0; }
+    uint32_t getMaxAllocHeap() { return 0; }
+    void restart() {}
+};
+
+extern EspClass ESP;
+
+
+#endif
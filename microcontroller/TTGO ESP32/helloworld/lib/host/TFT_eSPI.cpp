@@ -0,0 +1,142 @@
+#include "TFT_eSPI.h"
+
+
+/**
+ * Width of a character of the built-in font at text size 1.
+ */
+static const int16_t CHAR_WIDTH = 6;
+
+
+/******************************************************************************/
+/* TFT_eSPI                                                                   */
+/******************************************************************************/
+
+
+TFT_eSPI::TFT_eSPI()
+    : width_(135), height_(240), pixels_(0)
+{
+}
+
+
+void TFT_eSPI::setRotation(uint8_t rotation)
+{
+    bool landscape = (rotation & 1) != 0;
+    width_ = landscape ? 240 : 135;
+    height_ = landscape ? 135 : 240;
+}
+
+
+void TFT_eSPI::fillScreen(uint32_t color)
+{
+    fillRect(0, 0, width_, height_, color);
+}
+
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h,
+                        uint32_t color)
+{
+    (void)color;
+    countPixels(x, y, w, h);
+}
+
+
+int16_t TFT_eSPI::drawString(const char* text, int32_t x, int32_t y)
+{
+    // Text is drawn glyph by glyph with the background, a cell per character
+    int16_t w = strlen(text) * CHAR_WIDTH;
+    countPixels(x, y, w, 8);
+    return w;
+}
+
+
+void TFT_eSPI::countPixels(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    if (x < 0)
+    {
+        w += x;
+        x = 0;
+    }
+    if (y < 0)
+    {
+        h += y;
+        y = 0;
+    }
+    if (x + w > width_)
+    {
+        w = width_ - x;
+    }
+    if (y + h > height_)
+    {
+        h = height_ - y;
+    }
+    if (w > 0 && h > 0)
+    {
+        pixels_ += (unsigned long)w * h;
+    }
+}
+
+
+/******************************************************************************/
+/* TFT_eSprite                                                                */
+/******************************************************************************/
+
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft)
+    : tft_(tft), depth_(16), width_(0), height_(0), buffer_(NULL)
+{
+}
+
+
+TFT_eSprite::~TFT_eSprite()
+{
+    deleteSprite();
+}
+
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h)
+{
+    deleteSprite();
+
+    // The buffer is allocated as on the device, so it shows in the counts
+    size_t bits = (size_t)w * h * depth_;
+    buffer_ = new uint8_t[(bits + 7) / 8];
+    width_ = w;
+    height_ = h;
+    return buffer_;
+}
+
+
+void TFT_eSprite::deleteSprite()
+{
+    delete[] buffer_;
+    buffer_ = NULL;
+    width_ = 0;
+    height_ = 0;
+}
+
+
+int16_t TFT_eSprite::drawString(const char* text, int32_t x, int32_t y)
+{
+    (void)x;
+    (void)y;
+    return strlen(text) * CHAR_WIDTH;
+}
+
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y)
+{
+    tft_->countPixels(x, y, width_, height_);
+}
+
+
+bool TFT_eSprite::pushSprite(int32_t x, int32_t y, int32_t sx, int32_t sy,
+                             int32_t sw, int32_t sh)
+{
+    if (sx < 0 || sy < 0 || sw <= 0 || sh <= 0 || sx + sw > width_ ||
+        sy + sh > height_)
+    {
+        return false;
+    }
+    tft_->countPixels(x, y, sw, sh);
+    return true;
+}
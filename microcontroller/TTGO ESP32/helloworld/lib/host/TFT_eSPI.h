@@ -0,0 +1,107 @@
+#ifndef HOST_TFT_ESPI_H
+#define HOST_TFT_ESPI_H
+
+
+#include "Arduino.h"
+
+
+#define TFT_BLACK 0x0000
+#define TFT_WHITE 0xFFFF
+
+
+/**
+ * A panel that draws nothing but counts the pixels written to it, which is
+ * what would be sent over SPI. Its size is that of the TTGO panel, 135x240 in
+ * portrait and 240x135 once rotated.
+ */
+class TFT_eSPI
+{
+public:
+    TFT_eSPI();
+
+    void init() {}
+    void setRotation(uint8_t rotation);
+    int16_t width() const noexcept { return width_; }
+    int16_t height() const noexcept { return height_; }
+
+    void fillScreen(uint32_t color);
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+
+    void setTextSize(uint8_t size) { (void)size; }
+    void setTextColor(uint16_t color) { (void)color; }
+    void setTextColor(uint16_t foreground, uint16_t background)
+    {
+        (void)foreground;
+        (void)background;
+    }
+    int16_t drawString(const char* text, int32_t x, int32_t y);
+    int16_t drawString(const String& text, int32_t x, int32_t y)
+    {
+        return drawString(text.c_str(), x, y);
+    }
+
+    /**
+     * Returns the number of pixels written to the panel, see
+     * countPixels().
+     */
+    unsigned long getPixelsWritten() const noexcept { return pixels_; }
+
+    /**
+     * Counts the pixels of a rectangle, clipped to the panel.
+     */
+    void countPixels(int32_t x, int32_t y, int32_t w, int32_t h);
+
+private:
+    int16_t width_;
+    int16_t height_;
+    unsigned long pixels_;
+};
+
+
+/**
+ * An off-screen sprite. Drawing into it costs nothing on the bus; pushing it
+ * counts its pixels on the panel it was made for.
+ */
+class TFT_eSprite
+{
+public:
+    TFT_eSprite(TFT_eSPI* tft);
+    ~TFT_eSprite();
+
+    TFT_eSprite(const TFT_eSprite&) = delete;
+    TFT_eSprite& operator=(const TFT_eSprite&) = delete;
+
+    void setColorDepth(int8_t depth) { depth_ = depth; }
+    void* createSprite(int16_t w, int16_t h);
+    void deleteSprite();
+    void setBitmapColor(uint16_t foreground, uint16_t background)
+    {
+        (void)foreground;
+        (void)background;
+    }
+    int16_t width() const noexcept { return width_; }
+    int16_t height() const noexcept { return height_; }
+
+    void fillSprite(uint32_t color) { (void)color; }
+    void setTextSize(uint8_t size) { (void)size; }
+    void setTextColor(uint16_t foreground, uint16_t background)
+    {
+        (void)foreground;
+        (void)background;
+    }
+    int16_t drawString(const char* text, int32_t x, int32_t y);
+
+    void pushSprite(int32_t x, int32_t y);
+    bool pushSprite(int32_t x, int32_t y, int32_t sx, int32_t sy, int32_t sw,
+                    int32_t sh);
+
+private:
+    TFT_eSPI* tft_;
+    int8_t depth_;
+    int16_t width_;
+    int16_t height_;
+    uint8_t* buffer_;
+};
+
+
+#endif
@@ -0,0 +1,315 @@
+#include "WiFi.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "host.hpp"
+
+
+static const uint8_t DEFAULT_MAC[6] = {0x24, 0x0A, 0xC4, 0x00, 0x00, 0x01};
+
+static thread_local uint8_t mac_address[6] = {
+    DEFAULT_MAC[0], DEFAULT_MAC[1], DEFAULT_MAC[2],
+    DEFAULT_MAC[3], DEFAULT_MAC[4], DEFAULT_MAC[5]
+};
+static thread_local host_socket_stats socket_stats = {};
+
+WiFiClass WiFi;
+
+
+/******************************************************************************/
+/* WiFiClient                                                                 */
+/******************************************************************************/
+
+
+WiFiClient::WiFiClient()
+    : fd_(-1), peer_closed_(false), buffer_(), position_(0), length_(0)
+{
+}
+
+
+WiFiClient::~WiFiClient()
+{
+    stop();
+}
+
+
+int WiFiClient::connect(const char* host, uint16_t port)
+{
+    stop();
+
+    char service[8];
+    snprintf(service, sizeof(service), "%u", (unsigned)port);
+    struct addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    struct addrinfo* addresses;
+    if (getaddrinfo(host, service, &hints, &addresses) != 0)
+    {
+        return 0;
+    }
+
+    for (struct addrinfo* address = addresses; address != NULL;
+         address = address->ai_next)
+    {
+        int fd = socket(address->ai_family, address->ai_socktype,
+                        address->ai_protocol);
+        if (fd < 0)
+        {
+            continue;
+        }
+        if (::connect(fd, address->ai_addr, address->ai_addrlen) == 0)
+        {
+            fd_ = fd;
+            break;
+        }
+        close(fd);
+    }
+    freeaddrinfo(addresses);
+
+    socket_stats.connects++;
+    if (fd_ >= 0 && !startSession(fd_, host))
+    {
+        close(fd_);
+        fd_ = -1;
+    }
+    return fd_ >= 0 ? 1 : 0;
+}
+
+
+void WiFiClient::stop()
+{
+    if (fd_ >= 0)
+    {
+        endSession();
+        close(fd_);
+    }
+    fd_ = -1;
+    peer_closed_ = false;
+    position_ = 0;
+    length_ = 0;
+}
+
+
+uint8_t WiFiClient::connected()
+{
+    if (fd_ < 0)
+    {
+        return 0;
+    }
+    if (position_ < length_ || hasPendingData())
+    {
+        return 1;
+    }
+    if (peer_closed_)
+    {
+        return 0;
+    }
+
+    // As on the device, a peek shows whether the server has closed its end
+    uint8_t c;
+    ssize_t received = recv(fd_, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (received == 0 ||
+        (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+    {
+        peer_closed_ = true;
+        return 0;
+    }
+
+    // What arrived may only close the session, such as a TLS close_notify,
+    // which the session sees once it is read
+    if (received > 0 && !fill(0))
+    {
+        return peer_closed_ ? 0 : 1;
+    }
+    return 1;
+}
+
+
+size_t WiFiClient::write(uint8_t c)
+{
+    return write(&c, 1);
+}
+
+
+size_t WiFiClient::write(const uint8_t* data, size_t length)
+{
+    if (fd_ < 0)
+    {
+        return 0;
+    }
+
+    size_t written = 0;
+    while (written < length)
+    {
+        ssize_t sent = sendData(data + written, length - written);
+        socket_stats.sends++;
+        if (sent <= 0)
+        {
+            break;
+        }
+        written += sent;
+    }
+    socket_stats.bytes_sent += written;
+    return written;
+}
+
+
+int WiFiClient::available()
+{
+    if (position_ == length_ && !fill(1))
+    {
+        return 0;
+    }
+    return (int)(length_ - position_);
+}
+
+
+int WiFiClient::read()
+{
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+
+int WiFiClient::read(uint8_t* buffer, size_t size)
+{
+    if (position_ == length_ && !fill(0))
+    {
+        return -1;
+    }
+
+    size_t count = length_ - position_;
+    if (count > size)
+    {
+        count = size;
+    }
+    memcpy(buffer, buffer_ + position_, count);
+    position_ += count;
+    return (int)count;
+}
+
+
+int WiFiClient::peek()
+{
+    if (position_ == length_ && !fill(0))
+    {
+        return -1;
+    }
+    return buffer_[position_];
+}
+
+
+int WiFiClient::setNoDelay(bool enabled)
+{
+    int value = enabled ? 1 : 0;
+    return fd_ >= 0 ?
+        setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &value, sizeof(value)) : -1;
+}
+
+
+int WiFiClient::setTimeout(uint32_t seconds)
+{
+    Stream::setTimeout(seconds * 1000);
+    return 0;
+}
+
+
+bool WiFiClient::startSession(int fd, const char* host)
+{
+    (void)fd;
+    (void)host;
+    return true;
+}
+
+
+void WiFiClient::endSession()
+{
+}
+
+
+ssize_t WiFiClient::sendData(const uint8_t* data, size_t length)
+{
+    return send(fd_, data, length, MSG_NOSIGNAL);
+}
+
+
+ssize_t WiFiClient::receiveData(uint8_t* buffer, size_t size)
+{
+    return recv(fd_, buffer, size, MSG_DONTWAIT);
+}
+
+
+bool WiFiClient::hasPendingData()
+{
+    return false;
+}
+
+
+bool WiFiClient::fill(int wait_ms)
+{
+    if (fd_ < 0 || peer_closed_)
+    {
+        return false;
+    }
+
+    if (wait_ms > 0 && !hasPendingData())
+    {
+        struct pollfd descriptor = {fd_, POLLIN, 0};
+        if (poll(&descriptor, 1, wait_ms) <= 0)
+        {
+            return false;
+        }
+    }
+
+    ssize_t received = receiveData(buffer_, sizeof(buffer_));
+    socket_stats.receives++;
+    if (received == 0)
+    {
+        peer_closed_ = true;
+        return false;
+    }
+    if (received < 0)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            peer_closed_ = true;
+        }
+        return false;
+    }
+
+    position_ = 0;
+    length_ = received;
+    socket_stats.bytes_received += received;
+    return true;
+}
+
+
+/******************************************************************************/
+/* WiFiClass                                                                  */
+/******************************************************************************/
+
+
+uint8_t* WiFiClass::macAddress(uint8_t* mac)
+{
+    memcpy(mac, mac_address, sizeof(mac_address));
+    return mac;
+}
+
+
+void hostSetMacAddress(const uint8_t* mac)
+{
+    memcpy(mac_address, mac, sizeof(mac_address));
+}
+
+
+host_socket_stats hostGetSocketStats()
+{
+    return socket_stats;
+}
@@ -0,0 +1,115 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+
+#include <sys/types.h>
+
+#include "Arduino.h"
+
+
+/**
+ * A TCP client on a POSIX socket, with the semantics of the WiFiClient of the
+ * device core: writes block until the data is sent, reads never block, and
+ * received data is read from the socket in chunks through a buffer.
+ *
+ * available() waits up to a millisecond for data before reporting that there
+ * is none. The firmware polls it with delay(1) in between, so on the host a
+ * response is picked up as soon as it arrives instead of up to a millisecond
+ * later.
+ */
+class WiFiClient : public Stream
+{
+public:
+    /**
+     * The size of the receive buffer, one segment as on the device.
+     */
+    static const size_t RX_BUFFER_SIZE = 1436;
+
+    WiFiClient();
+    virtual ~WiFiClient();
+
+    WiFiClient(const WiFiClient&) = delete;
+    WiFiClient& operator=(const WiFiClient&) = delete;
+
+    /**
+     * Connects to the host, a name or an address. Returns 1 on success and 0
+     * otherwise.
+     */
+    virtual int connect(const char* host, uint16_t port);
+
+    virtual void stop();
+    virtual uint8_t connected();
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t length) override;
+    using Print::write;
+
+    int available() override;
+    int read() override;
+    virtual int read(uint8_t* buffer, size_t size);
+    int peek() override;
+
+    int setNoDelay(bool enabled);
+    int setTimeout(uint32_t seconds);
+
+protected:
+    /**
+     * Starts the session once the socket to the host is connected, such as
+     * the TLS handshake. Returns false if the connection cannot be used.
+     */
+    virtual bool startSession(int fd, const char* host);
+
+    /**
+     * Ends the session before the socket is closed.
+     */
+    virtual void endSession();
+
+    /**
+     * Sends some of the data, as send() does.
+     */
+    virtual ssize_t sendData(const uint8_t* data, size_t length);
+
+    /**
+     * Receives what is there without waiting, as recv() does: 0 once the peer
+     * has closed the connection, and -1 with errno set to EAGAIN if nothing
+     * has arrived yet.
+     */
+    virtual ssize_t receiveData(uint8_t* buffer, size_t size);
+
+    /**
+     * Returns true if the session holds received data that the socket no
+     * longer shows, such as the rest of a TLS record.
+     */
+    virtual bool hasPendingData();
+
+    /**
+     * Receives whatever the session holds into the empty buffer, waiting up
+     * to the time for it. Returns false if nothing was received.
+     */
+    bool fill(int wait_ms);
+
+private:
+    int fd_;
+    bool peer_closed_;
+    uint8_t buffer_[RX_BUFFER_SIZE];
+    size_t position_;
+    size_t length_;
+};
+
+
+/**
+ * The WiFi station, which is always connected on the host.
+ */
+class WiFiClass
+{
+public:
+    /**
+     * Writes the 6-byte MAC address of the device, see hostSetMacAddress().
+     */
+    uint8_t* macAddress(uint8_t* mac);
+};
+
+extern WiFiClass WiFi;
+
+
+#endif
@@ -0,0 +1,235 @@
+#include "WiFiClientSecure.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+
+
+/**
+ * How long a write waits for room in the socket before giving up, as the
+ * device does once its send timeout passes.
+ */
+static const int WRITE_TIMEOUT_MS = 10000;
+
+
+WiFiClientSecure::WiFiClientSecure()
+    : ca_certificate_(NULL), insecure_(false), handshake_timeout_s_(120),
+      handshakes_(0), context_(NULL), ssl_(NULL)
+{
+}
+
+
+WiFiClientSecure::~WiFiClientSecure()
+{
+    stop();
+    resetContext();
+}
+
+
+void WiFiClientSecure::setCACert(const char* ca_certificate)
+{
+    ca_certificate_ = ca_certificate;
+    insecure_ = false;
+    resetContext();
+}
+
+
+void WiFiClientSecure::setInsecure()
+{
+    ca_certificate_ = NULL;
+    insecure_ = true;
+    resetContext();
+}
+
+
+void WiFiClientSecure::setHandshakeTimeout(unsigned long seconds)
+{
+    handshake_timeout_s_ = seconds;
+}
+
+
+unsigned long WiFiClientSecure::getHandshakes() const noexcept
+{
+    return handshakes_;
+}
+
+
+bool WiFiClientSecure::startSession(int fd, const char* host)
+{
+    if (ca_certificate_ == NULL && !insecure_)
+    {
+        return false;
+    }
+
+    // OpenSSL writes to the socket without MSG_NOSIGNAL, so a server that
+    // went away would kill the program instead of failing the write
+    signal(SIGPIPE, SIG_IGN);
+
+    // The context is made on the first connection, after the CA is known
+    if (context_ == NULL)
+    {
+        context_ = SSL_CTX_new(TLS_client_method());
+        if (context_ == NULL)
+        {
+            return false;
+        }
+        SSL_CTX_set_session_cache_mode(context_, SSL_SESS_CACHE_OFF);
+        if (ca_certificate_ != NULL)
+        {
+            BIO* bio = BIO_new_mem_buf(ca_certificate_, -1);
+            X509* ca = PEM_read_bio_X509(bio, NULL, NULL, NULL);
+            BIO_free(bio);
+            bool added = ca != NULL &&
+                X509_STORE_add_cert(SSL_CTX_get_cert_store(context_), ca) == 1;
+            X509_free(ca);
+            if (!added)
+            {
+                resetContext();
+                return false;
+            }
+        }
+        SSL_CTX_set_verify(context_, insecure_ ? SSL_VERIFY_NONE : SSL_VERIFY_PEER,
+                           NULL);
+    }
+
+    ssl_ = SSL_new(context_);
+    if (ssl_ == NULL)
+    {
+        return false;
+    }
+    SSL_set_fd(ssl_, fd);
+
+    // The certificate must be issued for the name or address connected to
+    struct in6_addr address;
+    bool is_address = inet_pton(AF_INET, host, &address) == 1 ||
+                      inet_pton(AF_INET6, host, &address) == 1;
+    if (!is_address)
+    {
+        SSL_set_tlsext_host_name(ssl_, host);
+    }
+    if (!insecure_)
+    {
+        X509_VERIFY_PARAM* param = SSL_get0_param(ssl_);
+        if (is_address)
+        {
+            X509_VERIFY_PARAM_set1_ip_asc(param, host);
+        }
+        else
+        {
+            X509_VERIFY_PARAM_set1_host(param, host, 0);
+        }
+    }
+
+    // The handshake blocks up to its timeout; afterwards the socket does not
+    // block, so reads return right away as on the device
+    struct timeval timeout = {(time_t)handshake_timeout_s_, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    if (SSL_connect(ssl_) != 1)
+    {
+        ERR_clear_error();
+        SSL_free(ssl_);
+        ssl_ = NULL;
+        return false;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    handshakes_++;
+    return true;
+}
+
+
+void WiFiClientSecure::endSession()
+{
+    if (ssl_ != NULL)
+    {
+        SSL_shutdown(ssl_);
+        SSL_free(ssl_);
+        ssl_ = NULL;
+    }
+    ERR_clear_error();
+}
+
+
+ssize_t WiFiClientSecure::sendData(const uint8_t* data, size_t length)
+{
+    if (ssl_ == NULL)
+    {
+        return -1;
+    }
+
+    while (true)
+    {
+        size_t written;
+        if (SSL_write_ex(ssl_, data, length, &written) == 1)
+        {
+            return (ssize_t)written;
+        }
+        int error = SSL_get_error(ssl_, 0);
+        ERR_clear_error();
+        if (error != SSL_ERROR_WANT_WRITE && error != SSL_ERROR_WANT_READ)
+        {
+            return -1;
+        }
+        struct pollfd descriptor = {
+            SSL_get_fd(ssl_),
+            (short)(error == SSL_ERROR_WANT_WRITE ? POLLOUT : POLLIN), 0
+        };
+        if (poll(&descriptor, 1, WRITE_TIMEOUT_MS) <= 0)
+        {
+            return -1;
+        }
+    }
+}
+
+
+ssize_t WiFiClientSecure::receiveData(uint8_t* buffer, size_t size)
+{
+    if (ssl_ == NULL)
+    {
+        return 0;
+    }
+
+    size_t received;
+    if (SSL_read_ex(ssl_, buffer, size, &received) == 1)
+    {
+        return (ssize_t)received;
+    }
+    int error = SSL_get_error(ssl_, 0);
+    ERR_clear_error();
+    if (error == SSL_ERROR_WANT_READ || error == SSL_ERROR_WANT_WRITE)
+    {
+        errno = EAGAIN;
+        return -1;
+    }
+    if (error == SSL_ERROR_ZERO_RETURN)
+    {
+        return 0;
+    }
+    errno = ECONNRESET;
+    return -1;
+}
+
+
+void WiFiClientSecure::resetContext()
+{
+    if (context_ != NULL)
+    {
+        SSL_CTX_free(context_);
+        context_ = NULL;
+    }
+}
+
+
+bool WiFiClientSecure::hasPendingData()
+{
+    return ssl_ != NULL && SSL_pending(ssl_) > 0;
+}
@@ -0,0 +1,69 @@
+#ifndef HOST_WIFI_CLIENT_SECURE_H
+#define HOST_WIFI_CLIENT_SECURE_H
+
+
+#include "WiFi.h"
+
+
+struct ssl_st;
+struct ssl_ctx_st;
+
+
+/**
+ * A TLS client on OpenSSL with the interface of the WiFiClientSecure of the
+ * device core: connect() performs the handshake, and the server certificate
+ * is checked against the CA set with setCACert() and the name connected to,
+ * unless setInsecure() was called. A client with neither never connects.
+ *
+ * As on the device, there is no session cache, so every connection pays for
+ * a full handshake.
+ */
+class WiFiClientSecure : public WiFiClient
+{
+public:
+    WiFiClientSecure();
+    ~WiFiClientSecure() override;
+
+    /**
+     * Trusts only the CA of the PEM certificate, which must outlive the
+     * client as on the device.
+     */
+    void setCACert(const char* ca_certificate);
+
+    /**
+     * Accepts any server certificate.
+     */
+    void setInsecure();
+
+    void setHandshakeTimeout(unsigned long seconds);
+
+    /**
+     * Returns the number of handshakes completed, which is how many times the
+     * cost of one was paid.
+     */
+    unsigned long getHandshakes() const noexcept;
+
+protected:
+    bool startSession(int fd, const char* host) override;
+    void endSession() override;
+    ssize_t sendData(const uint8_t* data, size_t length) override;
+    ssize_t receiveData(uint8_t* buffer, size_t size) override;
+    bool hasPendingData() override;
+
+private:
+    /**
+     * Drops the context, so the next connection makes one with the current
+     * settings.
+     */
+    void resetContext();
+
+    const char* ca_certificate_;
+    bool insecure_;
+    unsigned long handshake_timeout_s_;
+    unsigned long handshakes_;
+    ssl_ctx_st* context_;
+    ssl_st* ssl_;
+};
+
+
+#endif
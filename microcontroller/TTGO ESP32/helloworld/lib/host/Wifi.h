@@ -0,0 +1,9 @@
+#ifndef HOST_WIFI_LOWER_H
+#define HOST_WIFI_LOWER_H
+
+
+// The device core finds WiFi.h under either name; the host is case sensitive
+#include "WiFi.h"
+
+
+#endif
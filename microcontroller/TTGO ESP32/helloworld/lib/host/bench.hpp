@@ -0,0 +1,93 @@
+#ifndef HOST_BENCH_HPP
+#define HOST_BENCH_HPP
+
+
+#include <chrono>
+#include <stdio.h>
+
+#include "host.hpp"
+
+
+/**
+ * What one operation of a benchmark cost on average.
+ */
+struct bench_result {
+    unsigned long iterations;
+    double ns_per_op;
+    double allocs_per_op;       // operator new calls, see hostGetAllocations()
+    double sends_per_op;        // send() calls of the WiFi clients
+    double receives_per_op;     // recv() calls of the WiFi clients
+    double bytes_sent_per_op;
+    double bytes_received_per_op;
+};
+
+
+/**
+ * Runs the operation until it has taken at least the minimum time, doubling
+ * the number of iterations each round, and prints its cost per operation as
+ * a line of the form
+ *
+ *     name: 1234.5 ns/op, 0.00 allocs/op
+ *
+ * followed by the socket calls and bytes per operation if it used any. Only
+ * the calling thread is measured, so the operation must not hand its work to
+ * another thread.
+ */
+template <typename Operation>
+bench_result benchRun(const char* name, Operation operation,
+                      unsigned long min_time_ms = 250)
+{
+    typedef std::chrono::steady_clock clock;
+
+    // One untimed call warms the caches and makes any allocation made once,
+    // such as that of a buffer reused afterwards
+    operation();
+
+    bench_result result = {};
+    for (unsigned long iterations = 1; ; iterations *= 2)
+    {
+        unsigned long allocations = hostGetAllocations();
+        host_socket_stats sockets = hostGetSocketStats();
+        clock::time_point start = clock::now();
+        for (unsigned long i = 0; i < iterations; i++)
+        {
+            operation();
+        }
+        clock::duration elapsed = clock::now() - start;
+        host_socket_stats end = hostGetSocketStats();
+
+        if (elapsed < std::chrono::milliseconds(min_time_ms) &&
+            iterations < (1ul << 30))
+        {
+            continue;
+        }
+
+        double n = (double)iterations;
+        result.iterations = iterations;
+        result.ns_per_op =
+            std::chrono::duration<double, std::nano>(elapsed).count() / n;
+        result.allocs_per_op = (hostGetAllocations() - allocations) / n;
+        result.sends_per_op = (end.sends - sockets.sends) / n;
+        result.receives_per_op = (end.receives - sockets.receives) / n;
+        result.bytes_sent_per_op = (end.bytes_sent - sockets.bytes_sent) / n;
+        result.bytes_received_per_op =
+            (end.bytes_received - sockets.bytes_received) / n;
+        break;
+    }
+
+    printf("%s: %.1f ns/op, %.2f allocs/op", name, result.ns_per_op,
+           result.allocs_per_op);
+    if (result.sends_per_op > 0 || result.receives_per_op > 0)
+    {
+        printf(", %.2f sends/op, %.2f recvs/op, %.0f B sent/op, "
+               "%.0f B received/op", result.sends_per_op,
+               result.receives_per_op, result.bytes_sent_per_op,
+               result.bytes_received_per_op);
+    }
+    printf("\n");
+    fflush(stdout);
+    return result;
+}
+
+
+#endif
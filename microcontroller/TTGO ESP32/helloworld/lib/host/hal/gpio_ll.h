@@ -0,0 +1,33 @@
+#ifndef HOST_HAL_GPIO_LL_H
+#define HOST_HAL_GPIO_LL_H
+
+
+#include "driver/gpio.h"
+
+
+/**
+ * The register-level GPIO calls of ESP-IDF that the firmware uses. On the
+ * device they write the GPIO registers directly, so unlike the driver they
+ * can be called from an interrupt handler; on the host they do what the
+ * driver does.
+ */
+
+typedef struct gpio_dev_s gpio_dev_t;
+
+extern gpio_dev_t GPIO;
+
+static inline void gpio_ll_wakeup_enable(gpio_dev_t* hw, gpio_num_t pin,
+                                         gpio_int_type_t type)
+{
+    (void)hw;
+    gpio_wakeup_enable(pin, type);
+}
+
+static inline void gpio_ll_wakeup_disable(gpio_dev_t* hw, gpio_num_t pin)
+{
+    (void)hw;
+    gpio_wakeup_disable(pin);
+}
+
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef HOST_HOST_HPP
+#define HOST_HOST_HPP
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * Controls of the host implementation of the board, for tests and tools that
+ * run in the native environment. None of this exists on the device.
+ */
+
+/**
+ * Switches millis() and micros() to a simulated clock that starts at the time
+ * and only moves when advanced, either by hostAdvanceClock() or by delay().
+ */
+void hostUseSimulatedClock(uint64_t start_us);
+
+/**
+ * Switches back to the monotonic clock of the host.
+ */
+void hostUseRealClock();
+
+/**
+ * Moves the simulated clock forward.
+ */
+void hostAdvanceClock(uint64_t us);
+
+/**
+ * Sets the level read from a pin, as if it were driven from outside. The
+ * interrupt attached to the pin runs on the calling thread if the change
+ * triggers it.
+ */
+void hostSetPin(uint8_t pin, int level);
+
+/**
+ * Returns the number of times the interrupt of a pin has run since it was
+ * attached. A level interrupt runs over and over while the pin stays at its
+ * level, up to a limit that stands for the watchdog reset of the device.
+ */
+unsigned long hostGetInterrupts(uint8_t pin);
+
+/**
+ * Returns the level last written to a pin, or set by hostSetPin().
+ */
+int hostGetPin(uint8_t pin);
+
+/**
+ * Sets the MAC address WiFi reports to the calling thread, so that each thread
+ * can stand for a separate device.
+ */
+void hostSetMacAddress(const uint8_t* mac);
+
+/**
+ * System calls made by the WiFi clients of the calling thread.
+ */
+struct host_socket_stats {
+    unsigned long connects;
+    unsigned long sends;
+    unsigned long receives;
+    unsigned long bytes_sent;
+    unsigned long bytes_received;
+};
+
+/**
+ * Returns the socket counters of the calling thread.
+ */
+host_socket_stats hostGetSocketStats();
+
+/**
+ * Returns the number of heap allocations made through operator new by the
+ * calling thread, which is how String and the standard containers allocate.
+ */
+unsigned long hostGetAllocations();
+
+/**
+ * Starts measuring the peak of the heap held by the calling thread from what
+ * it holds now.
+ */
+void hostResetHeapPeak();
+
+/**
+ * Returns how many bytes more than at hostResetHeapPeak() the calling thread
+ * has held at once through operator new since, counted as the allocator
+ * rounds them up.
+ */
+long hostGetHeapPeak();
+
+
+#endif
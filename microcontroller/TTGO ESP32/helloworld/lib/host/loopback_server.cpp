@@ -0,0 +1,314 @@
+#include "loopback_server.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <openssl/err.h>
+#include <openssl/pem.h>
+#include <openssl/ssl.h>
+
+
+/**
+ * How often the server looks at whether it was asked to stop.
+ */
+static const int POLL_INTERVAL_MS = 20;
+
+
+LoopbackServer::LoopbackServer(handler handler)
+    : handler_(handler), context_(NULL), listen_fd_(-1), port_(0),
+      running_(false), requests_(0), thread_()
+{
+}
+
+
+LoopbackServer::~LoopbackServer()
+{
+    end();
+    if (context_ != NULL)
+    {
+        SSL_CTX_free(context_);
+    }
+}
+
+
+bool LoopbackServer::begin()
+{
+    listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd_ < 0)
+    {
+        return false;
+    }
+
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t length = sizeof(address);
+    if (bind(listen_fd_, (struct sockaddr*)&address, sizeof(address)) != 0 ||
+        listen(listen_fd_, 16) != 0 ||
+        getsockname(listen_fd_, (struct sockaddr*)&address, &length) != 0)
+    {
+        close(listen_fd_);
+        listen_fd_ = -1;
+        return false;
+    }
+    port_ = ntohs(address.sin_port);
+
+    running_ = true;
+    thread_ = std::thread(&LoopbackServer::run, this);
+    return true;
+}
+
+
+bool LoopbackServer::beginSecure(const std::string& certificate,
+                                 const std::string& key)
+{
+    context_ = SSL_CTX_new(TLS_server_method());
+    if (context_ == NULL)
+    {
+        return false;
+    }
+
+    BIO* bio = BIO_new_mem_buf(certificate.data(), (int)certificate.size());
+    X509* leaf = PEM_read_bio_X509(bio, NULL, NULL, NULL);
+    bool loaded = leaf != NULL && SSL_CTX_use_certificate(context_, leaf) == 1;
+    X509_free(leaf);
+    X509* chain;
+    while (loaded && (chain = PEM_read_bio_X509(bio, NULL, NULL, NULL)) != NULL)
+    {
+        // The context keeps the certificate of the chain
+        loaded = SSL_CTX_add_extra_chain_cert(context_, chain) == 1;
+    }
+    BIO_free(bio);
+
+    bio = BIO_new_mem_buf(key.data(), (int)key.size());
+    EVP_PKEY* private_key = PEM_read_bio_PrivateKey(bio, NULL, NULL, NULL);
+    BIO_free(bio);
+    loaded = loaded && private_key != NULL &&
+             SSL_CTX_use_PrivateKey(context_, private_key) == 1;
+    EVP_PKEY_free(private_key);
+    ERR_clear_error();
+
+    return loaded && begin();
+}
+
+
+void LoopbackServer::end()
+{
+    running_ = false;
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+    if (listen_fd_ >= 0)
+    {
+        close(listen_fd_);
+        listen_fd_ = -1;
+    }
+}
+
+
+uint16_t LoopbackServer::getPort() const noexcept
+{
+    return port_;
+}
+
+
+unsigned long LoopbackServer::getRequests() const noexcept
+{
+    return requests_;
+}
+
+
+std::string LoopbackServer::respond(int status, const char* content_type,
+                                    const std::string& body, bool close)
+{
+    char head[256];
+    snprintf(head, sizeof(head),
+             "HTTP/1.1 %d %s\r\n"
+             "Content-Type: %s\r\n"
+             "Content-Length: %zu\r\n"
+             "Connection: %s\r\n"
+             "\r\n",
+             status, status == 200 ? "OK" : "Error", content_type,
+             body.size(), close ? "close" : "keep-alive");
+    return head + body;
+}
+
+
+void LoopbackServer::run()
+{
+    unsigned long connections = 0;
+    while (running_)
+    {
+        struct pollfd descriptor = {listen_fd_, POLLIN, 0};
+        if (poll(&descriptor, 1, POLL_INTERVAL_MS) <= 0)
+        {
+            continue;
+        }
+        int fd = accept(listen_fd_, NULL, NULL);
+        if (fd >= 0)
+        {
+            serve(fd, ++connections);
+            close(fd);
+        }
+    }
+}
+
+
+void LoopbackServer::serve(int fd, unsigned long connection)
+{
+    SSL* ssl = NULL;
+    if (context_ != NULL)
+    {
+        ssl = SSL_new(context_);
+        SSL_set_fd(ssl, fd);
+        struct timeval timeout = {1, 0};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        bool accepted = SSL_accept(ssl) == 1;
+        ERR_clear_error();
+        if (!accepted)
+        {
+            SSL_free(ssl);
+            return;
+        }
+    }
+
+    std::string received;
+    while (running_)
+    {
+        // Read until a whole request, head and body, has arrived
+        size_t head_end = received.find("\r\n\r\n");
+        size_t content_length = 0;
+        if (head_end != std::string::npos)
+        {
+            std::string head = received.substr(0, head_end + 2);
+            size_t field = 0;
+            while ((field = head.find("\r\n", field)) != std::string::npos)
+            {
+                field += 2;
+                if (strncasecmp(head.c_str() + field, "Content-Length:", 15) == 0)
+                {
+                    content_length = strtoul(head.c_str() + field + 15, NULL, 10);
+                }
+            }
+        }
+        if (head_end == std::string::npos ||
+            received.size() < head_end + 4 + content_length)
+        {
+            char buffer[4096];
+            ssize_t count = receive(fd, ssl, buffer, sizeof(buffer),
+                                    POLL_INTERVAL_MS);
+            if (count == 0)
+            {
+                break;
+            }
+            if (count > 0)
+            {
+                received.append(buffer, count);
+            }
+            continue;
+        }
+
+        request request;
+        size_t path_start = received.find(' ') + 1;
+        request.path = received.substr(path_start,
+                                       received.find(' ', path_start) - path_start);
+        size_t type = received.find("Content-Type:");
+        if (type == std::string::npos)
+        {
+            type = received.find("content-type:");
+        }
+        if (type != std::string::npos && type < head_end)
+        {
+            size_t start = received.find_first_not_of(' ', type + 13);
+            request.content_type =
+                received.substr(start, received.find("\r\n", start) - start);
+        }
+        request.body = received.substr(head_end + 4, content_length);
+        request.connection = connection;
+        received.erase(0, head_end + 4 + content_length);
+        requests_++;
+
+        std::string response = handler_(request);
+        if (response.empty() || !sendAll(fd, ssl, response) ||
+            response.find("Connection: close") < response.find("\r\n\r\n"))
+        {
+            break;
+        }
+    }
+
+    if (ssl != NULL)
+    {
+        SSL_shutdown(ssl);
+        SSL_free(ssl);
+        ERR_clear_error();
+    }
+}
+
+
+ssize_t LoopbackServer::receive(int fd, SSL* session, char* buffer,
+                                size_t size, int wait_ms)
+{
+    if (session == NULL || SSL_pending(session) == 0)
+    {
+        struct pollfd descriptor = {fd, POLLIN, 0};
+        if (poll(&descriptor, 1, wait_ms) <= 0)
+        {
+            return -1;
+        }
+    }
+    if (session == NULL)
+    {
+        ssize_t count = recv(fd, buffer, size, 0);
+        return count < 0 ? 0 : count;
+    }
+
+    size_t count;
+    if (SSL_read_ex(session, buffer, size, &count) == 1)
+    {
+        return (ssize_t)count;
+    }
+    int error = SSL_get_error(session, 0);
+    ERR_clear_error();
+    return error == SSL_ERROR_WANT_READ ? -1 : 0;
+}
+
+
+bool LoopbackServer::sendAll(int fd, SSL* session, const std::string& data)
+{
+    size_t sent = 0;
+    while (sent < data.size())
+    {
+        size_t count;
+        if (session != NULL)
+        {
+            if (SSL_write_ex(session, data.data() + sent, data.size() - sent,
+                             &count) != 1)
+            {
+                ERR_clear_error();
+                return false;
+            }
+        }
+        else
+        {
+            ssize_t result = send(fd, data.data() + sent, data.size() - sent,
+                                  MSG_NOSIGNAL);
+            if (result <= 0)
+            {
+                return false;
+            }
+            count = (size_t)result;
+        }
+        sent += count;
+    }
+    return true;
+}
@@ -0,0 +1,106 @@
+#ifndef HOST_LOOPBACK_SERVER_HPP
+#define HOST_LOOPBACK_SERVER_HPP
+
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+
+
+struct ssl_st;
+struct ssl_ctx_st;
+
+
+/**
+ * An HTTP server on the loopback interface for tests and benchmarks of the
+ * network client, answering on a thread of its own. Connections are served
+ * one at a time and kept open for as long as the client keeps them open.
+ */
+class LoopbackServer
+{
+public:
+    struct request {
+        std::string path;
+        std::string content_type;
+        std::string body;
+        unsigned long connection; // which connection, counted from 1
+    };
+
+    /**
+     * Returns the whole response to a request, head and body, or an empty
+     * string to close the connection without answering.
+     */
+    typedef std::function<std::string(const request&)> handler;
+
+    LoopbackServer(handler handler);
+    ~LoopbackServer();
+
+    LoopbackServer(const LoopbackServer&) = delete;
+    LoopbackServer& operator=(const LoopbackServer&) = delete;
+
+    /**
+     * Listens on a free port of 127.0.0.1 and starts answering. Returns false
+     * if the socket could not be opened.
+     */
+    bool begin();
+
+    /**
+     * Listens as begin() does, but over TLS with the PEM certificate chain
+     * and private key. Returns false if they cannot be used.
+     */
+    bool beginSecure(const std::string& certificate, const std::string& key);
+
+    /**
+     * Stops answering and closes the sockets.
+     */
+    void end();
+
+    uint16_t getPort() const noexcept;
+
+    /**
+     * Returns the number of requests read, answered or not.
+     */
+    unsigned long getRequests() const noexcept;
+
+    /**
+     * Returns a response with the status, a body and the content type, which
+     * closes the connection if close is true.
+     */
+    static std::string respond(int status, const char* content_type,
+                               const std::string& body, bool close = false);
+
+private:
+    void run();
+
+    /**
+     * Answers the requests of a connection until either side closes it.
+     */
+    void serve(int fd, unsigned long connection);
+
+    /**
+     * Waits up to the time for data and receives it, over TLS if the server
+     * is secure. Returns the bytes received, 0 once the connection has
+     * closed and -1 if nothing arrived in time.
+     */
+    ssize_t receive(int fd, ssl_st* ssl, char* buffer, size_t size,
+                    int wait_ms);
+
+    /**
+     * Sends all of the data. Returns false if the connection has closed.
+     */
+    bool sendAll(int fd, ssl_st* ssl, const std::string& data);
+
+    handler handler_;
+    ssl_ctx_st* context_;
+    int listen_fd_;
+    uint16_t port_;
+    std::atomic<bool> running_;
+    std::atomic<unsigned long> requests_;
+    std::thread thread_;
+};
+
+
+#endif
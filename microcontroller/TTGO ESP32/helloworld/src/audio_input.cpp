@@ -0,0 +1,161 @@
+#include "audio_input.hpp"
+
+
+/**
+ * Stack size of the audio task in bytes. The blocks are kept in static
+ * buffers rather than on the stack.
+ */
+static const uint32_t AUDIO_TASK_STACK_SIZE = 3072;
+
+/**
+ * The audio task runs above the loop, so blocks are processed as they arrive.
+ */
+static const UBaseType_t AUDIO_TASK_PRIORITY = 2;
+
+/**
+ * The I2S port the ADC is read through; only port 0 can sample the ADC.
+ */
+static const i2s_port_t AUDIO_I2S_PORT = I2S_NUM_0;
+
+/**
+ * The DMA buffers hold a few blocks, so none are lost while the task waits on
+ * the processor.
+ */
+static const int AUDIO_DMA_BUFFERS = 4;
+
+/**
+ * ADC samples are 12 bits wide, with the channel in the top 4 bits.
+ */
+static const uint16_t ADC_SAMPLE_MASK = 0x0FFF;
+
+/**
+ * The throughput counters are halved once this much processing time has been
+ * counted, so they do not overflow and follow changes over time.
+ */
+static const uint32_t THROUGHPUT_WINDOW_US = 1000000000;
+
+
+AudioInput::AudioInput(adc1_channel_t channel, uint32_t tone_hz)
+    : channel_(channel), detector_(SAMPLE_RATE, tone_hz, BLOCK_SIZE), task_(NULL),
+      wake_task_(NULL), events_(), processed_samples_(0), processing_us_(0),
+      dropped_events_(0)
+{
+}
+
+
+bool AudioInput::begin(BaseType_t core)
+{
+    if (task_ != NULL)
+    {
+        return true;
+    }
+
+    i2s_config_t config = {};
+    config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_ADC_BUILT_IN);
+    config.sample_rate = SAMPLE_RATE;
+    config.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+    config.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+    config.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+    config.intr_alloc_flags = 0;
+    config.dma_buf_count = AUDIO_DMA_BUFFERS;
+    config.dma_buf_len = BLOCK_SIZE;
+    config.use_apll = false;
+
+    if (i2s_driver_install(AUDIO_I2S_PORT, &config, 0, NULL) != ESP_OK)
+    {
+        return false;
+    }
+    if (i2s_set_adc_mode(ADC_UNIT_1, channel_) != ESP_OK ||
+        i2s_adc_enable(AUDIO_I2S_PORT) != ESP_OK)
+    {
+        i2s_driver_uninstall(AUDIO_I2S_PORT);
+        return false;
+    }
+
+    BaseType_t result = xTaskCreatePinnedToCore(
+        run, "audio", AUDIO_TASK_STACK_SIZE, this, AUDIO_TASK_PRIORITY, &task_,
+        core
+    );
+    return result == pdPASS;
+}
+
+
+void AudioInput::setWakeTask(TaskHandle_t task) noexcept
+{
+    wake_task_ = task;
+}
+
+
+bool AudioInput::poll(tone_event& event)
+{
+    return events_.pop(event);
+}
+
+
+uint32_t AudioInput::getSamplesPerSecond() const noexcept
+{
+    uint32_t processing_us = processing_us_;
+    if (processing_us == 0)
+    {
+        return 0;
+    }
+    return (uint32_t)((uint64_t)processed_samples_ * 1000000 / processing_us);
+}
+
+
+unsigned long AudioInput::getDroppedEvents() const noexcept
+{
+    return dropped_events_;
+}
+
+
+void AudioInput::run(void* arg)
+{
+    AudioInput& self = *static_cast<AudioInput*>(arg);
+    static uint16_t raw[BLOCK_SIZE];
+    static int16_t samples[BLOCK_SIZE];
+    const uint32_t block_us = BLOCK_SIZE * 1000000 / SAMPLE_RATE;
+
+    while (true)
+    {
+        size_t bytes_read = 0;
+        if (i2s_read(AUDIO_I2S_PORT, raw, sizeof(raw), &bytes_read,
+                     portMAX_DELAY) != ESP_OK || bytes_read != sizeof(raw))
+        {
+            continue;
+        }
+        // The block has just been completed, so it began a block ago
+        uint32_t block_start_us = micros() - block_us;
+
+        uint32_t start_us = micros();
+        for (size_t i = 0; i < BLOCK_SIZE; i++)
+        {
+            samples[i] = (int16_t)(raw[i] & ADC_SAMPLE_MASK);
+        }
+        bool was_on = self.detector_.isOn();
+        bool on = self.detector_.process(samples);
+        self.processing_us_ += micros() - start_us;
+        self.processed_samples_ += BLOCK_SIZE;
+        if (self.processing_us_ >= THROUGHPUT_WINDOW_US)
+        {
+            self.processing_us_ = self.processing_us_ / 2;
+            self.processed_samples_ = self.processed_samples_ / 2;
+        }
+
+        if (on == was_on)
+        {
+            continue;
+        }
+
+        // The task is the single producer of the queue
+        tone_event event = {on, block_start_us};
+        if (!self.events_.push(event))
+        {
+            self.dropped_events_++;
+        }
+        else if (self.wake_task_ != NULL)
+        {
+            xTaskNotifyGive(self.wake_task_);
+        }
+    }
+}
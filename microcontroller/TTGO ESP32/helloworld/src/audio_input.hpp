@@ -0,0 +1,93 @@
+#ifndef HELLOWORLD_AUDIO_INPUT_HPP
+#define HELLOWORLD_AUDIO_INPUT_HPP
+
+
+#include <Arduino.h>
+#include <atomic>
+#include <driver/i2s.h>
+
+#include "goertzel.hpp"
+#include "ring_buffer.hpp"
+
+
+/**
+ * Listens for Morse sent as a tone, such as CW received over the air, on a
+ * microphone or audio line wired to an ADC1 pin. The ADC is sampled by the I2S
+ * peripheral through DMA, and a task of its own runs each block through a
+ * ToneDetector. The starts and ends of the tone are queued with timestamps,
+ * like the edges of a key, so the main loop can classify them with the same
+ * MorseKeyer.
+ */
+class AudioInput
+{
+public:
+    /**
+     * A start or end of the tone.
+     */
+    struct tone_event {
+        bool on;
+        uint32_t time_us; // micros() when the block it was detected in began
+    };
+
+    /**
+     * The sample rate and block size. Blocks of 10 ms resolve dots up to about
+     * 40 words per minute, and make the bins 100 Hz wide.
+     */
+    static const uint32_t SAMPLE_RATE = 8000;
+    static const size_t BLOCK_SIZE = 80;
+
+    /**
+     * The tone listened for by default, a common CW sidetone.
+     */
+    static const uint32_t DEFAULT_TONE_HZ = 700;
+
+    /**
+     * Creates an input on the ADC1 channel for the tone.
+     */
+    AudioInput(adc1_channel_t channel = ADC1_CHANNEL_0,
+               uint32_t tone_hz = DEFAULT_TONE_HZ);
+
+    /**
+     * Starts sampling and the task that detects the tone, pinned to the core.
+     * Returns false if the I2S driver or the task could not be started.
+     */
+    bool begin(BaseType_t core = 1);
+
+    /**
+     * Notifies the task whenever an event is queued, so a task blocked in
+     * ulTaskNotifyTake() wakes up for it.
+     */
+    void setWakeTask(TaskHandle_t task) noexcept;
+
+    /**
+     * Removes the oldest queued event and stores it in the event. Returns false
+     * if there are no events.
+     */
+    bool poll(tone_event& event);
+
+    /**
+     * Returns the number of samples the detector processes per second of
+     * processor time, 0 before the first block.
+     */
+    uint32_t getSamplesPerSecond() const noexcept;
+
+    /**
+     * Returns the number of events dropped because the queue was full.
+     */
+    unsigned long getDroppedEvents() const noexcept;
+
+private:
+    static void run(void* arg);
+
+    adc1_channel_t channel_;
+    ToneDetector detector_;
+    TaskHandle_t task_;
+    TaskHandle_t wake_task_;
+    RingBuffer<tone_event, 16> events_;
+    std::atomic<uint32_t> processed_samples_;
+    std::atomic<uint32_t> processing_us_;
+    std::atomic<unsigned long> dropped_events_;
+};
+
+
+#endif
@@ -0,0 +1,150 @@
+#include "buttons.hpp"
+
+#include <hal/gpio_ll.h>
+
+
+ButtonInput::ButtonInput()
+    : buttons_(), button_count_(0), wake_task_(NULL), wakeup_(false),
+      events_(), dropped_events_(0)
+{
+}
+
+
+bool ButtonInput::attach(uint8_t pin)
+{
+    if (button_count_ >= MAX_BUTTONS)
+    {
+        return false;
+    }
+
+    button_state& button = buttons_[button_count_++];
+    button.owner = this;
+    button.pin = pin;
+    button.pressed = !digitalRead(pin);
+    button.last_edge_us = micros();
+
+    attachInterruptArg(digitalPinToInterrupt(pin), handleEdge, &button, CHANGE);
+    return true;
+}
+
+
+void ButtonInput::setWakeTask(TaskHandle_t task) noexcept
+{
+    wake_task_ = task;
+}
+
+
+void ButtonInput::enableWakeup()
+{
+    wakeup_ = true;
+    for (size_t i = 0; i < button_count_; i++)
+    {
+        portDISABLE_INTERRUPTS();
+        armWakeup(buttons_[i].pin, digitalRead(buttons_[i].pin));
+        portENABLE_INTERRUPTS();
+    }
+}
+
+
+void ButtonInput::resync()
+{
+    // Interrupts are masked so the button interrupts, which run on this core,
+    // cannot push at the same time and the queue keeps a single producer
+    for (size_t i = 0; i < button_count_; i++)
+    {
+        portDISABLE_INTERRUPTS();
+        updateButton(buttons_[i]);
+        portENABLE_INTERRUPTS();
+    }
+}
+
+
+bool ButtonInput::poll(button_event& event)
+{
+    return events_.pop(event);
+}
+
+
+bool ButtonInput::isPressed(uint8_t pin) const
+{
+    for (size_t i = 0; i < button_count_; i++)
+    {
+        if (buttons_[i].pin == pin)
+        {
+            return buttons_[i].pressed;
+        }
+    }
+    return false;
+}
+
+
+unsigned long ButtonInput::getDroppedEvents() const
+{
+    return dropped_events_;
+}
+
+
+void IRAM_ATTR ButtonInput::handleEdge(void* arg)
+{
+    button_state& button = *static_cast<button_state*>(arg);
+    TaskHandle_t wake_task = button.owner->wake_task_;
+
+    if (updateButton(button) && wake_task != NULL)
+    {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(wake_task, &woken);
+        if (woken == pdTRUE)
+        {
+            portYIELD_FROM_ISR();
+        }
+    }
+}
+
+
+bool IRAM_ATTR ButtonInput::updateButton(button_state& button)
+{
+    uint32_t now = micros();
+    int level = digitalRead(button.pin);
+
+    // A level interrupt must be moved off the level it fired at, bounce or
+    // not, or it fires again as soon as the handler returns
+    if (button.owner->wakeup_)
+    {
+        armWakeup(button.pin, level);
+    }
+
+    // Ignore contact bounce right after an accepted edge, and edges that do
+    // not change the state the button was last seen in
+    if (now - button.last_edge_us < DEBOUNCE_US)
+    {
+        return false;
+    }
+    bool pressed = level == LOW;
+    if (pressed == button.pressed)
+    {
+        return false;
+    }
+
+    button.pressed = pressed;
+    button.last_edge_us = now;
+
+    // All button interrupts are serviced on the core that attached them and
+    // do not nest, so they act as the single producer of the queue
+    button_event event = {button.pin, pressed, now};
+    if (!button.owner->events_.push(event))
+    {
+        button.owner->dropped_events_ = button.owner->dropped_events_ + 1;
+        return false;
+    }
+    return true;
+}
+
+
+void IRAM_ATTR ButtonInput::armWakeup(uint8_t pin, int level)
+{
+    // The driver's gpio_wakeup_enable() is not safe to call from an interrupt,
+    // so the register is written directly
+    gpio_ll_wakeup_enable(&GPIO, (gpio_num_t)pin,
+                          level == HIGH ? GPIO_INTR_LOW_LEVEL
+                                        : GPIO_INTR_HIGH_LEVEL);
+}
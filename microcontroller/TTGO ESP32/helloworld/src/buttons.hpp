@@ -0,0 +1,118 @@
+#ifndef HELLOWORLD_BUTTONS_HPP
+#define HELLOWORLD_BUTTONS_HPP
+
+
+#include <Arduino.h>
+
+#include "ring_buffer.hpp"
+
+
+/**
+ * Captures presses and releases of active-low push buttons with GPIO edge
+ * interrupts. Each debounced edge is timestamped in the interrupt handler and
+ * queued, so the main loop can handle the edges later without losing presses
+ * or timing accuracy while it is busy.
+ */
+class ButtonInput
+{
+public:
+    /**
+     * A debounced change of a button's state.
+     */
+    struct button_event {
+        uint8_t pin;
+        bool pressed;
+        uint32_t time_us; // micros() when the edge occurred
+    };
+
+    /**
+     * The most buttons that can be attached.
+     */
+    static const size_t MAX_BUTTONS = 4;
+
+    /**
+     * Edges that follow an accepted edge of the same button within this many
+     * microseconds are contact bounce and are ignored.
+     */
+    static const uint32_t DEBOUNCE_US = 10000;
+
+    ButtonInput();
+
+    /**
+     * Starts capturing edges of the button on the pin. The pin must already be
+     * configured as an input. Returns false if MAX_BUTTONS are attached.
+     */
+    bool attach(uint8_t pin);
+
+    /**
+     * Notifies the task from the interrupt handler whenever an event is
+     * queued, so a task blocked in ulTaskNotifyTake() wakes up for it.
+     */
+    void setWakeTask(TaskHandle_t task) noexcept;
+
+    /**
+     * Lets the buttons wake the CPU from light sleep. Edge interrupts do not
+     * fire in light sleep, and a wakeup level replaces the edge interrupt of
+     * the pin, so each pin is armed for the level opposite to the one it was
+     * last read at and re-armed every time it is read. The interrupt then
+     * fires once on every change, pressed or released, and not again while
+     * the button is held. Call after attaching the buttons, on their core.
+     */
+    void enableWakeup();
+
+    /**
+     * Queues an event for every button whose level no longer matches its last
+     * accepted edge. Edge interrupts do not fire while the CPU is in light
+     * sleep, so a press that woke the CPU is only seen this way. Must be
+     * called on the core that attached the buttons.
+     */
+    void resync();
+
+    /**
+     * Removes the oldest queued event and stores it in the event. Returns false
+     * if there are no events.
+     */
+    bool poll(button_event& event);
+
+    /**
+     * Returns true if the button on the pin was down as of the last accepted
+     * edge.
+     */
+    bool isPressed(uint8_t pin) const;
+
+    /**
+     * Returns the number of events dropped because the queue was full.
+     */
+    unsigned long getDroppedEvents() const;
+
+private:
+    struct button_state {
+        ButtonInput* owner;
+        uint8_t pin;
+        volatile bool pressed;
+        volatile uint32_t last_edge_us;
+    };
+
+    static void IRAM_ATTR handleEdge(void* arg);
+
+    /**
+     * Accepts the current level of the button as an edge unless it is bounce
+     * or unchanged. Returns true if an event was queued.
+     */
+    static bool IRAM_ATTR updateButton(button_state& button);
+
+    /**
+     * Arms the pin to interrupt, and wake the CPU, when it leaves the level.
+     */
+    static void IRAM_ATTR armWakeup(uint8_t pin, int level);
+
+    button_state buttons_[MAX_BUTTONS];
+    size_t button_count_;
+    TaskHandle_t wake_task_;
+    volatile bool wakeup_;
+    RingBuffer<button_event, 32> events_;
+    volatile unsigned long dropped_events_;
+};
+
+
+#endif
@@ -0,0 +1,219 @@
+#include "dictionary.hpp"
+
+#include <string.h>
+
+
+static const uint8_t MAGIC[] = {'M', 'D', 'I', 'C'};
+static const uint8_t VERSION = 1;
+static const size_t HEADER_SIZE = 8;
+static const size_t NODE_SIZE = 3;
+static const size_t CHILD_SIZE = 4;
+static const uint8_t TERMINAL_FLAG = 0x80;
+static const uint8_t CHILDREN_MASK = 0x3F;
+static const uint8_t NO_CHILD = 0xFF;
+
+
+/**
+ * Returns the big-endian u24 at the data.
+ */
+static uint32_t readU24(const uint8_t* data)
+{
+    return ((uint32_t)data[0] << 16) | ((uint32_t)data[1] << 8) | data[2];
+}
+
+/**
+ * Words are stored in upper case, as the Morse decoder writes them.
+ */
+static char toUpper(char letter)
+{
+    return (letter >= 'a' && letter <= 'z') ? letter - 'a' + 'A' : letter;
+}
+
+
+Dictionary::Dictionary(const uint8_t* image, size_t size)
+    : image_(image), size_(size), root_(0), letters_(), nodes_(), depth_(0),
+      matched_(0), overflow_(0)
+{
+    if (size_ >= HEADER_SIZE && memcmp(image_, MAGIC, sizeof(MAGIC)) == 0 &&
+        image_[4] == VERSION)
+    {
+        root_ = readU24(image_ + 5);
+    }
+    nodes_[0] = root_;
+}
+
+
+bool Dictionary::isValid() const noexcept
+{
+    trie_node node;
+    return root_ != 0 && readNode(root_, node);
+}
+
+
+void Dictionary::reset() noexcept
+{
+    depth_ = 0;
+    matched_ = 0;
+    overflow_ = 0;
+}
+
+
+bool Dictionary::push(char letter) noexcept
+{
+    if (depth_ == MAX_DEPTH)
+    {
+        overflow_++;
+        return false;
+    }
+
+    letter = toUpper(letter);
+    letters_[depth_] = letter;
+    if (matched_ == depth_ && root_ != 0)
+    {
+        uint32_t child = findChild(nodes_[depth_], letter);
+        if (child != 0)
+        {
+            nodes_[depth_ + 1] = child;
+            matched_++;
+        }
+    }
+    depth_++;
+    return overflow_ == 0 && matched_ == depth_;
+}
+
+
+void Dictionary::pop() noexcept
+{
+    if (overflow_ > 0)
+    {
+        overflow_--;
+        return;
+    }
+    if (depth_ > 0)
+    {
+        depth_--;
+    }
+    if (matched_ > depth_)
+    {
+        matched_ = depth_;
+    }
+}
+
+
+bool Dictionary::setPrefix(const char* prefix, size_t length) noexcept
+{
+    // Letters beyond MAX_DEPTH are not kept, so they cannot be compared
+    size_t common = 0;
+    while (common < depth_ && common < length &&
+           letters_[common] == toUpper(prefix[common]))
+    {
+        common++;
+    }
+    if (common == depth_ && common == length && overflow_ == 0)
+    {
+        return false;
+    }
+    if (common == depth_ && overflow_ > 0)
+    {
+        common = 0;
+    }
+
+    overflow_ = 0;
+    while (depth_ > common)
+    {
+        pop();
+    }
+    for (size_t i = common; i < length; i++)
+    {
+        push(prefix[i]);
+    }
+    return true;
+}
+
+
+size_t Dictionary::getCompletion(char* completion, size_t size) const noexcept
+{
+    if (size == 0)
+    {
+        return 0;
+    }
+    completion[0] = '\0';
+    if (depth_ == 0 || overflow_ > 0 || matched_ < depth_)
+    {
+        return 0;
+    }
+
+    // Each node names the child on the way to its best word, so the
+    // completion is a walk down those children
+    size_t length = 0;
+    uint32_t offset = nodes_[depth_];
+    trie_node node;
+    while (length + 1 < size && readNode(offset, node) &&
+           node.best_child != NO_CHILD)
+    {
+        char letter;
+        offset = getChild(offset, node.best_child, letter);
+        if (offset == 0)
+        {
+            break;
+        }
+        completion[length++] = letter;
+    }
+    completion[length] = '\0';
+    return length;
+}
+
+
+bool Dictionary::readNode(uint32_t offset, trie_node& node) const noexcept
+{
+    if (offset < HEADER_SIZE || offset + NODE_SIZE > size_)
+    {
+        return false;
+    }
+    const uint8_t* data = image_ + offset;
+    node.terminal = (data[0] & TERMINAL_FLAG) != 0;
+    node.children = data[0] & CHILDREN_MASK;
+    node.weight = data[1];
+    node.best_child = data[2];
+    return offset + NODE_SIZE + node.children * CHILD_SIZE <= size_;
+}
+
+
+uint32_t Dictionary::findChild(uint32_t offset, char letter) const noexcept
+{
+    trie_node node;
+    if (!readNode(offset, node))
+    {
+        return 0;
+    }
+
+    // Children are sorted by letter, and few enough to scan
+    const uint8_t* child = image_ + offset + NODE_SIZE;
+    for (uint8_t i = 0; i < node.children; i++, child += CHILD_SIZE)
+    {
+        if ((char)child[0] == letter)
+        {
+            return readU24(child + 1);
+        }
+        if ((char)child[0] > letter)
+        {
+            break;
+        }
+    }
+    return 0;
+}
+
+
+uint32_t Dictionary::getChild(uint32_t offset,
+                              uint8_t index,
+                              char& letter) const noexcept
+{
+    trie_node node;
+    if (!readNode(offset, node) || index >= node.children)
+    {
+        return 0;
+    }
+    const uint8_t* child = image_ + offset + NODE_SIZE + index * CHILD_SIZE;
+    letter = (char)child[0];
+    return readU24(child + 1);
+}
@@ -0,0 +1,111 @@
+#ifndef HELLOWORLD_DICTIONARY_HPP
+#define HELLOWORLD_DICTIONARY_HPP
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * Offers the most likely completion of the word being composed, from a trie
+ * image that stays in flash. The dictionary follows the word one letter at a
+ * time, so each new letter costs a single step down the trie, and it keeps
+ * only the path it has followed; nothing is allocated.
+ *
+ * The image starts with the magic "MDIC", a u8 version and the u24 offset of
+ * the root node. Each node is:
+ *
+ *     u8 flags          bit 7 set if a word ends at the node, bits 0-5 the
+ *                       number of children
+ *     u8 weight         how likely the best word below the node is, 1-255
+ *     u8 best child     index of the child leading to the best word, or 0xFF
+ *                       if it is the word ending at the node
+ *     children          u8 letter and u24 offset of each child, by letter
+ *
+ * Integers are big-endian. Identical subtrees are stored once, which makes
+ * the image a DAWG as far as the weights allow.
+ */
+class Dictionary
+{
+public:
+    /**
+     * The longest prefix that is followed. Longer words get no completion.
+     */
+    static const size_t MAX_DEPTH = 24;
+
+    /**
+     * Uses the image, which must outlive the dictionary. An image that is not
+     * valid is treated as empty.
+     */
+    Dictionary(const uint8_t* image, size_t size);
+
+    /**
+     * Returns true if the image is a dictionary of the supported version.
+     */
+    bool isValid() const noexcept;
+
+    /**
+     * Forgets the prefix followed so far.
+     */
+    void reset() noexcept;
+
+    /**
+     * Extends the prefix by the letter. Returns true if some word still
+     * starts with the prefix.
+     */
+    bool push(char letter) noexcept;
+
+    /**
+     * Removes the last letter of the prefix.
+     */
+    void pop() noexcept;
+
+    /**
+     * Follows the prefix, stepping back only to where it differs from the
+     * one followed so far. Adding or removing a letter at the end therefore
+     * costs a single step. Returns true if the prefix changed.
+     */
+    bool setPrefix(const char* prefix, size_t length) noexcept;
+
+    /**
+     * Writes the letters that complete the prefix into the most likely word,
+     * null-terminated. Returns their number, which is 0 if the prefix is
+     * empty, is already the most likely word, or starts no word; the buffer
+     * is empty then. The completion is cut short if it does not fit.
+     */
+    size_t getCompletion(char* completion, size_t size) const noexcept;
+
+private:
+    struct trie_node {
+        bool terminal;
+        uint8_t children;
+        uint8_t weight;
+        uint8_t best_child;
+    };
+
+    /**
+     * Reads the node at the offset. Returns false if it lies outside of the
+     * image.
+     */
+    bool readNode(uint32_t offset, trie_node& node) const noexcept;
+
+    /**
+     * Returns the offset of the child of the node at the offset reached by
+     * the letter or, with the index, the index-th child. Returns 0 if there is
+     * none, as no node lies inside the header.
+     */
+    uint32_t findChild(uint32_t offset, char letter) const noexcept;
+    uint32_t getChild(uint32_t offset, uint8_t index, char& letter) const noexcept;
+
+    const uint8_t* image_;
+    size_t size_;
+    uint32_t root_;
+    char letters_[MAX_DEPTH];
+    uint32_t nodes_[MAX_DEPTH + 1];
+    size_t depth_;    // letters of the prefix, at most MAX_DEPTH
+    size_t matched_;  // leading letters that were found in the trie
+    size_t overflow_; // letters beyond MAX_DEPTH
+};
+
+
+#endif
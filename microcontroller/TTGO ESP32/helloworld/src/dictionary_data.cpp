@@ -0,0 +1,775 @@
+// Generated by tools/build_dictionary.py, do not edit.
+
+#include "dictionary_data.hpp"
+
+
+// 513 words
+const uint8_t DICTIONARY_IMAGE[] = {
+    0x4D, 0x44, 0x49, 0x43, 0x01, 0x00, 0x23, 0x70, 0x80, 0x02, 0xFF, 0x01,
+    0x02, 0x00, 0x33, 0x00, 0x00, 0x08, 0x01, 0x02, 0x00, 0x38, 0x00, 0x00,
+    0x08, 0x80, 0x29, 0xFF, 0x01, 0x29, 0x00, 0x45, 0x00, 0x00, 0x19, 0x80,
+    0xEA, 0xFF, 0x01, 0xEA, 0x00, 0x54, 0x00, 0x00, 0x23, 0x80, 0x3E, 0xFF,
+    0x01, 0x3E, 0x00, 0x45, 0x00, 0x00, 0x2D, 0x02, 0xEA, 0x00, 0x55, 0x00,
+    0x00, 0x26, 0x56, 0x00, 0x00, 0x30, 0x02, 0xEA, 0x01, 0x4C, 0x00, 0x00,
+    0x1C, 0x4F, 0x00, 0x00, 0x37, 0x80, 0x80, 0xFF, 0x01, 0x80, 0x00, 0x4E,
+    0x00, 0x00, 0x4D, 0x80, 0x76, 0xFF, 0x01, 0x76, 0x00, 0x59, 0x00, 0x00,
+    0x57, 0x01, 0x76, 0x00, 0x54, 0x00, 0x00, 0x5A, 0x01, 0x76, 0x00, 0x49,
+    0x00, 0x00, 0x61, 0x02, 0x80, 0x00, 0x4F, 0x00, 0x00, 0x50, 0x56, 0x00,
+    0x00, 0x68, 0x01, 0x80, 0x00, 0x49, 0x00, 0x00, 0x6F, 0x01, 0x80, 0x00,
+    0x54, 0x00, 0x00, 0x7A, 0x80, 0x13, 0xFF, 0x01, 0x13, 0x00, 0x44, 0x00,
+    0x00, 0x88, 0x80, 0xD7, 0xFF, 0x01, 0xD7, 0x00, 0x52, 0x00, 0x00, 0x92,
+    0x01, 0xD7, 0x00, 0x45, 0x00, 0x00, 0x95, 0x01, 0xD7, 0x00, 0x54, 0x00,
+    0x00, 0x9C, 0x80, 0x49, 0xFF, 0x01, 0x49, 0x00, 0x4E, 0x00, 0x00, 0xAA,
+    0x01, 0x49, 0x00, 0x49, 0x00, 0x00, 0xAD, 0x80, 0x95, 0xFF, 0x02, 0x95,
+    0x01, 0x41, 0x00, 0x00, 0xB4, 0x45, 0x00, 0x00, 0xBB, 0x80, 0x98, 0xFF,
+    0x01, 0x98, 0x00, 0x52, 0x00, 0x00, 0xC9, 0x01, 0x13, 0x00, 0x57, 0x00,
+    0x00, 0x88, 0x81, 0xEE, 0xFF, 0x4F, 0x00, 0x00, 0xD3, 0x80, 0x44, 0xFF,
+    0x01, 0x44, 0x00, 0x54, 0x00, 0x00, 0xE1, 0x01, 0x44, 0x00, 0x53, 0x00,
+    0x00, 0xE4, 0x01, 0x44, 0x00, 0x4F, 0x00, 0x00, 0xEB, 0x80, 0x43, 0xFF,
+    0x01, 0x43, 0x00, 0x45, 0x00, 0x00, 0xF9, 0x01, 0x43, 0x00, 0x4E, 0x00,
+    0x00, 0xFC, 0x80, 0x45, 0xFF, 0x01, 0x45, 0x00, 0x59, 0x00, 0x01, 0x0A,
+    0x01, 0x45, 0x00, 0x44, 0x00, 0x01, 0x0D, 0x01, 0x45, 0x00, 0x41, 0x00,
+    0x01, 0x14, 0x01, 0x45, 0x00, 0x45, 0x00, 0x01, 0x1B, 0x80, 0xD8, 0xFF,
+    0x01, 0xD8, 0x00, 0x4F, 0x00, 0x01, 0x29, 0x01, 0x49, 0x00, 0x53, 0x00,
+    0x00, 0xAA, 0x01, 0x49, 0x00, 0x59, 0x00, 0x01, 0x33, 0x01, 0x49, 0x00,
+    0x41, 0x00, 0x01, 0x3A, 0x06, 0xEE, 0x00, 0x4C, 0x00, 0x00, 0xDA, 0x4D,
+    0x00, 0x00, 0xF2, 0x4F, 0x00, 0x01, 0x03, 0x52, 0x00, 0x01, 0x22, 0x53,
+    0x00, 0x01, 0x2C, 0x57, 0x00, 0x01, 0x41, 0x80, 0xFE, 0xFF, 0x80, 0x2A,
+    0xFF, 0x01, 0x2A, 0x00, 0x52, 0x00, 0x01, 0x66, 0x01, 0x2A, 0x00, 0x45,
+    0x00, 0x01, 0x69, 0x01, 0x2A, 0x00, 0x48, 0x00, 0x01, 0x70, 0x01, 0x2A,
+    0x00, 0x54, 0x00, 0x01, 0x77, 0x80, 0x38, 0xFF, 0x01, 0x38, 0x00, 0x45,
+    0x00, 0x01, 0x85, 0x01, 0x38, 0x00, 0x4E, 0x00, 0x01, 0x88, 0x80, 0x37,
+    0xFF, 0x01, 0x37, 0x00, 0x47, 0x00, 0x01, 0x96, 0x01, 0x37, 0x00, 0x4E,
+    0x00, 0x01, 0x99, 0x01, 0x37, 0x00, 0x49, 0x00, 0x01, 0xA0, 0x01, 0x37,
+    0x00, 0x48, 0x00, 0x01, 0xA7, 0x82, 0xD1, 0xFF, 0x4F, 0x00, 0x01, 0x8F,
+    0x54, 0x00, 0x01, 0xAE, 0x83, 0xFE, 0x00, 0x44, 0x00, 0x01, 0x63, 0x4F,
+    0x00, 0x01, 0x7E, 0x59, 0x00, 0x01, 0xB5, 0x80, 0x0F, 0xFF, 0x01, 0x0F,
+    0x00, 0x52, 0x00, 0x01, 0xCF, 0x01, 0x0F, 0x00, 0x41, 0x00, 0x01, 0xD2,
+    0x01, 0x0F, 0x00, 0x45, 0x00, 0x01, 0xD9, 0x01, 0x0F, 0x00, 0x50, 0x00,
+    0x01, 0xE0, 0x80, 0xB6, 0xFF, 0x81, 0xCD, 0xFF, 0x41, 0x00, 0x01, 0xEE,
+    0x80, 0x82, 0xFF, 0x80, 0x42, 0xFF, 0x01, 0x42, 0x00, 0x44, 0x00, 0x01,
+    0xFB, 0x01, 0x42, 0x00, 0x4E, 0x00, 0x01, 0xFE, 0x01, 0x42, 0x00, 0x55,
+    0x00, 0x02, 0x05, 0x80, 0x9E, 0xFF, 0x04, 0xCD, 0x00, 0x45, 0x00, 0x01,
+    0xF1, 0x4D, 0x00, 0x01, 0xF8, 0x4F, 0x00, 0x02, 0x0C, 0x54, 0x00, 0x02,
+    0x13, 0x80, 0x21, 0xFF, 0x81, 0xF8, 0xFF, 0x4B, 0x00, 0x02, 0x29, 0x80,
+    0x65, 0xFF, 0x01, 0x65, 0x00, 0x4E, 0x00, 0x02, 0x33, 0x01, 0x65, 0x00,
+    0x4F, 0x00, 0x02, 0x36, 0x01, 0x65, 0x00, 0x49, 0x00, 0x02, 0x3D, 0x01,
+    0x65, 0x00, 0x54, 0x00, 0x02, 0x44, 0x01, 0x65, 0x00, 0x4E, 0x00, 0x02,
+    0x4B, 0x01, 0x65, 0x00, 0x45, 0x00, 0x02, 0x52, 0x81, 0xF6, 0xFF, 0x54,
+    0x00, 0x02, 0x59, 0x8C, 0xFE, 0x07, 0x42, 0x00, 0x00, 0x42, 0x43, 0x00,
+    0x00, 0x81, 0x44, 0x00, 0x00, 0x8B, 0x46, 0x00, 0x00, 0xA3, 0x47, 0x00,
+    0x00, 0xBE, 0x49, 0x00, 0x00, 0xCC, 0x4C, 0x00, 0x01, 0x48, 0x4E, 0x00,
+    0x01, 0xC0, 0x50, 0x00, 0x01, 0xE7, 0x52, 0x00, 0x02, 0x16, 0x53, 0x00,
+    0x02, 0x2C, 0x54, 0x00, 0x02, 0x60, 0x80, 0x67, 0xFF, 0x01, 0x67, 0x00,
+    0x59, 0x00, 0x02, 0x9A, 0x01, 0xD8, 0x00, 0x4B, 0x00, 0x01, 0x29, 0x03,
+    0xD8, 0x01, 0x42, 0x00, 0x02, 0x9D, 0x43, 0x00, 0x02, 0xA4, 0x44, 0x00,
+    0x00, 0x19, 0x80, 0xD1, 0xFF, 0x01, 0xD1, 0x00, 0x45, 0x00, 0x02, 0xBA,
+    0x01, 0xD1, 0x00, 0x53, 0x00, 0x02, 0xBD, 0x01, 0xD1, 0x00, 0x55, 0x00,
+    0x02, 0xC4, 0x01, 0x21, 0x00, 0x45, 0x00, 0x02, 0x29, 0x01, 0x21, 0x00,
+    0x4D, 0x00, 0x02, 0xD2, 0x02, 0xD1, 0x00, 0x41, 0x00, 0x02, 0xCB, 0x4F,
+    0x00, 0x02, 0xD9, 0x80, 0xCB, 0xFF, 0x01, 0xCB, 0x00, 0x4E, 0x00, 0x02,
+    0xEB, 0x01, 0x42, 0x00, 0x45, 0x00, 0x01, 0xFB, 0x01, 0x42, 0x00, 0x52,
+    0x00, 0x02, 0xF5, 0x01, 0x42, 0x00, 0x4F, 0x00, 0x02, 0xFC, 0x80, 0x26,
+    0xFF, 0x01, 0x26, 0x00, 0x4E, 0x00, 0x03, 0x0A, 0x01, 0x26, 0x00, 0x49,
+    0x00, 0x03, 0x0D, 0x01, 0x3E, 0x00, 0x44, 0x00, 0x00, 0x2D, 0x01, 0x3E,
+    0x00, 0x4E, 0x00, 0x03, 0x1B, 0x01, 0x3E, 0x00, 0x49, 0x00, 0x03, 0x22,
+    0x80, 0x1E, 0xFF, 0x01, 0x1E, 0x00, 0x45, 0x00, 0x03, 0x30, 0x01, 0x1E,
+    0x00, 0x56, 0x00, 0x03, 0x33, 0x01, 0x1E, 0x00, 0x45, 0x00, 0x03, 0x3A,
+    0x01, 0x1E, 0x00, 0x49, 0x00, 0x03, 0x41, 0x80, 0x33, 0xFF, 0x01, 0x33,
+    0x00, 0x54, 0x00, 0x03, 0x4F, 0x01, 0x33, 0x00, 0x52, 0x00, 0x03, 0x4F,
+    0x01, 0x33, 0x00, 0x45, 0x00, 0x03, 0x59, 0x80, 0x3F, 0xFF, 0x01, 0x3F,
+    0x00, 0x4E, 0x00, 0x03, 0x67, 0x01, 0x3F, 0x00, 0x45, 0x00, 0x03, 0x6A,
+    0x01, 0x3F, 0x00, 0x45, 0x00, 0x03, 0x71, 0x02, 0x3F, 0x01, 0x54, 0x00,
+    0x03, 0x60, 0x57, 0x00, 0x03, 0x78, 0x88, 0xFF, 0xFF, 0x43, 0x00, 0x02,
+    0xE0, 0x45, 0x00, 0x02, 0xEE, 0x46, 0x00, 0x03, 0x03, 0x47, 0x00, 0x03,
+    0x14, 0x48, 0x00, 0x03, 0x29, 0x4C, 0x00, 0x03, 0x48, 0x53, 0x00, 0x03,
+    0x52, 0x54, 0x00, 0x03, 0x7F, 0x80, 0x31, 0xFF, 0x01, 0x31, 0x00, 0x47,
+    0x00, 0x03, 0xAD, 0x80, 0xA3, 0xFF, 0x01, 0xA3, 0x00, 0x59, 0x00, 0x03,
+    0xB7, 0x80, 0xB2, 0xFF, 0x01, 0xB2, 0x00, 0x4B, 0x00, 0x03, 0xC1, 0x80,
+    0x3B, 0xFF, 0x01, 0x3B, 0x00, 0x4D, 0x00, 0x03, 0xCB, 0x01, 0x3B, 0x00,
+    0x4F, 0x00, 0x03, 0xCE, 0x01, 0x3B, 0x00, 0x54, 0x00, 0x03, 0xD5, 0x80,
+    0x96, 0xFF, 0x04, 0xB2, 0x01, 0x44, 0x00, 0x03, 0xBA, 0x4F, 0x00, 0x03,
+    0xC4, 0x54, 0x00, 0x03, 0xDC, 0x59, 0x00, 0x03, 0xE3, 0x80, 0x4E, 0xFF,
+    0x01, 0x4E, 0x00, 0x54, 0x00, 0x03, 0xF9, 0x01, 0x4E, 0x00, 0x53, 0x00,
+    0x03, 0xFC, 0x01, 0x4E, 0x00, 0x41, 0x00, 0x04, 0x03, 0x01, 0x4E, 0x00,
+    0x46, 0x00, 0x04, 0x0A, 0x01, 0x4E, 0x00, 0x4B, 0x00, 0x04, 0x11, 0x01,
+    0x4E, 0x00, 0x41, 0x00, 0x04, 0x18, 0x80, 0x1D, 0xFF, 0x01, 0x1D, 0x00,
+    0x47, 0x00, 0x04, 0x26, 0x01, 0x1D, 0x00, 0x4E, 0x00, 0x04, 0x29, 0x02,
+    0x4E, 0x00, 0x45, 0x00, 0x04, 0x1F, 0x49, 0x00, 0x04, 0x30, 0x01, 0x80,
+    0x00, 0x47, 0x00, 0x00, 0x4D, 0x01, 0x80, 0x00, 0x4E, 0x00, 0x04, 0x42,
+    0x81, 0x80, 0x00, 0x49, 0x00, 0x04, 0x49, 0x01, 0x80, 0x00, 0x44, 0x00,
+    0x04, 0x50, 0x01, 0x80, 0x00, 0x4C, 0x00, 0x04, 0x57, 0x80, 0xB0, 0xFF,
+    0x01, 0xB0, 0x00, 0x53, 0x00, 0x04, 0x65, 0x01, 0xB0, 0x00, 0x53, 0x00,
+    0x04, 0x68, 0x01, 0xB0, 0x00, 0x45, 0x00, 0x04, 0x6F, 0x01, 0xB0, 0x00,
+    0x4E, 0x00, 0x04, 0x76, 0x80, 0x52, 0xFF, 0x02, 0xB0, 0x00, 0x49, 0x00,
+    0x04, 0x7D, 0x59, 0x00, 0x04, 0x84, 0x80, 0xF5, 0xFF, 0x80, 0x0E, 0xFF,
+    0x04, 0xF5, 0x02, 0x49, 0x00, 0x04, 0x5E, 0x53, 0x00, 0x04, 0x87, 0x54,
+    0x00, 0x04, 0x92, 0x59, 0x00, 0x04, 0x95, 0x80, 0x5A, 0xFF, 0x81, 0xF4,
+    0xFF, 0x45, 0x00, 0x04, 0xAB, 0x07, 0xFF, 0x01, 0x41, 0x00, 0x02, 0xAB,
+    0x45, 0x00, 0x03, 0x8A, 0x49, 0x00, 0x03, 0xB0, 0x4F, 0x00, 0x03, 0xE6,
+    0x52, 0x00, 0x04, 0x37, 0x55, 0x00, 0x04, 0x98, 0x59, 0x00, 0x04, 0xAE,
+    0x80, 0x55, 0xFF, 0x01, 0x55, 0x00, 0x4C, 0x00, 0x04, 0xD4, 0x80, 0xC6,
+    0xFF, 0x01, 0xC6, 0x00, 0x45, 0x00, 0x04, 0xDE, 0x80, 0xE6, 0xFF, 0x80,
+    0x8D, 0xFF, 0x81, 0xA8, 0xFF, 0x45, 0x00, 0x04, 0xEB, 0x80, 0xBD, 0xFF,
+    0x01, 0xBD, 0x00, 0x45, 0x00, 0x04, 0xF5, 0x05, 0xE6, 0x02, 0x4C, 0x00,
+    0x04, 0xD7, 0x4D, 0x00, 0x04, 0xE1, 0x4E, 0x00, 0x04, 0xE8, 0x52, 0x00,
+    0x04, 0xEE, 0x53, 0x00, 0x04, 0xF8, 0x80, 0x78, 0xFF, 0x01, 0x78, 0x00,
+    0x52, 0x00, 0x05, 0x16, 0x01, 0x78, 0x00, 0x45, 0x00, 0x05, 0x19, 0x01,
+    0x78, 0x00, 0x54, 0x00, 0x05, 0x20, 0x01, 0x78, 0x00, 0x4E, 0x00, 0x05,
+    0x27, 0x80, 0x9C, 0xFF, 0x01, 0x9C, 0x00, 0x45, 0x00, 0x05, 0x35, 0x01,
+    0x9C, 0x00, 0x47, 0x00, 0x05, 0x38, 0x01, 0x9C, 0x00, 0x4E, 0x00, 0x05,
+    0x3F, 0x80, 0xC0, 0xFF, 0x01, 0xC0, 0x00, 0x44, 0x00, 0x05, 0x4D, 0x01,
+    0xC0, 0x00, 0x4C, 0x00, 0x05, 0x50, 0x02, 0xC0, 0x01, 0x41, 0x00, 0x05,
+    0x46, 0x49, 0x00, 0x05, 0x57, 0x80, 0xA7, 0xFF, 0x01, 0xA7, 0x00, 0x59,
+    0x00, 0x05, 0x69, 0x01, 0xA7, 0x00, 0x54, 0x00, 0x05, 0x6C, 0x80, 0x8E,
+    0xFF, 0x01, 0x8E, 0x00, 0x53, 0x00, 0x05, 0x7A, 0x01, 0x8E, 0x00, 0x53,
+    0x00, 0x05, 0x7D, 0x80, 0x27, 0xFF, 0x01, 0x27, 0x00, 0x45, 0x00, 0x05,
+    0x8B, 0x01, 0x27, 0x00, 0x53, 0x00, 0x05, 0x8E, 0x02, 0x8E, 0x00, 0x41,
+    0x00, 0x05, 0x84, 0x4F, 0x00, 0x05, 0x95, 0x80, 0x4D, 0xFF, 0x01, 0x4D,
+    0x00, 0x45, 0x00, 0x05, 0xA7, 0x01, 0x4D, 0x00, 0x45, 0x00, 0x05, 0xAA,
+    0x01, 0x4D, 0x00, 0x46, 0x00, 0x05, 0xB1, 0x80, 0x91, 0xFF, 0x01, 0x91,
+    0x00, 0x45, 0x00, 0x05, 0xBF, 0x01, 0x91, 0x00, 0x47, 0x00, 0x05, 0xC2,
+    0x01, 0x91, 0x00, 0x45, 0x00, 0x05, 0xC9, 0x01, 0x91, 0x00, 0x4C, 0x00,
+    0x05, 0xD0, 0x80, 0xDA, 0xFF, 0x01, 0xA7, 0x00, 0x49, 0x00, 0x05, 0x73,
+    0x01, 0xA7, 0x00, 0x4E, 0x00, 0x05, 0xE1, 0x01, 0xA7, 0x00, 0x55, 0x00,
+    0x05, 0xE8, 0x80, 0xBC, 0xFF, 0x01, 0xBC, 0x00, 0x59, 0x00, 0x05, 0xF6,
+    0x01, 0xBC, 0x00, 0x4E, 0x00, 0x05, 0xF9, 0x80, 0x66, 0xFF, 0x01, 0x66,
+    0x00, 0x52, 0x00, 0x06, 0x07, 0x01, 0x66, 0x00, 0x45, 0x00, 0x06, 0x0A,
+    0x01, 0x66, 0x00, 0x54, 0x00, 0x06, 0x11, 0x02, 0xBC, 0x00, 0x41, 0x00,
+    0x06, 0x00, 0x55, 0x00, 0x06, 0x18, 0x03, 0xDA, 0x00, 0x45, 0x00, 0x05,
+    0xDE, 0x4D, 0x00, 0x05, 0xEF, 0x50, 0x00, 0x06, 0x1F, 0x01, 0x0F, 0x00,
+    0x45, 0x00, 0x01, 0xD2, 0x01, 0x0F, 0x00, 0x44, 0x00, 0x06, 0x39, 0x01,
+    0x0F, 0x00, 0x49, 0x00, 0x06, 0x40, 0x80, 0x18, 0xFF, 0x01, 0x18, 0x00,
+    0x45, 0x00, 0x06, 0x4E, 0x01, 0x18, 0x00, 0x55, 0x00, 0x06, 0x51, 0x01,
+    0x18, 0x00, 0x4E, 0x00, 0x06, 0x58, 0x01, 0x8E, 0x00, 0x4C, 0x00, 0x05,
+    0x7A, 0x01, 0x8E, 0x00, 0x4F, 0x00, 0x06, 0x66, 0x02, 0x8E, 0x01, 0x49,
+    0x00, 0x06, 0x5F, 0x52, 0x00, 0x06, 0x6D, 0x02, 0x8E, 0x01, 0x53, 0x00,
+    0x06, 0x47, 0x54, 0x00, 0x06, 0x74, 0x80, 0x4F, 0xFF, 0x01, 0x4F, 0x00,
+    0x4C, 0x00, 0x06, 0x8A, 0x80, 0x73, 0xFF, 0x01, 0x73, 0x00, 0x54, 0x00,
+    0x06, 0x94, 0x80, 0xDF, 0xFF, 0x01, 0xDF, 0x00, 0x44, 0x00, 0x06, 0x9E,
+    0x01, 0x78, 0x00, 0x45, 0x00, 0x05, 0x16, 0x01, 0x78, 0x00, 0x4C, 0x00,
+    0x06, 0xA8, 0x80, 0x74, 0xFF, 0x01, 0x74, 0x00, 0x54, 0x00, 0x06, 0xB6,
+    0x03, 0xDF, 0x00, 0x4C, 0x00, 0x06, 0xA1, 0x50, 0x00, 0x06, 0xAF, 0x52,
+    0x00, 0x06, 0xB9, 0x07, 0xDF, 0x06, 0x46, 0x00, 0x05, 0xB8, 0x4C, 0x00,
+    0x05, 0xD7, 0x4D, 0x00, 0x06, 0x2A, 0x4E, 0x00, 0x06, 0x7F, 0x4F, 0x00,
+    0x06, 0x8D, 0x53, 0x00, 0x06, 0x97, 0x55, 0x00, 0x06, 0xC0, 0x80, 0x05,
+    0xFF, 0x80, 0x15, 0xFF, 0x01, 0x15, 0x00, 0x45, 0x00, 0x06, 0xF1, 0x01,
+    0x15, 0x00, 0x54, 0x00, 0x06, 0xF4, 0x01, 0x15, 0x00, 0x41, 0x00, 0x06,
+    0xFB, 0x01, 0x15, 0x00, 0x45, 0x00, 0x07, 0x02, 0x80, 0x0B, 0xFF, 0x01,
+    0x0B, 0x00, 0x54, 0x00, 0x07, 0x10, 0x09, 0xE6, 0x00, 0x41, 0x00, 0x04,
+    0xFF, 0x45, 0x00, 0x05, 0x2E, 0x48, 0x00, 0x05, 0x5E, 0x49, 0x00, 0x05,
+    0x73, 0x4C, 0x00, 0x05, 0x9C, 0x4F, 0x00, 0x06, 0xCF, 0x51, 0x00, 0x06,
+    0xEE, 0x52, 0x00, 0x07, 0x09, 0x55, 0x00, 0x07, 0x13, 0x80, 0x70, 0xFF,
+    0x01, 0x70, 0x00, 0x41, 0x00, 0x07, 0x41, 0x80, 0xCF, 0xFF, 0x02, 0xCF,
+    0x01, 0x54, 0x00, 0x07, 0x44, 0x59, 0x00, 0x07, 0x4B, 0x80, 0x90, 0xFF,
+    0x01, 0x90, 0x00, 0x48, 0x00, 0x07, 0x59, 0x01, 0x90, 0x00, 0x54, 0x00,
+    0x07, 0x5C, 0x80, 0x06, 0xFF, 0x01, 0x06, 0x00, 0x45, 0x00, 0x07, 0x6A,
+    0x80, 0x85, 0xFF, 0x01, 0x85, 0x00, 0x4E, 0x00, 0x07, 0x74, 0x01, 0x85,
+    0x00, 0x4F, 0x00, 0x07, 0x77, 0x01, 0x85, 0x00, 0x49, 0x00, 0x07, 0x7E,
+    0x02, 0x85, 0x01, 0x44, 0x00, 0x07, 0x6D, 0x53, 0x00, 0x07, 0x85, 0x01,
+    0x85, 0x00, 0x49, 0x00, 0x07, 0x8C, 0x80, 0x8C, 0xFF, 0x01, 0x8C, 0x00,
+    0x54, 0x00, 0x07, 0x9E, 0x01, 0x8C, 0x00, 0x4E, 0x00, 0x07, 0xA1, 0x01,
+    0x8C, 0x00, 0x45, 0x00, 0x07, 0xA8, 0x01, 0x8C, 0x00, 0x4D, 0x00, 0x07,
+    0xAF, 0x01, 0x8C, 0x00, 0x50, 0x00, 0x07, 0xB6, 0x01, 0x8C, 0x00, 0x4F,
+    0x00, 0x07, 0xBD, 0x01, 0x8C, 0x00, 0x4C, 0x00, 0x07, 0xC4, 0x01, 0x8C,
+    0x00, 0x45, 0x00, 0x07, 0xCB, 0x83, 0x90, 0x00, 0x41, 0x00, 0x07, 0x63,
+    0x43, 0x00, 0x07, 0x97, 0x56, 0x00, 0x07, 0xD2, 0x80, 0xCA, 0xFF, 0x80,
+    0x0D, 0xFF, 0x80, 0x81, 0xFF, 0x01, 0x81, 0x00, 0x45, 0x00, 0x07, 0xEE,
+    0x80, 0x2B, 0xFF, 0x02, 0x81, 0x00, 0x43, 0x00, 0x07, 0xF1, 0x54, 0x00,
+    0x07, 0xF8, 0x01, 0x81, 0x00, 0x4E, 0x00, 0x07, 0xFB, 0x01, 0x81, 0x00,
+    0x45, 0x00, 0x08, 0x06, 0x01, 0x81, 0x00, 0x52, 0x00, 0x08, 0x0D, 0x01,
+    0x81, 0x00, 0x45, 0x00, 0x08, 0x14, 0x01, 0x81, 0x00, 0x46, 0x00, 0x08,
+    0x1B, 0x80, 0x60, 0xFF, 0x01, 0x60, 0x00, 0x52, 0x00, 0x08, 0x29, 0x01,
+    0x60, 0x00, 0x45, 0x00, 0x08, 0x2C, 0x01, 0x60, 0x00, 0x4E, 0x00, 0x08,
+    0x33, 0x80, 0x7E, 0xFF, 0x01, 0x7E, 0x00, 0x52, 0x00, 0x08, 0x41, 0x01,
+    0x7E, 0x00, 0x4F, 0x00, 0x08, 0x44, 0x01, 0x7E, 0x00, 0x54, 0x00, 0x08,
+    0x4B, 0x01, 0x7E, 0x00, 0x43, 0x00, 0x08, 0x52, 0x01, 0x7E, 0x00, 0x45,
+    0x00, 0x08, 0x59, 0x05, 0xCA, 0x00, 0x44, 0x00, 0x07, 0xE8, 0x45, 0x00,
+    0x07, 0xEB, 0x46, 0x00, 0x08, 0x22, 0x4E, 0x00, 0x08, 0x3A, 0x52, 0x00,
+    0x08, 0x60, 0x80, 0x6D, 0xFF, 0x01, 0x6D, 0x00, 0x52, 0x00, 0x08, 0x7E,
+    0x01, 0x6D, 0x00, 0x4F, 0x00, 0x08, 0x81, 0x01, 0x6D, 0x00, 0x54, 0x00,
+    0x08, 0x88, 0x80, 0xA0, 0xFF, 0x01, 0xA0, 0x00, 0x52, 0x00, 0x08, 0x96,
+    0x82, 0xF7, 0xFF, 0x43, 0x00, 0x08, 0x8F, 0x4F, 0x00, 0x08, 0x99, 0x80,
+    0x4C, 0xFF, 0x01, 0x4C, 0x00, 0x4B, 0x00, 0x08, 0xAB, 0x01, 0x4C, 0x00,
+    0x4E, 0x00, 0x08, 0xAE, 0x80, 0x8A, 0xFF, 0x01, 0x8A, 0x00, 0x47, 0x00,
+    0x08, 0xBC, 0x02, 0x8A, 0x01, 0x49, 0x00, 0x08, 0xB5, 0x55, 0x00, 0x08,
+    0xBF, 0x80, 0x41, 0xFF, 0x01, 0x41, 0x00, 0x47, 0x00, 0x08, 0xD1, 0x01,
+    0x41, 0x00, 0x4E, 0x00, 0x08, 0xD4, 0x01, 0x41, 0x00, 0x49, 0x00, 0x08,
+    0xDB, 0x01, 0x41, 0x00, 0x52, 0x00, 0x08, 0xE2, 0x06, 0xF7, 0x03, 0x41,
+    0x00, 0x07, 0x4E, 0x45, 0x00, 0x07, 0xD9, 0x49, 0x00, 0x08, 0x67, 0x4F,
+    0x00, 0x08, 0xA0, 0x52, 0x00, 0x08, 0xC6, 0x55, 0x00, 0x08, 0xE9, 0x80,
+    0x35, 0xFF, 0x01, 0x35, 0x00, 0x48, 0x00, 0x09, 0x0B, 0x80, 0x4A, 0xFF,
+    0x01, 0x4A, 0x00, 0x59, 0x00, 0x09, 0x15, 0x01, 0x4A, 0x00, 0x4C, 0x00,
+    0x09, 0x18, 0x03, 0x4C, 0x02, 0x43, 0x00, 0x09, 0x0E, 0x52, 0x00, 0x09,
+    0x1F, 0x54, 0x00, 0x08, 0xAB, 0x80, 0x97, 0xFF, 0x01, 0x97, 0x00, 0x4E,
+    0x00, 0x09, 0x35, 0x01, 0x97, 0x00, 0x4F, 0x00, 0x09, 0x38, 0x01, 0x97,
+    0x00, 0x49, 0x00, 0x09, 0x3F, 0x01, 0x97, 0x00, 0x54, 0x00, 0x09, 0x46,
+    0x01, 0x97, 0x00, 0x41, 0x00, 0x09, 0x4D, 0x01, 0x97, 0x00, 0x43, 0x00,
+    0x09, 0x54, 0x01, 0x97, 0x00, 0x55, 0x00, 0x09, 0x5B, 0x80, 0x8F, 0xFF,
+    0x01, 0x8F, 0x00, 0x54, 0x00, 0x09, 0x69, 0x01, 0x8F, 0x00, 0x43, 0x00,
+    0x09, 0x6C, 0x80, 0x8B, 0xFF, 0x01, 0x8B, 0x00, 0x54, 0x00, 0x09, 0x7A,
+    0x01, 0x8B, 0x00, 0x52, 0x00, 0x09, 0x7D, 0x02, 0x8F, 0x00, 0x45, 0x00,
+    0x09, 0x73, 0x4F, 0x00, 0x09, 0x84, 0x01, 0x8F, 0x00, 0x46, 0x00, 0x09,
+    0x8B, 0x80, 0xA9, 0xFF, 0x01, 0x44, 0x00, 0x48, 0x00, 0x00, 0xE1, 0x01,
+    0x44, 0x00, 0x47, 0x00, 0x09, 0xA0, 0x01, 0x44, 0x00, 0x55, 0x00, 0x09,
+    0xA7, 0x02, 0xA9, 0x00, 0x44, 0x00, 0x09, 0x9D, 0x4F, 0x00, 0x09, 0xAE,
+    0x80, 0x7A, 0xFF, 0x81, 0xD3, 0xFF, 0x54, 0x00, 0x09, 0xC0, 0x80, 0x39,
+    0xFF, 0x01, 0x39, 0x00, 0x45, 0x00, 0x09, 0xCA, 0x01, 0x39, 0x00, 0x4E,
+    0x00, 0x09, 0xCD, 0x80, 0x94, 0xFF, 0x01, 0x94, 0x00, 0x47, 0x00, 0x09,
+    0xDB, 0x01, 0x94, 0x00, 0x4E, 0x00, 0x09, 0xDE, 0x01, 0x94, 0x00, 0x49,
+    0x00, 0x09, 0xE5, 0x01, 0x94, 0x00, 0x48, 0x00, 0x09, 0xEC, 0x82, 0x94,
+    0x01, 0x4F, 0x00, 0x09, 0xD4, 0x54, 0x00, 0x09, 0xF3, 0x01, 0x94, 0x00,
+    0x59, 0x00, 0x09, 0xFA, 0x02, 0xD3, 0x00, 0x4E, 0x00, 0x09, 0xC3, 0x52,
+    0x00, 0x0A, 0x05, 0x80, 0x62, 0xFF, 0x01, 0x62, 0x00, 0x45, 0x00, 0x0A,
+    0x17, 0x01, 0x62, 0x00, 0x43, 0x00, 0x0A, 0x1A, 0x01, 0x62, 0x00, 0x4E,
+    0x00, 0x0A, 0x21, 0x01, 0x62, 0x00, 0x45, 0x00, 0x0A, 0x28, 0x01, 0x62,
+    0x00, 0x44, 0x00, 0x0A, 0x2F, 0x02, 0xD3, 0x00, 0x45, 0x00, 0x0A, 0x0C,
+    0x49, 0x00, 0x0A, 0x36, 0x01, 0x8F, 0x00, 0x45, 0x00, 0x09, 0x69, 0x01,
+    0x8F, 0x00, 0x43, 0x00, 0x0A, 0x48, 0x01, 0x8F, 0x00, 0x4E, 0x00, 0x0A,
+    0x4F, 0x01, 0x8F, 0x00, 0x45, 0x00, 0x0A, 0x56, 0x01, 0x8F, 0x00, 0x49,
+    0x00, 0x0A, 0x5D, 0x01, 0x8F, 0x00, 0x52, 0x00, 0x0A, 0x64, 0x01, 0x8F,
+    0x00, 0x45, 0x00, 0x0A, 0x6B, 0x01, 0x8F, 0x00, 0x50, 0x00, 0x0A, 0x72,
+    0x80, 0xB1, 0xFF, 0x01, 0xB1, 0x00, 0x45, 0x00, 0x0A, 0x80, 0x07, 0xD3,
+    0x04, 0x41, 0x00, 0x09, 0x26, 0x44, 0x00, 0x09, 0x62, 0x46, 0x00, 0x09,
+    0x96, 0x4E, 0x00, 0x09, 0xB5, 0x56, 0x00, 0x0A, 0x3D, 0x58, 0x00, 0x0A,
+    0x79, 0x59, 0x00, 0x0A, 0x83, 0x80, 0xA2, 0xFF, 0x80, 0xB4, 0xFF, 0x02,
+    0xB4, 0x01, 0x45, 0x00, 0x0A, 0xA9, 0x54, 0x00, 0x0A, 0xAC, 0x01, 0x0B,
+    0x00, 0x4C, 0x00, 0x07, 0x10, 0x80, 0x3D, 0xFF, 0x80, 0xAC, 0xFF, 0x01,
+    0xAC, 0x00, 0x52, 0x00, 0x0A, 0xC4, 0x01, 0xAC, 0x00, 0x45, 0x00, 0x0A,
+    0xC7, 0x01, 0xAC, 0x00, 0x48, 0x00, 0x0A, 0xCE, 0x04, 0xB4, 0x00, 0x43,
+    0x00, 0x0A, 0xAF, 0x4C, 0x00, 0x0A, 0xBA, 0x52, 0x00, 0x0A, 0xC1, 0x54,
+    0x00, 0x0A, 0xD5, 0x80, 0x23, 0xFF, 0x01, 0x23, 0x00, 0x4C, 0x00, 0x0A,
+    0xEF, 0x02, 0x35, 0x01, 0x45, 0x00, 0x0A, 0xF2, 0x57, 0x00, 0x09, 0x0B,
+    0x01, 0x8D, 0x00, 0x44, 0x00, 0x04, 0xEB, 0x01, 0x8D, 0x00, 0x4C, 0x00,
+    0x0B, 0x04, 0x80, 0x72, 0xFF, 0x01, 0x72, 0x00, 0x45, 0x00, 0x0B, 0x12,
+    0x01, 0x72, 0x00, 0x52, 0x00, 0x0B, 0x15, 0x01, 0x72, 0x00, 0x55, 0x00,
+    0x0B, 0x1C, 0x01, 0x65, 0x00, 0x4D, 0x00, 0x02, 0x33, 0x80, 0xC5, 0xFF,
+    0x80, 0x51, 0xFF, 0x80, 0x25, 0xFF, 0x01, 0x25, 0x00, 0x48, 0x00, 0x0B,
+    0x37, 0x01, 0x25, 0x00, 0x53, 0x00, 0x0B, 0x3A, 0x03, 0xC5, 0x00, 0x44,
+    0x00, 0x0B, 0x31, 0x45, 0x00, 0x0B, 0x34, 0x49, 0x00, 0x0B, 0x41, 0x80,
+    0xD4, 0xFF, 0x01, 0xD4, 0x00, 0x54, 0x00, 0x0B, 0x57, 0x01, 0xD4, 0x00,
+    0x53, 0x00, 0x0B, 0x5A, 0x05, 0xD4, 0x04, 0x45, 0x00, 0x0B, 0x0B, 0x47,
+    0x00, 0x0B, 0x23, 0x4C, 0x00, 0x0B, 0x2A, 0x4E, 0x00, 0x0B, 0x48, 0x52,
+    0x00, 0x0B, 0x61, 0x01, 0x15, 0x00, 0x57, 0x00, 0x06, 0xF1, 0x01, 0x15,
+    0x00, 0x4F, 0x00, 0x0B, 0x7F, 0x01, 0x15, 0x00, 0x4C, 0x00, 0x0B, 0x86,
+    0x02, 0x96, 0x01, 0x44, 0x00, 0x05, 0xA7, 0x54, 0x00, 0x03, 0xE3, 0x01,
+    0x97, 0x00, 0x45, 0x00, 0x09, 0x35, 0x82, 0xFA, 0xFF, 0x43, 0x00, 0x0B,
+    0x9F, 0x4D, 0x00, 0x09, 0xC0, 0x03, 0xFA, 0x02, 0x4C, 0x00, 0x0B, 0x8D,
+    0x4F, 0x00, 0x0B, 0x94, 0x52, 0x00, 0x0B, 0xA6, 0x80, 0x53, 0xFF, 0x01,
+    0x53, 0x00, 0x45, 0x00, 0x0B, 0xC0, 0x01, 0xAC, 0x00, 0x44, 0x00, 0x0A,
+    0xC4, 0x01, 0xAC, 0x00, 0x4E, 0x00, 0x0B, 0xCA, 0x01, 0xAC, 0x00, 0x45,
+    0x00, 0x0B, 0xD1, 0x80, 0xF4, 0xFF, 0x80, 0x3C, 0xFF, 0x01, 0x3C, 0x00,
+    0x54, 0x00, 0x0B, 0xE2, 0x02, 0xF4, 0x00, 0x4D, 0x00, 0x0B, 0xDF, 0x4E,
+    0x00, 0x0B, 0xE5, 0x03, 0xF4, 0x02, 0x45, 0x00, 0x0B, 0xC3, 0x49, 0x00,
+    0x0B, 0xD8, 0x4F, 0x00, 0x0B, 0xEC, 0x80, 0x28, 0xFF, 0x01, 0x28, 0x00,
+    0x4C, 0x00, 0x0C, 0x06, 0x02, 0x4F, 0x01, 0x4C, 0x00, 0x0C, 0x09, 0x4E,
+    0x00, 0x06, 0x8A, 0x06, 0xFA, 0x03, 0x41, 0x00, 0x0A, 0xDC, 0x45, 0x00,
+    0x0A, 0xF9, 0x49, 0x00, 0x0B, 0x68, 0x4F, 0x00, 0x0B, 0xB1, 0x52, 0x00,
+    0x0B, 0xF7, 0x55, 0x00, 0x0C, 0x10, 0x80, 0xAA, 0xFF, 0x01, 0xAA, 0x00,
+    0x45, 0x00, 0x0C, 0x36, 0x01, 0xAA, 0x00, 0x4D, 0x00, 0x0C, 0x39, 0x80,
+    0xE9, 0xFF, 0x01, 0xE9, 0x00, 0x54, 0x00, 0x0C, 0x47, 0x80, 0x9A, 0xFF,
+    0x01, 0x9A, 0x00, 0x4C, 0x00, 0x0C, 0x51, 0x80, 0xD0, 0xFF, 0x01, 0xD0,
+    0x00, 0x45, 0x00, 0x0C, 0x5B, 0x02, 0xD0, 0x01, 0x52, 0x00, 0x0C, 0x54,
+    0x56, 0x00, 0x0C, 0x5E, 0x80, 0x59, 0xFF, 0x01, 0x59, 0x00, 0x45, 0x00,
+    0x0C, 0x70, 0x01, 0x59, 0x00, 0x59, 0x00, 0x0C, 0x73, 0x81, 0xE0, 0xFF,
+    0x42, 0x00, 0x0C, 0x7A, 0x01, 0xE0, 0x00, 0x44, 0x00, 0x0C, 0x81, 0x80,
+    0xC9, 0xFF, 0x80, 0xBA, 0xFF, 0x01, 0xBA, 0x00, 0x54, 0x00, 0x0C, 0x92,
+    0x01, 0xBA, 0x00, 0x4E, 0x00, 0x0C, 0x95, 0x01, 0xBA, 0x00, 0x45, 0x00,
+    0x0C, 0x9C, 0x01, 0xBA, 0x00, 0x4D, 0x00, 0x0C, 0xA3, 0x01, 0xBA, 0x00,
+    0x4E, 0x00, 0x0C, 0xAA, 0x01, 0xBA, 0x00, 0x52, 0x00, 0x0C, 0xB1, 0x01,
+    0xBA, 0x00, 0x45, 0x00, 0x0C, 0xB8, 0x83, 0xE8, 0xFF, 0x4F, 0x00, 0x0C,
+    0x88, 0x54, 0x00, 0x0C, 0x8F, 0x56, 0x00, 0x0C, 0xBF, 0x80, 0x50, 0xFF,
+    0x01, 0x50, 0x00, 0x54, 0x00, 0x0C, 0xD5, 0x01, 0x50, 0x00, 0x41, 0x00,
+    0x0C, 0xD8, 0x80, 0x7B, 0xFF, 0x01, 0x7B, 0x00, 0x44, 0x00, 0x0C, 0xE6,
+    0x01, 0x7B, 0x00, 0x4E, 0x00, 0x0C, 0xE9, 0x80, 0x12, 0xFF, 0x02, 0x7B,
+    0x00, 0x55, 0x00, 0x0C, 0xF0, 0x57, 0x00, 0x0C, 0xF7, 0x02, 0x7B, 0x01,
+    0x45, 0x00, 0x0C, 0xDF, 0x4F, 0x00, 0x0C, 0xFA, 0x80, 0x99, 0xFF, 0x01,
+    0x99, 0x00, 0x59, 0x00, 0x0D, 0x10, 0x06, 0xE9, 0x01, 0x41, 0x00, 0x0C,
+    0x40, 0x45, 0x00, 0x0C, 0x4A, 0x49, 0x00, 0x0C, 0x65, 0x4F, 0x00, 0x0C,
+    0xC6, 0x52, 0x00, 0x0D, 0x05, 0x55, 0x00, 0x0D, 0x13, 0x80, 0x63, 0xFF,
+    0x01, 0x63, 0x00, 0x52, 0x00, 0x0D, 0x35, 0x80, 0xBE, 0xFF, 0x01, 0xBE,
+    0x00, 0x44, 0x00, 0x0D, 0x3F, 0x80, 0x1C, 0xFF, 0x01, 0x1C, 0x00, 0x4E,
+    0x00, 0x0D, 0x49, 0x02, 0x52, 0x01, 0x45, 0x00, 0x0D, 0x4C, 0x59, 0x00,
+    0x04, 0x84, 0x01, 0x52, 0x00, 0x50, 0x00, 0x0D, 0x53, 0x80, 0xCC, 0xFF,
+    0x80, 0xFC, 0xFF, 0x01, 0xFC, 0x00, 0x45, 0x00, 0x0D, 0x68, 0x06, 0xFC,
+    0x05, 0x44, 0x00, 0x02, 0xEB, 0x49, 0x00, 0x0D, 0x38, 0x4E, 0x00, 0x0D,
+    0x42, 0x50, 0x00, 0x0D, 0x5E, 0x53, 0x00, 0x0D, 0x65, 0x56, 0x00, 0x0D,
+    0x6B, 0x80, 0xAE, 0xFF, 0x80, 0x9F, 0xFF, 0x01, 0x9F, 0x00, 0x48, 0x00,
+    0x0D, 0x90, 0x01, 0x9F, 0x00, 0x54, 0x00, 0x0D, 0x93, 0x81, 0x8A, 0x00,
+    0x54, 0x00, 0x08, 0xBC, 0x03, 0xAE, 0x00, 0x44, 0x00, 0x0D, 0x8D, 0x4C,
+    0x00, 0x0D, 0x9A, 0x52, 0x00, 0x0D, 0xA1, 0x80, 0x5F, 0xFF, 0x01, 0x5F,
+    0x00, 0x4F, 0x00, 0x0D, 0xB7, 0x02, 0x5F, 0x00, 0x4C, 0x00, 0x0D, 0xBA,
+    0x50, 0x00, 0x04, 0xD4, 0x81, 0xF2, 0xFF, 0x45, 0x00, 0x0B, 0x31, 0x80,
+    0x5E, 0xFF, 0x84, 0xF8, 0xFF, 0x41, 0x00, 0x0D, 0xA8, 0x4C, 0x00, 0x0D,
+    0xC1, 0x52, 0x00, 0x0D, 0xCC, 0x59, 0x00, 0x0D, 0xD3, 0x80, 0x2E, 0xFF,
+    0x01, 0x2E, 0x00, 0x48, 0x00, 0x0D, 0xE9, 0x80, 0xE3, 0xFF, 0x80, 0x9D,
+    0xFF, 0x01, 0x9D, 0x00, 0x59, 0x00, 0x0D, 0xF6, 0x01, 0x9D, 0x00, 0x52,
+    0x00, 0x0D, 0xF9, 0x01, 0x9D, 0x00, 0x4F, 0x00, 0x0E, 0x00, 0x81, 0xF5,
+    0xFF, 0x54, 0x00, 0x0E, 0x07, 0x83, 0xF5, 0x02, 0x47, 0x00, 0x0D, 0xEC,
+    0x4D, 0x00, 0x0D, 0xF3, 0x53, 0x00, 0x0E, 0x0E, 0x01, 0x1D, 0x00, 0x44,
+    0x00, 0x04, 0x26, 0x80, 0xB8, 0xFF, 0x01, 0xB8, 0x00, 0x45, 0x00, 0x0E,
+    0x2B, 0x80, 0xAB, 0xFF, 0x80, 0xAD, 0xFF, 0x01, 0xAD, 0x00, 0x45, 0x00,
+    0x0E, 0x38, 0x02, 0xAD, 0x01, 0x52, 0x00, 0x0E, 0x35, 0x53, 0x00, 0x0E,
+    0x3B, 0x80, 0xD6, 0xFF, 0x04, 0xD6, 0x03, 0x4C, 0x00, 0x0E, 0x24, 0x4D,
+    0x00, 0x0E, 0x2E, 0x55, 0x00, 0x0E, 0x42, 0x57, 0x00, 0x0E, 0x4D, 0x04,
+    0xFC, 0x00, 0x41, 0x00, 0x0D, 0x72, 0x45, 0x00, 0x0D, 0xD6, 0x49, 0x00,
+    0x0E, 0x15, 0x4F, 0x00, 0x0E, 0x50, 0x80, 0xA4, 0xFF, 0x01, 0xA4, 0x00,
+    0x41, 0x00, 0x0E, 0x76, 0x01, 0xA4, 0x00, 0x45, 0x00, 0x0E, 0x79, 0x80,
+    0x71, 0xFF, 0x01, 0x71, 0x00, 0x45, 0x00, 0x0E, 0x87, 0x01, 0x71, 0x00,
+    0x47, 0x00, 0x0E, 0x8A, 0x01, 0x71, 0x00, 0x41, 0x00, 0x0E, 0x91, 0x80,
+    0x19, 0xFF, 0x01, 0x19, 0x00, 0x45, 0x00, 0x0E, 0x9F, 0x01, 0x19, 0x00,
+    0x44, 0x00, 0x0E, 0xA2, 0x01, 0x19, 0x00, 0x55, 0x00, 0x0E, 0xA9, 0x01,
+    0x19, 0x00, 0x4C, 0x00, 0x0E, 0xB0, 0x01, 0x72, 0x00, 0x59, 0x00, 0x0B,
+    0x12, 0x01, 0x72, 0x00, 0x52, 0x00, 0x0E, 0xBE, 0x01, 0x72, 0x00, 0x54,
+    0x00, 0x0E, 0xC5, 0x01, 0x72, 0x00, 0x53, 0x00, 0x0E, 0xCC, 0x01, 0x72,
+    0x00, 0x55, 0x00, 0x0E, 0xD3, 0x01, 0xA3, 0x00, 0x4E, 0x00, 0x03, 0xB7,
+    0x01, 0xA3, 0x00, 0x4F, 0x00, 0x0E, 0xE1, 0x01, 0xA3, 0x00, 0x49, 0x00,
+    0x0E, 0xE8, 0x01, 0xA3, 0x00, 0x54, 0x00, 0x0E, 0xEF, 0x01, 0xA3, 0x00,
+    0x41, 0x00, 0x0E, 0xF6, 0x01, 0xA3, 0x00, 0x4D, 0x00, 0x0E, 0xFD, 0x01,
+    0xA3, 0x00, 0x52, 0x00, 0x0F, 0x04, 0x01, 0xA3, 0x00, 0x4F, 0x00, 0x0F,
+    0x0B, 0x80, 0x3A, 0xFF, 0x01, 0x3A, 0x00, 0x45, 0x00, 0x0F, 0x19, 0x01,
+    0x3A, 0x00, 0x44, 0x00, 0x0F, 0x1C, 0x01, 0x3A, 0x00, 0x49, 0x00, 0x0F,
+    0x23, 0x01, 0x90, 0x00, 0x54, 0x00, 0x07, 0x59, 0x01, 0x90, 0x00, 0x53,
+    0x00, 0x0F, 0x31, 0x01, 0x90, 0x00, 0x45, 0x00, 0x0F, 0x38, 0x01, 0x90,
+    0x00, 0x52, 0x00, 0x0F, 0x3F, 0x80, 0xE1, 0xFF, 0x02, 0xE1, 0x01, 0x45,
+    0x00, 0x0F, 0x46, 0x4F, 0x00, 0x0F, 0x4D, 0x85, 0xFD, 0xFF, 0x43, 0x00,
+    0x0E, 0xB7, 0x44, 0x00, 0x0E, 0xDA, 0x46, 0x00, 0x0F, 0x12, 0x53, 0x00,
+    0x0F, 0x2A, 0x54, 0x00, 0x0F, 0x50, 0x80, 0xAF, 0xFF, 0x01, 0xAF, 0x00,
+    0x45, 0x00, 0x0F, 0x72, 0x01, 0xAF, 0x00, 0x55, 0x00, 0x0F, 0x75, 0x81,
+    0xCE, 0xFF, 0x53, 0x00, 0x0F, 0x7C, 0x81, 0xFB, 0xFF, 0x53, 0x00, 0x05,
+    0xDE, 0x86, 0xFD, 0x03, 0x44, 0x00, 0x0E, 0x80, 0x46, 0x00, 0x00, 0x23,
+    0x4D, 0x00, 0x0E, 0x98, 0x4E, 0x00, 0x0F, 0x5B, 0x53, 0x00, 0x0F, 0x83,
+    0x54, 0x00, 0x0F, 0x8A, 0x01, 0xB1, 0x00, 0x42, 0x00, 0x0A, 0x80, 0x80,
+    0xE4, 0xFF, 0x01, 0xE4, 0x00, 0x54, 0x00, 0x0F, 0xB3, 0x01, 0xE4, 0x00,
+    0x53, 0x00, 0x0F, 0xB6, 0x02, 0xE4, 0x01, 0x4F, 0x00, 0x0F, 0xAC, 0x55,
+    0x00, 0x0F, 0xBD, 0x01, 0x25, 0x00, 0x50, 0x00, 0x0B, 0x37, 0x01, 0x25,
+    0x00, 0x45, 0x00, 0x0F, 0xCF, 0x80, 0x0A, 0xFF, 0x01, 0x0A, 0x00, 0x4C,
+    0x00, 0x0F, 0xDD, 0x01, 0xAE, 0x00, 0x44, 0x00, 0x0D, 0x8D, 0x03, 0xAE,
+    0x02, 0x44, 0x00, 0x0E, 0x76, 0x4C, 0x00, 0x0F, 0xE0, 0x4E, 0x00, 0x0F,
+    0xE7, 0x80, 0xC7, 0xFF, 0x01, 0xC7, 0x00, 0x57, 0x00, 0x0F, 0xFD, 0x01,
+    0xE3, 0x00, 0x57, 0x00, 0x0D, 0xF3, 0x02, 0xE3, 0x01, 0x45, 0x00, 0x10,
+    0x00, 0x4F, 0x00, 0x10, 0x07, 0x03, 0xE3, 0x02, 0x45, 0x00, 0x0F, 0xD6,
+    0x49, 0x00, 0x0F, 0xEE, 0x4E, 0x00, 0x10, 0x0E, 0x80, 0x6E, 0xFF, 0x01,
+    0x6E, 0x00, 0x44, 0x00, 0x10, 0x28, 0x80, 0x30, 0xFF, 0x01, 0x30, 0x00,
+    0x45, 0x00, 0x10, 0x32, 0x01, 0x30, 0x00, 0x47, 0x00, 0x10, 0x35, 0x80,
+    0x2C, 0xFF, 0x01, 0x2C, 0x00, 0x54, 0x00, 0x10, 0x43, 0x80, 0x58, 0xFF,
+    0x81, 0x58, 0x00, 0x52, 0x00, 0x10, 0x4D, 0x01, 0x58, 0x00, 0x45, 0x00,
+    0x10, 0x50, 0x80, 0xA8, 0xFF, 0x05, 0xA8, 0x04, 0x4E, 0x00, 0x10, 0x2B,
+    0x52, 0x00, 0x10, 0x3C, 0x53, 0x00, 0x10, 0x46, 0x54, 0x00, 0x10, 0x57,
+    0x57, 0x00, 0x10, 0x5E, 0x80, 0x89, 0xFF, 0x01, 0x89, 0x00, 0x52, 0x00,
+    0x10, 0x78, 0x81, 0x89, 0x00, 0x45, 0x00, 0x10, 0x7B, 0x80, 0x17, 0xFF,
+    0x01, 0x17, 0x00, 0x4E, 0x00, 0x10, 0x89, 0x80, 0x34, 0xFF, 0x01, 0x34,
+    0x00, 0x54, 0x00, 0x10, 0x93, 0x80, 0x22, 0xFF, 0x01, 0x22, 0x00, 0x45,
+    0x00, 0x10, 0x9D, 0x04, 0x89, 0x00, 0x44, 0x00, 0x10, 0x82, 0x52, 0x00,
+    0x10, 0x8C, 0x53, 0x00, 0x10, 0x96, 0x56, 0x00, 0x10, 0xA0, 0x01, 0x34,
+    0x00, 0x53, 0x00, 0x10, 0x93, 0x80, 0x24, 0xFF, 0x80, 0xA1, 0xFF, 0x01,
+    0xA1, 0x00, 0x4C, 0x00, 0x10, 0xC4, 0x01, 0xA1, 0x00, 0x45, 0x00, 0x10,
+    0xC7, 0x05, 0xA1, 0x04, 0x41, 0x00, 0x10, 0xA7, 0x46, 0x00, 0x0B, 0xE5,
+    0x53, 0x00, 0x10, 0xBA, 0x54, 0x00, 0x10, 0xC1, 0x56, 0x00, 0x10, 0xCE,
+    0x80, 0xBF, 0xFF, 0x01, 0xBF, 0x00, 0x45, 0x00, 0x10, 0xEC, 0x80, 0x88,
+    0xFF, 0x01, 0x88, 0x00, 0x54, 0x00, 0x10, 0xF6, 0x01, 0x88, 0x00, 0x48,
+    0x00, 0x10, 0xF9, 0x80, 0xE5, 0xFF, 0x01, 0xE5, 0x00, 0x45, 0x00, 0x11,
+    0x07, 0x01, 0x30, 0x00, 0x4C, 0x00, 0x10, 0x35, 0x01, 0x30, 0x00, 0x54,
+    0x00, 0x11, 0x11, 0x06, 0xE5, 0x02, 0x46, 0x00, 0x10, 0xEF, 0x47, 0x00,
+    0x11, 0x00, 0x4B, 0x00, 0x11, 0x0A, 0x4E, 0x00, 0x0C, 0x39, 0x54, 0x00,
+    0x11, 0x18, 0x56, 0x00, 0x03, 0x33, 0x80, 0x2F, 0xFF, 0x01, 0x2F, 0x00,
+    0x47, 0x00, 0x11, 0x3A, 0x80, 0xDB, 0xFF, 0x01, 0xDB, 0x00, 0x4B, 0x00,
+    0x11, 0x44, 0x80, 0x1A, 0xFF, 0x01, 0x1A, 0x00, 0x45, 0x00, 0x11, 0x4E,
+    0x80, 0xB3, 0xFF, 0x80, 0x69, 0xFF, 0x01, 0x69, 0x00, 0x45, 0x00, 0x11,
+    0x5B, 0x06, 0xDB, 0x01, 0x4E, 0x00, 0x11, 0x3D, 0x4F, 0x00, 0x11, 0x47,
+    0x53, 0x00, 0x11, 0x51, 0x54, 0x00, 0x11, 0x58, 0x56, 0x00, 0x11, 0x5E,
+    0x57, 0x00, 0x0D, 0xE9, 0x01, 0x4E, 0x00, 0x48, 0x00, 0x03, 0xF9, 0x01,
+    0x4E, 0x00, 0x43, 0x00, 0x11, 0x80, 0x01, 0x4E, 0x00, 0x4E, 0x00, 0x11,
+    0x87, 0x05, 0xE5, 0x02, 0x41, 0x00, 0x10, 0x61, 0x45, 0x00, 0x10, 0xD5,
+    0x49, 0x00, 0x11, 0x1F, 0x4F, 0x00, 0x11, 0x65, 0x55, 0x00, 0x11, 0x8E,
+    0x01, 0xC9, 0x00, 0x45, 0x00, 0x0C, 0x8F, 0x01, 0xE6, 0x00, 0x45, 0x00,
+    0x04, 0xE8, 0x80, 0xC2, 0xFF, 0x81, 0xC2, 0x00, 0x59, 0x00, 0x11, 0xBA,
+    0x80, 0x93, 0xFF, 0x01, 0x93, 0x00, 0x54, 0x00, 0x11, 0xC4, 0x01, 0x93,
+    0x00, 0x45, 0x00, 0x11, 0xC7, 0x01, 0x93, 0x00, 0x4B, 0x00, 0x11, 0xCE,
+    0x80, 0x79, 0xFF, 0x01, 0x79, 0x00, 0x52, 0x00, 0x11, 0xDC, 0x01, 0x79,
+    0x00, 0x45, 0x00, 0x11, 0xDF, 0x01, 0x79, 0x00, 0x54, 0x00, 0x11, 0xE6,
+    0x80, 0x47, 0xFF, 0x01, 0x47, 0x00, 0x45, 0x00, 0x11, 0xF4, 0x01, 0x47,
+    0x00, 0x42, 0x00, 0x11, 0xF7, 0x06, 0xE6, 0x01, 0x44, 0x00, 0x11, 0xAC,
+    0x4B, 0x00, 0x11, 0xB3, 0x4E, 0x00, 0x11, 0xBD, 0x52, 0x00, 0x11, 0xD5,
+    0x54, 0x00, 0x11, 0xED, 0x59, 0x00, 0x11, 0xFE, 0x80, 0x56, 0xFF, 0x01,
+    0x56, 0x00, 0x54, 0x00, 0x12, 0x20, 0x01, 0xA9, 0x00, 0x52, 0x00, 0x09,
+    0x9D, 0x01, 0xA9, 0x00, 0x45, 0x00, 0x12, 0x2A, 0x01, 0xA9, 0x00, 0x42,
+    0x00, 0x12, 0x31, 0x01, 0x5F, 0x00, 0x45, 0x00, 0x0D, 0xB7, 0x01, 0x5F,
+    0x00, 0x47, 0x00, 0x12, 0x3F, 0x01, 0x5F, 0x00, 0x41, 0x00, 0x12, 0x46,
+    0x01, 0x5F, 0x00, 0x53, 0x00, 0x12, 0x4D, 0x83, 0xE7, 0xFF, 0x45, 0x00,
+    0x12, 0x23, 0x4D, 0x00, 0x12, 0x38, 0x53, 0x00, 0x12, 0x54, 0x80, 0x86,
+    0xFF, 0x80, 0xA5, 0xFF, 0x01, 0xA5, 0x00, 0x45, 0x00, 0x12, 0x6D, 0x01,
+    0xA5, 0x00, 0x54, 0x00, 0x12, 0x70, 0x02, 0xA5, 0x01, 0x44, 0x00, 0x12,
+    0x6A, 0x55, 0x00, 0x12, 0x77, 0x01, 0xA5, 0x00, 0x4E, 0x00, 0x12, 0x7E,
+    0x01, 0x80, 0x00, 0x4C, 0x00, 0x00, 0x4D, 0x01, 0x80, 0x00, 0x45, 0x00,
+    0x12, 0x90, 0x01, 0x99, 0x00, 0x54, 0x00, 0x0D, 0x10, 0x01, 0x99, 0x00,
+    0x4E, 0x00, 0x12, 0x9E, 0x01, 0x99, 0x00, 0x45, 0x00, 0x12, 0xA5, 0x80,
+    0xB5, 0xFF, 0x01, 0xB5, 0x00, 0x59, 0x00, 0x12, 0xB3, 0x01, 0xB4, 0x00,
+    0x48, 0x00, 0x0A, 0xAC, 0x02, 0xB5, 0x00, 0x45, 0x00, 0x12, 0xB6, 0x54,
+    0x00, 0x12, 0xBD, 0x80, 0x9B, 0xFF, 0x01, 0x9B, 0x00, 0x47, 0x00, 0x12,
+    0xCF, 0x01, 0x9B, 0x00, 0x4E, 0x00, 0x12, 0xD2, 0x01, 0x9B, 0x00, 0x49,
+    0x00, 0x12, 0xD9, 0x02, 0xC2, 0x00, 0x45, 0x00, 0x11, 0xBA, 0x4E, 0x00,
+    0x12, 0xE0, 0x01, 0xCF, 0x00, 0x54, 0x00, 0x07, 0x4B, 0x01, 0xB6, 0x00,
+    0x52, 0x00, 0x01, 0xEE, 0x01, 0xB6, 0x00, 0x45, 0x00, 0x12, 0xF9, 0x01,
+    0xB6, 0x00, 0x48, 0x00, 0x13, 0x00, 0x80, 0x1F, 0xFF, 0x80, 0x6A, 0xFF,
+    0x01, 0x6A, 0x00, 0x45, 0x00, 0x13, 0x11, 0x02, 0x6A, 0x01, 0x45, 0x00,
+    0x13, 0x0E, 0x49, 0x00, 0x13, 0x14, 0x07, 0xCF, 0x04, 0x44, 0x00, 0x12,
+    0x97, 0x4D, 0x00, 0x12, 0xAC, 0x4E, 0x00, 0x12, 0xC4, 0x52, 0x00, 0x12,
+    0xE7, 0x53, 0x00, 0x12, 0xF2, 0x54, 0x00, 0x13, 0x07, 0x56, 0x00, 0x13,
+    0x1B, 0x80, 0xC3, 0xFF, 0x01, 0xC3, 0x00, 0x48, 0x00, 0x13, 0x45, 0x01,
+    0x93, 0x00, 0x43, 0x00, 0x11, 0xC4, 0x01, 0x93, 0x00, 0x49, 0x00, 0x13,
+    0x4F, 0x02, 0xC3, 0x00, 0x43, 0x00, 0x13, 0x48, 0x53, 0x00, 0x13, 0x56,
+    0x80, 0xEF, 0xFF, 0x06, 0xEF, 0x05, 0x41, 0x00, 0x12, 0x05, 0x45, 0x00,
+    0x12, 0x5B, 0x49, 0x00, 0x12, 0x89, 0x4F, 0x00, 0x13, 0x26, 0x55, 0x00,
+    0x13, 0x5D, 0x59, 0x00, 0x13, 0x68, 0x80, 0xA6, 0xFF, 0x01, 0xA6, 0x00,
+    0x45, 0x00, 0x13, 0x86, 0x80, 0x92, 0xFF, 0x01, 0x92, 0x00, 0x4E, 0x00,
+    0x13, 0x90, 0x01, 0x92, 0x00, 0x4F, 0x00, 0x13, 0x93, 0x01, 0x92, 0x00,
+    0x49, 0x00, 0x13, 0x9A, 0x02, 0xA6, 0x00, 0x4D, 0x00, 0x13, 0x89, 0x54,
+    0x00, 0x13, 0xA1, 0x01, 0x3D, 0x00, 0x52, 0x00, 0x0A, 0xC1, 0x80, 0x75,
+    0xFF, 0x01, 0x75, 0x00, 0x44, 0x00, 0x13, 0xBA, 0x80, 0x48, 0xFF, 0x01,
+    0x48, 0x00, 0x52, 0x00, 0x13, 0xC4, 0x01, 0x48, 0x00, 0x45, 0x00, 0x13,
+    0xC7, 0x80, 0x6B, 0xFF, 0x81, 0xD2, 0xFF, 0x53, 0x00, 0x13, 0xD5, 0x05,
+    0xD2, 0x03, 0x41, 0x00, 0x13, 0xB3, 0x45, 0x00, 0x13, 0xBD, 0x56, 0x00,
+    0x13, 0xCE, 0x57, 0x00, 0x13, 0xD8, 0x58, 0x00, 0x10, 0x46, 0x01, 0x50,
+    0x00, 0x45, 0x00, 0x0C, 0xD5, 0x80, 0xB9, 0xFF, 0x01, 0xB9, 0x00, 0x54,
+    0x00, 0x13, 0xFD, 0x01, 0xB9, 0x00, 0x48, 0x00, 0x14, 0x00, 0x02, 0xB9,
+    0x01, 0x43, 0x00, 0x13, 0xF6, 0x47, 0x00, 0x14, 0x07, 0x01, 0x38, 0x00,
+    0x59, 0x00, 0x01, 0x85, 0x01, 0x38, 0x00, 0x44, 0x00, 0x14, 0x19, 0x01,
+    0x38, 0x00, 0x4F, 0x00, 0x14, 0x20, 0x01, 0x69, 0x00, 0x48, 0x00, 0x11,
+    0x5B, 0x01, 0x69, 0x00, 0x54, 0x00, 0x14, 0x2E, 0x80, 0x36, 0xFF, 0x01,
+    0x36, 0x00, 0x47, 0x00, 0x14, 0x3C, 0x01, 0x36, 0x00, 0x4E, 0x00, 0x14,
+    0x3F, 0x01, 0x36, 0x00, 0x49, 0x00, 0x14, 0x46, 0x81, 0xFA, 0xFF, 0x48,
+    0x00, 0x14, 0x4D, 0x80, 0xDC, 0xFF, 0x84, 0xFA, 0x02, 0x42, 0x00, 0x14,
+    0x27, 0x52, 0x00, 0x14, 0x35, 0x54, 0x00, 0x14, 0x54, 0x57, 0x00, 0x14,
+    0x5B, 0x01, 0xB9, 0x00, 0x52, 0x00, 0x13, 0xFD, 0x01, 0xB9, 0x00, 0x45,
+    0x00, 0x14, 0x71, 0x01, 0xB9, 0x00, 0x42, 0x00, 0x14, 0x78, 0x01, 0xB9,
+    0x00, 0x4D, 0x00, 0x14, 0x7F, 0x05, 0xFA, 0x03, 0x41, 0x00, 0x13, 0xA8,
+    0x45, 0x00, 0x13, 0xDF, 0x49, 0x00, 0x14, 0x0E, 0x4F, 0x00, 0x14, 0x5E,
+    0x55, 0x00, 0x14, 0x86, 0x80, 0x10, 0xFF, 0x01, 0x10, 0x00, 0x52, 0x00,
+    0x14, 0xA4, 0x01, 0x79, 0x00, 0x4C, 0x00, 0x11, 0xDC, 0x01, 0x79, 0x00,
+    0x41, 0x00, 0x14, 0xAE, 0x02, 0xA0, 0x00, 0x45, 0x00, 0x08, 0x96, 0x49,
+    0x00, 0x14, 0xB5, 0x01, 0xA0, 0x00, 0x43, 0x00, 0x14, 0xBC, 0x02, 0xA0,
+    0x01, 0x45, 0x00, 0x14, 0xA7, 0x49, 0x00, 0x14, 0xC7, 0x01, 0x47, 0x00,
+    0x4E, 0x00, 0x11, 0xF4, 0x01, 0x47, 0x00, 0x45, 0x00, 0x14, 0xD9, 0x82,
+    0xFE, 0xFF, 0x46, 0x00, 0x14, 0xCE, 0x54, 0x00, 0x14, 0xE0, 0x01, 0x74,
+    0x00, 0x4C, 0x00, 0x06, 0xB6, 0x80, 0x5B, 0xFF, 0x01, 0x5B, 0x00, 0x59,
+    0x00, 0x14, 0xF9, 0x81, 0x5B, 0x00, 0x41, 0x00, 0x14, 0xFC, 0x80, 0x2D,
+    0xFF, 0x01, 0x2D, 0x00, 0x44, 0x00, 0x15, 0x0A, 0x01, 0xDB, 0x00, 0x59,
+    0x00, 0x11, 0x44, 0x82, 0xF9, 0xFF, 0x45, 0x00, 0x13, 0x68, 0x4C, 0x00,
+    0x15, 0x14, 0x01, 0x27, 0x00, 0x4E, 0x00, 0x05, 0x8B, 0x01, 0x27, 0x00,
+    0x45, 0x00, 0x15, 0x26, 0x01, 0x63, 0x00, 0x4E, 0x00, 0x0D, 0x35, 0x01,
+    0x63, 0x00, 0x4F, 0x00, 0x15, 0x34, 0x01, 0x63, 0x00, 0x49, 0x00, 0x15,
+    0x3B, 0x01, 0x63, 0x00, 0x54, 0x00, 0x15, 0x42, 0x01, 0x63, 0x00, 0x41,
+    0x00, 0x15, 0x49, 0x01, 0x63, 0x00, 0x5A, 0x00, 0x15, 0x50, 0x01, 0x63,
+    0x00, 0x49, 0x00, 0x15, 0x57, 0x01, 0x63, 0x00, 0x4E, 0x00, 0x15, 0x5E,
+    0x01, 0x63, 0x00, 0x41, 0x00, 0x15, 0x65, 0x81, 0xF1, 0xFF, 0x47, 0x00,
+    0x15, 0x6C, 0x81, 0xDD, 0xFF, 0x53, 0x00, 0x10, 0xC4, 0x01, 0xDD, 0x00,
+    0x52, 0x00, 0x15, 0x7A, 0x01, 0xDD, 0x00, 0x45, 0x00, 0x15, 0x81, 0x01,
+    0xDD, 0x00, 0x48, 0x00, 0x15, 0x88, 0x80, 0xD5, 0xFF, 0x81, 0xEB, 0xFF,
+    0x53, 0x00, 0x0F, 0x2A, 0x02, 0xEB, 0x01, 0x52, 0x00, 0x15, 0x96, 0x54,
+    0x00, 0x15, 0x99, 0x80, 0xD9, 0xFF, 0x01, 0xD9, 0x00, 0x52, 0x00, 0x15,
+    0xAB, 0x01, 0xD9, 0x00, 0x45, 0x00, 0x15, 0xAE, 0x01, 0x2A, 0x00, 0x4E,
+    0x00, 0x01, 0x66, 0x0B, 0xFE, 0x00, 0x46, 0x00, 0x14, 0xE7, 0x49, 0x00,
+    0x14, 0xF2, 0x4B, 0x00, 0x15, 0x03, 0x4C, 0x00, 0x15, 0x0D, 0x4E, 0x00,
+    0x15, 0x1B, 0x50, 0x00, 0x15, 0x2D, 0x52, 0x00, 0x15, 0x73, 0x54, 0x00,
+    0x15, 0x8F, 0x55, 0x00, 0x15, 0xA0, 0x56, 0x00, 0x15, 0xB5, 0x57, 0x00,
+    0x15, 0xBC, 0x80, 0x7C, 0xFF, 0x01, 0x7C, 0x00, 0x52, 0x00, 0x15, 0xF2,
+    0x01, 0x7C, 0x00, 0x45, 0x00, 0x15, 0xF5, 0x81, 0xBE, 0xFF, 0x59, 0x00,
+    0x0D, 0xF6, 0x01, 0xBE, 0x00, 0x54, 0x00, 0x16, 0x03, 0x80, 0x08, 0xFF,
+    0x01, 0x08, 0x00, 0x53, 0x00, 0x16, 0x11, 0x80, 0x6C, 0xFF, 0x01, 0x6C,
+    0x00, 0x54, 0x00, 0x16, 0x1B, 0x01, 0x6C, 0x00, 0x4E, 0x00, 0x16, 0x1E,
+    0x01, 0x6C, 0x00, 0x45, 0x00, 0x16, 0x25, 0x01, 0x6C, 0x00, 0x49, 0x00,
+    0x16, 0x2C, 0x05, 0xBE, 0x01, 0x50, 0x00, 0x15, 0xFC, 0x52, 0x00, 0x16,
+    0x0A, 0x53, 0x00, 0x16, 0x14, 0x54, 0x00, 0x16, 0x33, 0x59, 0x00, 0x0E,
+    0x9F, 0x80, 0xE2, 0xFF, 0x01, 0xE2, 0x00, 0x45, 0x00, 0x16, 0x51, 0x01,
+    0xE2, 0x00, 0x4C, 0x00, 0x16, 0x54, 0x01, 0xE2, 0x00, 0x50, 0x00, 0x16,
+    0x5B, 0x01, 0x9F, 0x00, 0x4E, 0x00, 0x0D, 0x90, 0x01, 0x9F, 0x00, 0x4F,
+    0x00, 0x16, 0x69, 0x01, 0x9F, 0x00, 0x53, 0x00, 0x16, 0x70, 0x02, 0xE2,
+    0x00, 0x4F, 0x00, 0x16, 0x62, 0x52, 0x00, 0x16, 0x77, 0x01, 0x70, 0x00,
+    0x45, 0x00, 0x07, 0x41, 0x01, 0x70, 0x00, 0x4E, 0x00, 0x16, 0x89, 0x01,
+    0x70, 0x00, 0x4F, 0x00, 0x16, 0x90, 0x80, 0x6F, 0xFF, 0x01, 0x6F, 0x00,
+    0x45, 0x00, 0x16, 0x9E, 0x01, 0x6F, 0x00, 0x52, 0x00, 0x16, 0xA1, 0x01,
+    0x6F, 0x00, 0x55, 0x00, 0x16, 0xA8, 0x01, 0x6F, 0x00, 0x54, 0x00, 0x16,
+    0xAF, 0x01, 0x6E, 0x00, 0x45, 0x00, 0x10, 0x28, 0x01, 0x6E, 0x00, 0x43,
+    0x00, 0x16, 0xBD, 0x02, 0x6F, 0x00, 0x43, 0x00, 0x16, 0xB6, 0x45, 0x00,
+    0x16, 0xC4, 0x80, 0x7D, 0xFF, 0x01, 0x7D, 0x00, 0x52, 0x00, 0x16, 0xD6,
+    0x81, 0x7D, 0x00, 0x45, 0x00, 0x16, 0xD9, 0x03, 0xBD, 0x00, 0x43, 0x00,
+    0x04, 0xF8, 0x4E, 0x00, 0x05, 0xBF, 0x59, 0x00, 0x16, 0xE0, 0x80, 0x5C,
+    0xFF, 0x01, 0x5C, 0x00, 0x45, 0x00, 0x16, 0xF6, 0x01, 0x5C, 0x00, 0x53,
+    0x00, 0x16, 0xF9, 0x01, 0x5C, 0x00, 0x41, 0x00, 0x17, 0x00, 0x02, 0xBD,
+    0x00, 0x41, 0x00, 0x16, 0xE7, 0x45, 0x00, 0x17, 0x07, 0x01, 0xB8, 0x00,
+    0x54, 0x00, 0x0E, 0x2B, 0x01, 0xB8, 0x00, 0x4E, 0x00, 0x17, 0x19, 0x80,
+    0x87, 0xFF, 0x02, 0x95, 0x01, 0x45, 0x00, 0x17, 0x27, 0x59, 0x00, 0x00,
+    0xBB, 0x01, 0x95, 0x00, 0x43, 0x00, 0x17, 0x2A, 0x01, 0x95, 0x00, 0x49,
+    0x00, 0x17, 0x35, 0x80, 0x61, 0xFF, 0x01, 0x61, 0x00, 0x4E, 0x00, 0x17,
+    0x43, 0x01, 0x61, 0x00, 0x4F, 0x00, 0x17, 0x46, 0x01, 0x61, 0x00, 0x49,
+    0x00, 0x17, 0x4D, 0x01, 0x61, 0x00, 0x54, 0x00, 0x17, 0x54, 0x01, 0x61,
+    0x00, 0x41, 0x00, 0x17, 0x5B, 0x01, 0x61, 0x00, 0x4C, 0x00, 0x17, 0x62,
+    0x01, 0x61, 0x00, 0x55, 0x00, 0x17, 0x69, 0x01, 0x7D, 0x00, 0x4E, 0x00,
+    0x16, 0xD6, 0x01, 0x7D, 0x00, 0x4F, 0x00, 0x17, 0x77, 0x01, 0x7D, 0x00,
+    0x49, 0x00, 0x17, 0x7E, 0x01, 0x7D, 0x00, 0x54, 0x00, 0x17, 0x85, 0x01,
+    0x7D, 0x00, 0x49, 0x00, 0x17, 0x8C, 0x01, 0xAB, 0x00, 0x52, 0x00, 0x0E,
+    0x35, 0x01, 0xAB, 0x00, 0x45, 0x00, 0x17, 0x9A, 0x05, 0xB8, 0x00, 0x49,
+    0x00, 0x17, 0x20, 0x4C, 0x00, 0x17, 0x3C, 0x50, 0x00, 0x17, 0x70, 0x53,
+    0x00, 0x17, 0x93, 0x57, 0x00, 0x17, 0xA1, 0x01, 0x6F, 0x00, 0x43, 0x00,
+    0x16, 0xA1, 0x01, 0x6F, 0x00, 0x49, 0x00, 0x17, 0xBF, 0x01, 0x6F, 0x00,
+    0x54, 0x00, 0x17, 0xC6, 0x01, 0x6F, 0x00, 0x43, 0x00, 0x17, 0xCD, 0x01,
+    0xA6, 0x00, 0x54, 0x00, 0x13, 0x86, 0x01, 0xA6, 0x00, 0x4E, 0x00, 0x17,
+    0xDB, 0x01, 0xA6, 0x00, 0x45, 0x00, 0x17, 0xE2, 0x01, 0xA6, 0x00, 0x44,
+    0x00, 0x17, 0xE9, 0x01, 0xA6, 0x00, 0x49, 0x00, 0x17, 0xF0, 0x01, 0xA6,
+    0x00, 0x53, 0x00, 0x17, 0xF7, 0x01, 0x86, 0x00, 0x45, 0x00, 0x12, 0x6A,
+    0x01, 0x86, 0x00, 0x43, 0x00, 0x18, 0x05, 0x01, 0x94, 0x00, 0x53, 0x00,
+    0x09, 0xDB, 0x01, 0x94, 0x00, 0x53, 0x00, 0x18, 0x13, 0x01, 0x94, 0x00,
+    0x45, 0x00, 0x18, 0x1A, 0x01, 0x6D, 0x00, 0x54, 0x00, 0x08, 0x7E, 0x01,
+    0x6D, 0x00, 0x43, 0x00, 0x18, 0x28, 0x01, 0x6D, 0x00, 0x55, 0x00, 0x18,
+    0x2F, 0x80, 0xBB, 0xFF, 0x01, 0xBB, 0x00, 0x4D, 0x00, 0x18, 0x3D, 0x01,
+    0xBB, 0x00, 0x41, 0x00, 0x18, 0x40, 0x01, 0xBB, 0x00, 0x52, 0x00, 0x18,
+    0x47, 0x80, 0x77, 0xFF, 0x01, 0x77, 0x00, 0x54, 0x00, 0x18, 0x55, 0x01,
+    0x77, 0x00, 0x43, 0x00, 0x18, 0x58, 0x01, 0x77, 0x00, 0x45, 0x00, 0x18,
+    0x5F, 0x80, 0x1B, 0xFF, 0x01, 0x1B, 0x00, 0x45, 0x00, 0x18, 0x6D, 0x01,
+    0x1B, 0x00, 0x44, 0x00, 0x18, 0x70, 0x01, 0x1B, 0x00, 0x49, 0x00, 0x18,
+    0x77, 0x05, 0xBB, 0x02, 0x43, 0x00, 0x18, 0x21, 0x44, 0x00, 0x18, 0x36,
+    0x47, 0x00, 0x18, 0x4E, 0x4A, 0x00, 0x18, 0x66, 0x56, 0x00, 0x18, 0x7E,
+    0x04, 0xBB, 0x03, 0x41, 0x00, 0x17, 0xD4, 0x45, 0x00, 0x17, 0xFE, 0x49,
+    0x00, 0x18, 0x0C, 0x4F, 0x00, 0x18, 0x85, 0x01, 0x06, 0x00, 0x4C, 0x00,
+    0x07, 0x6A, 0x02, 0x24, 0x01, 0x4C, 0x00, 0x18, 0xAF, 0x54, 0x00, 0x10,
+    0xC1, 0x08, 0xE2, 0x01, 0x41, 0x00, 0x16, 0x3A, 0x45, 0x00, 0x16, 0x7E,
+    0x48, 0x00, 0x16, 0x97, 0x49, 0x00, 0x16, 0xCB, 0x4C, 0x00, 0x17, 0x0E,
+    0x4F, 0x00, 0x17, 0xA8, 0x52, 0x00, 0x18, 0x9C, 0x55, 0x00, 0x18, 0xB6,
+    0x80, 0x03, 0xFF, 0x01, 0x03, 0x00, 0x5A, 0x00, 0x18, 0xE4, 0x01, 0x03,
+    0x00, 0x4C, 0x00, 0x18, 0xE4, 0x80, 0x04, 0xFF, 0x01, 0x04, 0x00, 0x48,
+    0x00, 0x18, 0xF5, 0x01, 0xBA, 0x00, 0x4E, 0x00, 0x0C, 0x92, 0x01, 0xBA,
+    0x00, 0x4F, 0x00, 0x18, 0xFF, 0x01, 0xBA, 0x00, 0x49, 0x00, 0x19, 0x06,
+    0x01, 0xBA, 0x00, 0x54, 0x00, 0x19, 0x0D, 0x01, 0xBA, 0x00, 0x53, 0x00,
+    0x19, 0x14, 0x01, 0xBA, 0x00, 0x45, 0x00, 0x19, 0x1B, 0x04, 0xBA, 0x03,
+    0x52, 0x00, 0x18, 0xE7, 0x53, 0x00, 0x18, 0xEE, 0x54, 0x00, 0x18, 0xF8,
+    0x55, 0x00, 0x19, 0x22, 0x01, 0x08, 0x00, 0x45, 0x00, 0x16, 0x11, 0x01,
+    0x08, 0x00, 0x53, 0x00, 0x19, 0x3C, 0x01, 0x8B, 0x00, 0x45, 0x00, 0x09,
+    0x7A, 0x02, 0x8B, 0x01, 0x49, 0x00, 0x19, 0x43, 0x54, 0x00, 0x19, 0x4A,
+    0x01, 0x0A, 0x00, 0x48, 0x00, 0x0F, 0xDD, 0x81, 0x53, 0x00, 0x59, 0x00,
+    0x0B, 0xC0, 0x80, 0x46, 0xFF, 0x01, 0x46, 0x00, 0x59, 0x00, 0x19, 0x6A,
+    0x81, 0x46, 0x00, 0x4C, 0x00, 0x19, 0x6D, 0x01, 0x9B, 0x00, 0x4E, 0x00,
+    0x12, 0xCF, 0x01, 0x9B, 0x00, 0x4F, 0x00, 0x19, 0x7B, 0x04, 0x9B, 0x03,
+    0x43, 0x00, 0x19, 0x5C, 0x44, 0x00, 0x19, 0x63, 0x4C, 0x00, 0x19, 0x74,
+    0x53, 0x00, 0x19, 0x82, 0x01, 0x7C, 0x00, 0x44, 0x00, 0x15, 0xF2, 0x01,
+    0x7C, 0x00, 0x52, 0x00, 0x19, 0x9C, 0x01, 0x7C, 0x00, 0x4F, 0x00, 0x19,
+    0xA3, 0x80, 0x83, 0xFF, 0x01, 0x83, 0x00, 0x50, 0x00, 0x19, 0xB1, 0x01,
+    0x83, 0x00, 0x49, 0x00, 0x19, 0xB4, 0x01, 0x83, 0x00, 0x48, 0x00, 0x19,
+    0xBB, 0x01, 0x83, 0x00, 0x53, 0x00, 0x19, 0xC2, 0x01, 0x83, 0x00, 0x4E,
+    0x00, 0x19, 0xC9, 0x01, 0x83, 0x00, 0x4F, 0x00, 0x19, 0xD0, 0x01, 0x83,
+    0x00, 0x49, 0x00, 0x19, 0xD7, 0x01, 0x83, 0x00, 0x54, 0x00, 0x19, 0xDE,
+    0x01, 0x83, 0x00, 0x41, 0x00, 0x19, 0xE5, 0x80, 0x09, 0xFF, 0x01, 0x09,
+    0x00, 0x4E, 0x00, 0x19, 0xF3, 0x01, 0x09, 0x00, 0x49, 0x00, 0x19, 0xF6,
+    0x01, 0x10, 0x00, 0x45, 0x00, 0x14, 0xA7, 0x01, 0x10, 0x00, 0x42, 0x00,
+    0x1A, 0x04, 0x01, 0x10, 0x00, 0x4D, 0x00, 0x1A, 0x0B, 0x02, 0x10, 0x01,
+    0x41, 0x00, 0x19, 0xFD, 0x45, 0x00, 0x1A, 0x12, 0x01, 0x85, 0x00, 0x54,
+    0x00, 0x07, 0x74, 0x01, 0x85, 0x00, 0x52, 0x00, 0x1A, 0x24, 0x01, 0x85,
+    0x00, 0x4F, 0x00, 0x1A, 0x2B, 0x80, 0x07, 0xFF, 0x01, 0x07, 0x00, 0x45,
+    0x00, 0x1A, 0x39, 0x01, 0x07, 0x00, 0x52, 0x00, 0x1A, 0x3C, 0x01, 0x07,
+    0x00, 0x49, 0x00, 0x1A, 0x43, 0x01, 0x07, 0x00, 0x55, 0x00, 0x1A, 0x4A,
+    0x01, 0x9A, 0x00, 0x48, 0x00, 0x0C, 0x51, 0x01, 0x9A, 0x00, 0x43, 0x00,
+    0x1A, 0x58, 0x01, 0x9A, 0x00, 0x52, 0x00, 0x1A, 0x5F, 0x01, 0x9A, 0x00,
+    0x41, 0x00, 0x1A, 0x66, 0x01, 0x9C, 0x00, 0x54, 0x00, 0x05, 0x35, 0x01,
+    0x9C, 0x00, 0x4C, 0x00, 0x1A, 0x74, 0x02, 0x9C, 0x01, 0x45, 0x00, 0x1A,
+    0x6D, 0x55, 0x00, 0x1A, 0x7B, 0x07, 0x9C, 0x06, 0x41, 0x00, 0x19, 0x89,
+    0x43, 0x00, 0x19, 0xAA, 0x4C, 0x00, 0x19, 0xEC, 0x4D, 0x00, 0x1A, 0x19,
+    0x50, 0x00, 0x1A, 0x32, 0x51, 0x00, 0x1A, 0x51, 0x53, 0x00, 0x1A, 0x82,
+    0x01, 0xB3, 0x00, 0x54, 0x00, 0x11, 0x58, 0x01, 0xB3, 0x00, 0x48, 0x00,
+    0x1A, 0xAC, 0x01, 0xB3, 0x00, 0x47, 0x00, 0x1A, 0xB3, 0x01, 0x82, 0x00,
+    0x44, 0x00, 0x01, 0xF8, 0x01, 0x8C, 0x00, 0x45, 0x00, 0x07, 0x9E, 0x80,
+    0xB7, 0xFF, 0x01, 0xB7, 0x00, 0x4D, 0x00, 0x1A, 0xCF, 0x03, 0xB7, 0x02,
+    0x41, 0x00, 0x1A, 0xC1, 0x4C, 0x00, 0x1A, 0xC8, 0x4F, 0x00, 0x1A, 0xD2,
+    0x80, 0x01, 0xFF, 0x01, 0x01, 0x00, 0x54, 0x00, 0x1A, 0xE8, 0x01, 0x1F,
+    0x00, 0x4E, 0x00, 0x13, 0x0E, 0x06, 0xB7, 0x03, 0x41, 0x00, 0x19, 0x51,
+    0x45, 0x00, 0x1A, 0x8D, 0x49, 0x00, 0x1A, 0xBA, 0x4F, 0x00, 0x1A, 0xD9,
+    0x53, 0x00, 0x1A, 0xEB, 0x55, 0x00, 0x1A, 0xF2, 0x01, 0xCA, 0x00, 0x44,
+    0x00, 0x07, 0xE8, 0x01, 0x2B, 0x00, 0x45, 0x00, 0x07, 0xF8, 0x80, 0xC8,
+    0xFF, 0x80, 0xF2, 0xFF, 0x05, 0xF2, 0x04, 0x44, 0x00, 0x0B, 0x34, 0x49,
+    0x00, 0x1B, 0x14, 0x4D, 0x00, 0x1B, 0x1B, 0x57, 0x00, 0x1B, 0x22, 0x59,
+    0x00, 0x1B, 0x25, 0x01, 0xA2, 0x00, 0x4C, 0x00, 0x0A, 0xA9, 0x01, 0xA2,
+    0x00, 0x4F, 0x00, 0x1B, 0x3F, 0x01, 0xA2, 0x00, 0x4F, 0x00, 0x1B, 0x46,
+    0x01, 0xA2, 0x00, 0x48, 0x00, 0x1B, 0x4D, 0x80, 0x7F, 0xFF, 0x01, 0x7F,
+    0x00, 0x4E, 0x00, 0x1B, 0x5B, 0x01, 0x7F, 0x00, 0x4F, 0x00, 0x1B, 0x5E,
+    0x01, 0x7F, 0x00, 0x53, 0x00, 0x1B, 0x65, 0x81, 0xDE, 0xFF, 0x4D, 0x00,
+    0x0A, 0xEF, 0x01, 0x07, 0x00, 0x4C, 0x00, 0x1A, 0x39, 0x01, 0x92, 0x00,
+    0x45, 0x00, 0x13, 0x90, 0x02, 0x92, 0x01, 0x44, 0x00, 0x07, 0xEB, 0x53,
+    0x00, 0x1B, 0x81, 0x01, 0xAD, 0x00, 0x43, 0x00, 0x0E, 0x3B, 0x02, 0xAD,
+    0x01, 0x45, 0x00, 0x04, 0x95, 0x49, 0x00, 0x1B, 0x93, 0x01, 0xAD, 0x00,
+    0x56, 0x00, 0x1B, 0x9A, 0x06, 0xDE, 0x01, 0x41, 0x00, 0x1B, 0x6C, 0x45,
+    0x00, 0x1B, 0x73, 0x4C, 0x00, 0x1B, 0x7A, 0x4E, 0x00, 0x1B, 0x88, 0x52,
+    0x00, 0x1B, 0xA5, 0x54, 0x00, 0x06, 0x4E, 0x80, 0xF1, 0xFF, 0x01, 0x2F,
+    0x00, 0x54, 0x00, 0x11, 0x3A, 0x02, 0x89, 0x01, 0x52, 0x00, 0x1B, 0xCA,
+    0x57, 0x00, 0x10, 0x78, 0x02, 0xF1, 0x00, 0x45, 0x00, 0x1B, 0xC7, 0x4F,
+    0x00, 0x1B, 0xD1, 0x80, 0x40, 0xFF, 0x01, 0x40, 0x00, 0x45, 0x00, 0x1B,
+    0xE7, 0x01, 0x40, 0x00, 0x43, 0x00, 0x1B, 0xEA, 0x01, 0x73, 0x00, 0x4E,
+    0x00, 0x06, 0x94, 0x01, 0x73, 0x00, 0x4F, 0x00, 0x1B, 0xF8, 0x01, 0x73,
+    0x00, 0x49, 0x00, 0x1B, 0xFF, 0x01, 0x73, 0x00, 0x54, 0x00, 0x1C, 0x06,
+    0x01, 0x73, 0x00, 0x41, 0x00, 0x1C, 0x0D, 0x82, 0x77, 0x00, 0x45, 0x00,
+    0x18, 0x55, 0x55, 0x00, 0x1C, 0x14, 0x03, 0xAF, 0x00, 0x44, 0x00, 0x0F,
+    0x75, 0x4E, 0x00, 0x1B, 0xF1, 0x54, 0x00, 0x1C, 0x1B, 0x80, 0x4B, 0xFF,
+    0x01, 0x4B, 0x00, 0x50, 0x00, 0x1C, 0x35, 0x01, 0x4B, 0x00, 0x45, 0x00,
+    0x1C, 0x38, 0x01, 0x4B, 0x00, 0x45, 0x00, 0x1C, 0x3F, 0x01, 0x31, 0x00,
+    0x4C, 0x00, 0x03, 0xAD, 0x01, 0x31, 0x00, 0x4C, 0x00, 0x1C, 0x4D, 0x01,
+    0x31, 0x00, 0x41, 0x00, 0x1C, 0x54, 0x01, 0x7F, 0x00, 0x59, 0x00, 0x1B,
+    0x5B, 0x01, 0x7F, 0x00, 0x54, 0x00, 0x1C, 0x62, 0x01, 0x7F, 0x00, 0x45,
+    0x00, 0x1C, 0x69, 0x01, 0x7F, 0x00, 0x49, 0x00, 0x1C, 0x70, 0x01, 0x48,
+    0x00, 0x53, 0x00, 0x13, 0xC4, 0x01, 0x48, 0x00, 0x45, 0x00, 0x1C, 0x7E,
+    0x01, 0x48, 0x00, 0x4D, 0x00, 0x1C, 0x85, 0x02, 0x48, 0x01, 0x48, 0x00,
+    0x01, 0xA7, 0x49, 0x00, 0x1C, 0x8C, 0x82, 0xDF, 0xFF, 0x4F, 0x00, 0x09,
+    0xD4, 0x54, 0x00, 0x1C, 0x93, 0x01, 0xDF, 0x00, 0x45, 0x00, 0x1C, 0x9E,
+    0x81, 0x84, 0xFF, 0x47, 0x00, 0x08, 0x29, 0x01, 0x59, 0x00, 0x4E, 0x00,
+    0x0C, 0x70, 0x01, 0x5B, 0x00, 0x52, 0x00, 0x14, 0xFC, 0x80, 0x64, 0xFF,
+    0x01, 0x64, 0x00, 0x45, 0x00, 0x1C, 0xC5, 0x01, 0x64, 0x00, 0x43, 0x00,
+    0x1C, 0xC8, 0x01, 0x64, 0x00, 0x52, 0x00, 0x1C, 0xCF, 0x87, 0xEC, 0xFF,
+    0x43, 0x00, 0x1C, 0x77, 0x4D, 0x00, 0x1C, 0xA9, 0x4E, 0x00, 0x1C, 0xB0,
+    0x4F, 0x00, 0x1C, 0xB7, 0x52, 0x00, 0x1C, 0xBE, 0x53, 0x00, 0x18, 0xF5,
+    0x55, 0x00, 0x1C, 0xD6, 0x01, 0x7B, 0x00, 0x45, 0x00, 0x0C, 0xE6, 0x01,
+    0x7B, 0x00, 0x43, 0x00, 0x1C, 0xFC, 0x80, 0x14, 0xFF, 0x01, 0x14, 0x00,
+    0x4B, 0x00, 0x1D, 0x0A, 0x01, 0x12, 0x00, 0x44, 0x00, 0x0C, 0xF7, 0x02,
+    0x14, 0x00, 0x41, 0x00, 0x1D, 0x0D, 0x4E, 0x00, 0x1D, 0x14, 0x02, 0x7B,
+    0x00, 0x41, 0x00, 0x1D, 0x03, 0x45, 0x00, 0x1D, 0x1B, 0x01, 0x1A, 0x00,
+    0x44, 0x00, 0x11, 0x4E, 0x81, 0x76, 0xFF, 0x54, 0x00, 0x03, 0x0A, 0x80,
+    0x0C, 0xFF, 0x03, 0x76, 0x01, 0x4E, 0x00, 0x1D, 0x31, 0x52, 0x00, 0x1D,
+    0x38, 0x59, 0x00, 0x1D, 0x3F, 0x01, 0x67, 0x00, 0x50, 0x00, 0x02, 0x9A,
+    0x01, 0x45, 0x00, 0x4C, 0x00, 0x01, 0x0A, 0x01, 0x45, 0x00, 0x4C, 0x00,
+    0x1D, 0x58, 0x80, 0x54, 0xFF, 0x02, 0xB5, 0x01, 0x50, 0x00, 0x1D, 0x66,
+    0x52, 0x00, 0x12, 0xB6, 0x01, 0x71, 0x00, 0x54, 0x00, 0x0E, 0x87, 0x01,
+    0x71, 0x00, 0x45, 0x00, 0x1D, 0x74, 0x01, 0x71, 0x00, 0x45, 0x00, 0x1D,
+    0x7B, 0x01, 0xB2, 0x00, 0x59, 0x00, 0x03, 0xC1, 0x01, 0xB2, 0x00, 0x44,
+    0x00, 0x1D, 0x89, 0x06, 0xB5, 0x03, 0x41, 0x00, 0x1D, 0x42, 0x45, 0x00,
+    0x1D, 0x51, 0x49, 0x00, 0x1D, 0x5F, 0x4F, 0x00, 0x1D, 0x69, 0x52, 0x00,
+    0x1D, 0x82, 0x55, 0x00, 0x1D, 0x90, 0x80, 0xC1, 0xFF, 0x01, 0xC1, 0x00,
+    0x48, 0x00, 0x1D, 0xB2, 0x01, 0x09, 0x00, 0x54, 0x00, 0x19, 0xF3, 0x01,
+    0x09, 0x00, 0x53, 0x00, 0x1D, 0xBC, 0x01, 0x09, 0x00, 0x45, 0x00, 0x1D,
+    0xC3, 0x01, 0x09, 0x00, 0x47, 0x00, 0x1D, 0xCA, 0x80, 0x68, 0xFF, 0x01,
+    0x68, 0x00, 0x54, 0x00, 0x1D, 0xD8, 0x01, 0x68, 0x00, 0x52, 0x00, 0x1D,
+    0xDB, 0x01, 0x68, 0x00, 0x4F, 0x00, 0x1D, 0xE2, 0x01, 0x68, 0x00, 0x50,
+    0x00, 0x1D, 0xE9, 0x01, 0x46, 0x00, 0x45, 0x00, 0x19, 0x6A, 0x04, 0xC1,
+    0x00, 0x43, 0x00, 0x1D, 0xB5, 0x47, 0x00, 0x1D, 0xD1, 0x50, 0x00, 0x1D,
+    0xF0, 0x52, 0x00, 0x1D, 0xF7, 0x01, 0xBB, 0x00, 0x45, 0x00, 0x18, 0x40,
+    0x01, 0xBB, 0x00, 0x54, 0x00, 0x1E, 0x11, 0x01, 0xBB, 0x00, 0x53, 0x00,
+    0x1E, 0x18, 0x0C, 0xF2, 0x00, 0x41, 0x00, 0x1B, 0x28, 0x43, 0x00, 0x1B,
+    0x54, 0x45, 0x00, 0x1B, 0xAC, 0x48, 0x00, 0x1B, 0xDC, 0x49, 0x00, 0x1C,
+    0x26, 0x4C, 0x00, 0x1C, 0x46, 0x4D, 0x00, 0x1C, 0x5B, 0x4F, 0x00, 0x1C,
+    0xDD, 0x50, 0x00, 0x1D, 0x26, 0x54, 0x00, 0x1D, 0x97, 0x55, 0x00, 0x1D,
+    0xFE, 0x59, 0x00, 0x1E, 0x1F, 0x01, 0x75, 0x00, 0x45, 0x00, 0x13, 0xBA,
+    0x01, 0x75, 0x00, 0x4C, 0x00, 0x1E, 0x59, 0x03, 0xE2, 0x01, 0x42, 0x00,
+    0x1E, 0x60, 0x4B, 0x00, 0x16, 0x54, 0x58, 0x00, 0x08, 0x41, 0x01, 0x98,
+    0x00, 0x45, 0x00, 0x00, 0xCC, 0x01, 0x98, 0x00, 0x48, 0x00, 0x1E, 0x76,
+    0x02, 0xA5, 0x01, 0x43, 0x00, 0x1E, 0x7D, 0x4D, 0x00, 0x12, 0x6D, 0x01,
+    0x68, 0x00, 0x59, 0x00, 0x1D, 0xD8, 0x01, 0x68, 0x00, 0x47, 0x00, 0x1E,
+    0x8F, 0x01, 0x68, 0x00, 0x4F, 0x00, 0x1E, 0x96, 0x01, 0x68, 0x00, 0x4C,
+    0x00, 0x1E, 0x9D, 0x01, 0x68, 0x00, 0x4F, 0x00, 0x1E, 0xA4, 0x01, 0x68,
+    0x00, 0x4E, 0x00, 0x1E, 0xAB, 0x01, 0x68, 0x00, 0x48, 0x00, 0x1E, 0xB2,
+    0x01, 0x6A, 0x00, 0x54, 0x00, 0x13, 0x11, 0x03, 0xA5, 0x00, 0x41, 0x00,
+    0x1E, 0x84, 0x43, 0x00, 0x1E, 0xB9, 0x53, 0x00, 0x1E, 0xC0, 0x80, 0x5D,
+    0xFF, 0x81, 0x5D, 0xFF, 0x53, 0x00, 0x1E, 0xD6, 0x81, 0xDD, 0xFF, 0x4B,
+    0x00, 0x1E, 0xD9, 0x02, 0xFC, 0x01, 0x4E, 0x00, 0x1E, 0xE0, 0x54, 0x00,
+    0x0D, 0x68, 0x80, 0xED, 0xFF, 0x01, 0xED, 0x00, 0x52, 0x00, 0x1E, 0xF2,
+    0x80, 0xDE, 0xFF, 0x01, 0xED, 0x00, 0x45, 0x00, 0x1E, 0xF2, 0x80, 0xF3,
+    0xFF, 0x86, 0xFF, 0xFF, 0x49, 0x00, 0x1E, 0xF5, 0x4D, 0x00, 0x1E, 0xFC,
+    0x4E, 0x00, 0x14, 0x5B, 0x52, 0x00, 0x1E, 0xFF, 0x53, 0x00, 0x0C, 0x5E,
+    0x59, 0x00, 0x1F, 0x06, 0x02, 0xD9, 0x01, 0x47, 0x00, 0x1D, 0xB2, 0x4B,
+    0x00, 0x15, 0xAB, 0x80, 0xF6, 0xFF, 0x02, 0xF6, 0x01, 0x4E, 0x00, 0x1F,
+    0x24, 0x53, 0x00, 0x1F, 0x2F, 0x01, 0xC7, 0x00, 0x54, 0x00, 0x0F, 0xFD,
+    0x01, 0xC7, 0x00, 0x48, 0x00, 0x1F, 0x3D, 0x01, 0xC7, 0x00, 0x47, 0x00,
+    0x1F, 0x44, 0x01, 0xC7, 0x00, 0x55, 0x00, 0x1F, 0x4B, 0x01, 0x40, 0x00,
+    0x48, 0x00, 0x1B, 0xE7, 0x01, 0x40, 0x00, 0x47, 0x00, 0x1F, 0x59, 0x01,
+    0x40, 0x00, 0x55, 0x00, 0x1F, 0x60, 0x01, 0x40, 0x00, 0x4F, 0x00, 0x1F,
+    0x67, 0x05, 0xFF, 0x01, 0x41, 0x00, 0x1E, 0xE7, 0x45, 0x00, 0x1F, 0x09,
+    0x49, 0x00, 0x1F, 0x32, 0x4F, 0x00, 0x1F, 0x52, 0x52, 0x00, 0x1F, 0x6E,
+    0x01, 0x4B, 0x00, 0x44, 0x00, 0x1C, 0x35, 0x01, 0x4B, 0x00, 0x45, 0x00,
+    0x1F, 0x8C, 0x02, 0xE5, 0x00, 0x4D, 0x00, 0x11, 0x0A, 0x52, 0x00, 0x1F,
+    0x93, 0x01, 0x58, 0x00, 0x59, 0x00, 0x10, 0x4D, 0x01, 0x58, 0x00, 0x41,
+    0x00, 0x1F, 0xA5, 0x01, 0x43, 0x00, 0x52, 0x00, 0x00, 0xF9, 0x01, 0x43,
+    0x00, 0x45, 0x00, 0x1F, 0xB3, 0x01, 0x43, 0x00, 0x48, 0x00, 0x1F, 0xBA,
+    0x01, 0x43, 0x00, 0x54, 0x00, 0x1F, 0xC1, 0x01, 0x43, 0x00, 0x45, 0x00,
+    0x1F, 0xC8, 0x80, 0x57, 0xFF, 0x01, 0x57, 0x00, 0x57, 0x00, 0x1F, 0xD6,
+    0x01, 0x57, 0x00, 0x4F, 0x00, 0x1F, 0xD9, 0x01, 0x57, 0x00, 0x52, 0x00,
+    0x1F, 0xE0, 0x01, 0x57, 0x00, 0x52, 0x00, 0x1F, 0xE7, 0x01, 0x57, 0x00,
+    0x4F, 0x00, 0x1F, 0xEE, 0x01, 0x57, 0x00, 0x54, 0x00, 0x1F, 0xD6, 0x01,
+    0x57, 0x00, 0x48, 0x00, 0x1F, 0xFC, 0x01, 0x57, 0x00, 0x47, 0x00, 0x20,
+    0x03, 0x01, 0x57, 0x00, 0x49, 0x00, 0x20, 0x0A, 0x01, 0xC6, 0x00, 0x4B,
+    0x00, 0x04, 0xDE, 0x01, 0x83, 0x00, 0x4E, 0x00, 0x19, 0xB1, 0x87, 0xFF,
+    0xFF, 0x44, 0x00, 0x1F, 0xAC, 0x47, 0x00, 0x1F, 0xCF, 0x4D, 0x00, 0x1F,
+    0xF5, 0x4E, 0x00, 0x20, 0x11, 0x4F, 0x00, 0x20, 0x18, 0x50, 0x00, 0x03,
+    0xCB, 0x57, 0x00, 0x20, 0x1F, 0x01, 0x61, 0x00, 0x48, 0x00, 0x17, 0x43,
+    0x01, 0x61, 0x00, 0x54, 0x00, 0x20, 0x45, 0x03, 0x64, 0x00, 0x45, 0x00,
+    0x1C, 0xC8, 0x55, 0x00, 0x20, 0x4C, 0x59, 0x00, 0x10, 0x9D, 0x01, 0xD6,
+    0x00, 0x4F, 0x00, 0x0E, 0x4D, 0x01, 0x66, 0x00, 0x45, 0x00, 0x06, 0x07,
+    0x01, 0x66, 0x00, 0x50, 0x00, 0x20, 0x69, 0x08, 0xFF, 0x02, 0x41, 0x00,
+    0x1E, 0x67, 0x45, 0x00, 0x1E, 0xC7, 0x48, 0x00, 0x1F, 0x75, 0x49, 0x00,
+    0x1F, 0x9A, 0x4F, 0x00, 0x20, 0x26, 0x52, 0x00, 0x20, 0x53, 0x57, 0x00,
+    0x20, 0x62, 0x59, 0x00, 0x20, 0x70, 0x80, 0x16, 0xFF, 0x01, 0x16, 0x00,
+    0x44, 0x00, 0x20, 0x9A, 0x01, 0x16, 0x00, 0x4E, 0x00, 0x20, 0x9D, 0x01,
+    0x16, 0x00, 0x41, 0x00, 0x20, 0xA4, 0x01, 0x16, 0x00, 0x54, 0x00, 0x20,
+    0xAB, 0x81, 0x3F, 0xFF, 0x53, 0x00, 0x20, 0xB2, 0x01, 0x3F, 0x00, 0x52,
+    0x00, 0x20, 0xB9, 0x01, 0x3F, 0x00, 0x45, 0x00, 0x20, 0xC0, 0x01, 0x41,
+    0x00, 0x4C, 0x00, 0x08, 0xD1, 0x01, 0x41, 0x00, 0x49, 0x00, 0x20, 0xCE,
+    0x02, 0x41, 0x01, 0x44, 0x00, 0x20, 0xC7, 0x54, 0x00, 0x20, 0xD5, 0x80,
+    0xEB, 0xFF, 0x81, 0xD7, 0x00, 0x45, 0x00, 0x00, 0x92, 0x03, 0xEB, 0x01,
+    0x4E, 0x00, 0x20, 0xDC, 0x50, 0x00, 0x20, 0xE7, 0x53, 0x00, 0x20, 0xEA,
+    0x01, 0x81, 0x00, 0x55, 0x00, 0x07, 0xF1, 0x01, 0x81, 0x00, 0x4C, 0x00,
+    0x21, 0x00, 0x01, 0xC3, 0x00, 0x59, 0x00, 0x13, 0x45, 0x01, 0xC3, 0x00,
+    0x52, 0x00, 0x21, 0x0E, 0x80, 0x84, 0xFF, 0x01, 0x84, 0x00, 0x57, 0x00,
+    0x21, 0x1C, 0x01, 0x84, 0x00, 0x45, 0x00, 0x21, 0x1F, 0x01, 0x88, 0x00,
+    0x45, 0x00, 0x10, 0xF6, 0x01, 0x88, 0x00, 0x43, 0x00, 0x21, 0x2D, 0x01,
+    0x88, 0x00, 0x49, 0x00, 0x21, 0x34, 0x04, 0xC3, 0x01, 0x41, 0x00, 0x21,
+    0x07, 0x45, 0x00, 0x21, 0x15, 0x49, 0x00, 0x21, 0x26, 0x4F, 0x00, 0x21,
+    0x3B, 0x01, 0x54, 0x00, 0x54, 0x00, 0x1D, 0x66, 0x80, 0x11, 0xFF, 0x02,
+    0x6C, 0x01, 0x4B, 0x00, 0x21, 0x5C, 0x4C, 0x00, 0x16, 0x1B, 0x80, 0xD2,
+    0xFF, 0x01, 0xD2, 0x00, 0x54, 0x00, 0x21, 0x6A, 0x80, 0xCD, 0xFF, 0x01,
+    0x16, 0x00, 0x48, 0x00, 0x20, 0x9A, 0x01, 0xB7, 0x00, 0x52, 0x00, 0x1A,
+    0xCF, 0x02, 0xB7, 0x01, 0x43, 0x00, 0x21, 0x77, 0x45, 0x00, 0x21, 0x7E,
+    0x80, 0xD3, 0xFF, 0x07, 0xD3, 0x06, 0x49, 0x00, 0x21, 0x55, 0x4C, 0x00,
+    0x21, 0x5F, 0x4E, 0x00, 0x21, 0x6D, 0x52, 0x00, 0x02, 0x13, 0x53, 0x00,
+    0x21, 0x74, 0x54, 0x00, 0x21, 0x85, 0x59, 0x00, 0x21, 0x90, 0x01, 0xBC,
+    0x00, 0x4B, 0x00, 0x05, 0xF6, 0x01, 0xD4, 0x00, 0x4C, 0x00, 0x0B, 0x57,
+    0x01, 0xC8, 0x00, 0x54, 0x00, 0x1B, 0x22, 0x01, 0xCC, 0x00, 0x45, 0x00,
+    0x0D, 0x65, 0x84, 0xF3, 0xFF, 0x45, 0x00, 0x21, 0xB2, 0x4C, 0x00, 0x21,
+    0xB9, 0x4E, 0x00, 0x21, 0xC0, 0x52, 0x00, 0x21, 0xC7, 0x80, 0xEC, 0xFF,
+    0x01, 0xEC, 0x00, 0x54, 0x00, 0x21, 0xE1, 0x80, 0xE7, 0xFF, 0x80, 0xC4,
+    0xFF, 0x01, 0xC4, 0x00, 0x45, 0x00, 0x21, 0xEE, 0x02, 0xE7, 0x00, 0x4E,
+    0x00, 0x21, 0xEB, 0x52, 0x00, 0x21, 0xF1, 0x80, 0xE8, 0xFF, 0x01, 0xE8,
+    0x00, 0x48, 0x00, 0x22, 0x03, 0x01, 0x41, 0x00, 0x45, 0x00, 0x08, 0xD1,
+    0x02, 0xE8, 0x00, 0x43, 0x00, 0x22, 0x06, 0x4C, 0x00, 0x22, 0x0D, 0x05,
+    0xEC, 0x00, 0x41, 0x00, 0x21, 0xE4, 0x45, 0x00, 0x21, 0xF8, 0x49, 0x00,
+    0x22, 0x14, 0x4F, 0x00, 0x0C, 0x47, 0x59, 0x00, 0x21, 0xEE, 0x01, 0x87,
+    0x00, 0x45, 0x00, 0x17, 0x27, 0x80, 0xF0, 0xFF, 0x01, 0xF0, 0x00, 0x4C,
+    0x00, 0x22, 0x3D, 0x01, 0x62, 0x00, 0x57, 0x00, 0x0A, 0x17, 0x01, 0x62,
+    0x00, 0x4F, 0x00, 0x22, 0x47, 0x81, 0x62, 0x00, 0x44, 0x00, 0x22, 0x4E,
+    0x80, 0xF9, 0xFF, 0x01, 0xF9, 0x00, 0x48, 0x00, 0x22, 0x5C, 0x04, 0xF9,
+    0x03, 0x46, 0x00, 0x22, 0x36, 0x4C, 0x00, 0x22, 0x40, 0x4E, 0x00, 0x22,
+    0x55, 0x54, 0x00, 0x22, 0x5F, 0x01, 0xC0, 0x00, 0x4E, 0x00, 0x05, 0x4D,
+    0x01, 0xC0, 0x00, 0x41, 0x00, 0x22, 0x79, 0x01, 0x6B, 0x00, 0x52, 0x00,
+    0x13, 0xD5, 0x81, 0xD5, 0xFF, 0x45, 0x00, 0x22, 0x87, 0x01, 0xBF, 0x00,
+    0x44, 0x00, 0x10, 0xEC, 0x80, 0x32, 0xFF, 0x02, 0x32, 0x00, 0x45, 0x00,
+    0x22, 0x9C, 0x54, 0x00, 0x22, 0x9C, 0x04, 0xD5, 0x01, 0x44, 0x00, 0x04,
+    0x65, 0x4B, 0x00, 0x22, 0x8E, 0x4C, 0x00, 0x22, 0x95, 0x53, 0x00, 0x22,
+    0x9F, 0x80, 0xEE, 0xFF, 0x01, 0xEE, 0x00, 0x44, 0x00, 0x22, 0xBD, 0x01,
+    0xEE, 0x00, 0x4C, 0x00, 0x22, 0xC0, 0x03, 0xEE, 0x02, 0x4D, 0x00, 0x22,
+    0x80, 0x52, 0x00, 0x22, 0xAA, 0x55, 0x00, 0x22, 0xC7, 0x01, 0x1C, 0x00,
+    0x45, 0x00, 0x0D, 0x49, 0x01, 0x1C, 0x00, 0x54, 0x00, 0x22, 0xDD, 0x01,
+    0x1C, 0x00, 0x49, 0x00, 0x22, 0xE4, 0x06, 0xF9, 0x03, 0x41, 0x00, 0x21,
+    0x93, 0x45, 0x00, 0x21, 0xCE, 0x48, 0x00, 0x22, 0x1F, 0x49, 0x00, 0x22,
+    0x66, 0x4F, 0x00, 0x22, 0xCE, 0x52, 0x00, 0x22, 0xEB, 0x01, 0xE1, 0x00,
+    0x52, 0x00, 0x0F, 0x4D, 0x01, 0x56, 0x00, 0x59, 0x00, 0x12, 0x20, 0x01,
+    0x56, 0x00, 0x41, 0x00, 0x23, 0x14, 0x01, 0x56, 0x00, 0x44, 0x00, 0x23,
+    0x1B, 0x01, 0x56, 0x00, 0x52, 0x00, 0x23, 0x22, 0x01, 0x56, 0x00, 0x45,
+    0x00, 0x23, 0x29, 0x81, 0x5C, 0xFF, 0x54, 0x00, 0x23, 0x30, 0x02, 0xE1,
+    0x00, 0x41, 0x00, 0x23, 0x0D, 0x53, 0x00, 0x23, 0x37, 0x01, 0x2D, 0x00,
+    0x47, 0x00, 0x15, 0x0A, 0x80, 0xE0, 0xFF, 0x82, 0xF7, 0xFF, 0x4E, 0x00,
+    0x23, 0x49, 0x52, 0x00, 0x23, 0x50, 0x01, 0xF7, 0x00, 0x55, 0x00, 0x23,
+    0x53, 0x02, 0xF7, 0x01, 0x45, 0x00, 0x23, 0x3E, 0x4F, 0x00, 0x23, 0x5E,
+    0x1A, 0xFF, 0x03, 0x37, 0x00, 0x00, 0x0B, 0x38, 0x00, 0x00, 0x12, 0x41,
+    0x00, 0x02, 0x67, 0x42, 0x00, 0x04, 0xB5, 0x43, 0x00, 0x07, 0x1A, 0x44,
+    0x00, 0x08, 0xF0, 0x45, 0x00, 0x0A, 0x8A, 0x46, 0x00, 0x0C, 0x1B, 0x47,
+    0x00, 0x0D, 0x1A, 0x48, 0x00, 0x0E, 0x63, 0x49, 0x00, 0x0F, 0x91, 0x4A,
+    0x00, 0x0F, 0xC4, 0x4B, 0x00, 0x10, 0x19, 0x4C, 0x00, 0x11, 0x95, 0x4D,
+    0x00, 0x13, 0x6B, 0x4E, 0x00, 0x14, 0x8D, 0x4F, 0x00, 0x15, 0xC3, 0x50,
+    0x00, 0x18, 0xC1, 0x51, 0x00, 0x19, 0x29, 0x52, 0x00, 0x1A, 0xF9, 0x53,
+    0x00, 0x1E, 0x26, 0x54, 0x00, 0x20, 0x77, 0x55, 0x00, 0x20, 0xF1, 0x56,
+    0x00, 0x21, 0x42, 0x57, 0x00, 0x22, 0xF2, 0x59, 0x00, 0x23, 0x65,
+};
+
+const size_t DICTIONARY_IMAGE_SIZE = sizeof(DICTIONARY_IMAGE);
@@ -0,0 +1,18 @@
+#ifndef HELLOWORLD_DICTIONARY_DATA_HPP
+#define HELLOWORLD_DICTIONARY_DATA_HPP
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * The image of the word completion dictionary, generated from
+ * tools/words.txt by tools/build_dictionary.py. Being const, it stays in
+ * flash and is read through the cache.
+ */
+extern const uint8_t DICTIONARY_IMAGE[];
+extern const size_t DICTIONARY_IMAGE_SIZE;
+
+
+#endif
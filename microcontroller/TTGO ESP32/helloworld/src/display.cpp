@@ -0,0 +1,228 @@
+#include "display.hpp"
+
+
+/**
+ * Width and height of a character of the built-in font at text size 1.
+ */
+static const int16_t CHAR_WIDTH = 6;
+static const int16_t CHAR_HEIGHT = 8;
+
+/**
+ * The largest text size a field can use; the line sprite is this tall.
+ */
+static const uint8_t MAX_TEXT_SIZE = 2;
+
+
+ScreenRenderer::ScreenRenderer(TFT_eSPI& tft)
+    : tft_(tft), line_(&tft), wanted_(), drawn_(), alert_(), alert_until_(0),
+      alert_shown_(false), total_bytes_(0), window_start_(0), window_bytes_(0),
+      bytes_per_second_(0)
+{
+}
+
+
+bool ScreenRenderer::begin()
+{
+    // One bit per pixel keeps the sprite small; it is expanded to 16-bit
+    // colour as it is pushed
+    line_.setColorDepth(1);
+    if (line_.createSprite(tft_.width(), CHAR_HEIGHT * MAX_TEXT_SIZE) == NULL)
+    {
+        return false;
+    }
+    line_.setBitmapColor(TFT_WHITE, TFT_BLACK);
+    return true;
+}
+
+
+void ScreenRenderer::setField(size_t field, int16_t x, int16_t y, uint8_t size,
+                              const char* text, bool cursor)
+{
+    if (field >= MAX_FIELDS)
+    {
+        return;
+    }
+
+    field_state& wanted = wanted_[field];
+    wanted.x = x;
+    wanted.y = y;
+    wanted.size = size > MAX_TEXT_SIZE ? MAX_TEXT_SIZE : size;
+
+    size_t length = strlen(text);
+    if (length > FIELD_CAPACITY)
+    {
+        length = FIELD_CAPACITY;
+    }
+    memcpy(wanted.text, text, length);
+    if (cursor)
+    {
+        wanted.text[length++] = '|';
+    }
+    wanted.text[length] = '\0';
+}
+
+
+void ScreenRenderer::clearField(size_t field)
+{
+    if (field < MAX_FIELDS)
+    {
+        wanted_[field].text[0] = '\0';
+    }
+}
+
+
+void ScreenRenderer::clearFields()
+{
+    for (size_t i = 0; i < MAX_FIELDS; i++)
+    {
+        clearField(i);
+    }
+}
+
+
+void ScreenRenderer::showAlert(const char* text, unsigned long now)
+{
+    strncpy(alert_, text, FIELD_CAPACITY);
+    alert_[FIELD_CAPACITY] = '\0';
+    alert_until_ = now + ALERT_MS;
+    alert_shown_ = true;
+}
+
+
+bool ScreenRenderer::isAlertShown(unsigned long now) const noexcept
+{
+    return alert_shown_ && (long)(alert_until_ - now) > 0;
+}
+
+
+bool ScreenRenderer::getAlertDelay(unsigned long now,
+                                   unsigned long& delay) const noexcept
+{
+    if (!alert_shown_)
+    {
+        return false;
+    }
+    delay = isAlertShown(now) ? alert_until_ - now : 0;
+    return true;
+}
+
+
+bool ScreenRenderer::render(unsigned long now)
+{
+    unsigned long total_bytes = total_bytes_;
+    if (alert_shown_ && !isAlertShown(now))
+    {
+        alert_shown_ = false;
+    }
+
+    for (size_t i = 0; i < MAX_FIELDS; i++)
+    {
+        // An alert takes the place of the first field and blanks the others
+        if (alert_shown_)
+        {
+            field_state alert = {10, 10, MAX_TEXT_SIZE, {}};
+            if (i == 0)
+            {
+                strcpy(alert.text, alert_);
+            }
+            renderField(drawn_[i], alert);
+        }
+        else
+        {
+            renderField(drawn_[i], wanted_[i]);
+        }
+    }
+
+    if (now - window_start_ >= 1000)
+    {
+        bytes_per_second_ = window_bytes_;
+        window_bytes_ = 0;
+        window_start_ = now;
+    }
+    return total_bytes_ != total_bytes;
+}
+
+
+unsigned long ScreenRenderer::getBytesPerSecond() const noexcept
+{
+    return bytes_per_second_;
+}
+
+
+unsigned long ScreenRenderer::getTotalBytes() const noexcept
+{
+    return total_bytes_;
+}
+
+
+void ScreenRenderer::renderField(field_state& drawn, const field_state& wanted)
+{
+    size_t drawn_length = strlen(drawn.text);
+    size_t wanted_length = strlen(wanted.text);
+
+    // A field that moved or changed size is cleared where it was and then
+    // drawn in full at its new place
+    if (drawn.x != wanted.x || drawn.y != wanted.y || drawn.size != wanted.size)
+    {
+        if (drawn_length > 0)
+        {
+            int32_t width = drawn_length * CHAR_WIDTH * drawn.size;
+            int32_t height = CHAR_HEIGHT * drawn.size;
+            tft_.fillRect(drawn.x, drawn.y, width, height, TFT_BLACK);
+            countPixels(width, height);
+        }
+        drawn.x = wanted.x;
+        drawn.y = wanted.y;
+        drawn.size = wanted.size;
+        drawn.text[0] = '\0';
+        drawn_length = 0;
+    }
+
+    // Only the columns from the first differing character up to the end of
+    // the longer text need to be pushed
+    size_t first = 0;
+    while (first < drawn_length && first < wanted_length &&
+           drawn.text[first] == wanted.text[first])
+    {
+        first++;
+    }
+    size_t last = drawn_length > wanted_length ? drawn_length : wanted_length;
+    if (first == last)
+    {
+        return;
+    }
+
+    int16_t char_width = CHAR_WIDTH * wanted.size;
+    int16_t height = CHAR_HEIGHT * wanted.size;
+    int32_t left = first * char_width;
+    int32_t right = last * char_width;
+    if (right > line_.width())
+    {
+        right = line_.width();
+    }
+    if (wanted.x + right > tft_.width())
+    {
+        right = tft_.width() - wanted.x;
+    }
+
+    if (left < right)
+    {
+        line_.fillSprite(TFT_BLACK);
+        line_.setTextSize(wanted.size);
+        line_.setTextColor(TFT_WHITE, TFT_BLACK);
+        line_.drawString(wanted.text, 0, 0);
+        line_.pushSprite(wanted.x + left, wanted.y, left, 0, right - left,
+                         height);
+        countPixels(right - left, height);
+    }
+
+    memcpy(drawn.text, wanted.text, wanted_length + 1);
+}
+
+
+void ScreenRenderer::countPixels(int32_t width, int32_t height)
+{
+    unsigned long bytes = (unsigned long)(width * height) * 2;
+    total_bytes_ += bytes;
+    window_bytes_ += bytes;
+}
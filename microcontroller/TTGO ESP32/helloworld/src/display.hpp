@@ -0,0 +1,127 @@
+#ifndef HELLOWORLD_DISPLAY_HPP
+#define HELLOWORLD_DISPLAY_HPP
+
+
+#include <TFT_eSPI.h>
+
+
+/**
+ * Draws the screen as a handful of text fields and only sends what changed
+ * over SPI. Each field is composed off-screen in a one-line sprite and only the
+ * columns that differ from what is already on the panel are pushed, so an idle
+ * screen costs no bus traffic at all.
+ *
+ * Fields are laid out in the built-in 6x8 font, which is scaled by the text
+ * size of the field. Text that runs past the right edge of the panel is cut
+ * off.
+ */
+class ScreenRenderer
+{
+public:
+    /**
+     * The number of text fields on the screen.
+     */
+    static const size_t MAX_FIELDS = 6;
+
+    /**
+     * The most characters a field holds, enough for a full line at text size 1.
+     */
+    static const size_t FIELD_CAPACITY = 40;
+
+    /**
+     * How long an alert covers the screen.
+     */
+    static const unsigned long ALERT_MS = 1000;
+
+    ScreenRenderer(TFT_eSPI& tft);
+
+    /**
+     * Allocates the line sprite. Must be called after the panel has been
+     * initialised and rotated. Returns false if there is not enough memory.
+     */
+    bool begin();
+
+    /**
+     * Sets the text of a field and where it is drawn. A cursor bar is drawn
+     * after the text if cursor is true. Nothing is drawn until render().
+     */
+    void setField(size_t field, int16_t x, int16_t y, uint8_t size,
+                  const char* text, bool cursor = false);
+
+    /**
+     * Empties a field. The area it covered is cleared by render().
+     */
+    void clearField(size_t field);
+
+    /**
+     * Empties all fields.
+     */
+    void clearFields();
+
+    /**
+     * Covers the screen with a one-line alert for ALERT_MS from the time. The
+     * fields are drawn again once the alert has passed.
+     */
+    void showAlert(const char* text, unsigned long now);
+
+    /**
+     * Returns true while an alert covers the screen.
+     */
+    bool isAlertShown(unsigned long now) const noexcept;
+
+    /**
+     * Sets delay to the milliseconds from the time until render() removes the
+     * alert, zero if it has passed but is still drawn. Returns false if there
+     * is no alert to remove.
+     */
+    bool getAlertDelay(unsigned long now, unsigned long& delay) const noexcept;
+
+    /**
+     * Pushes the parts of the screen that changed since the last call. Returns
+     * true if anything was pushed.
+     */
+    bool render(unsigned long now);
+
+    /**
+     * Returns the number of bytes pushed over SPI during the last full second.
+     */
+    unsigned long getBytesPerSecond() const noexcept;
+
+    /**
+     * Returns the number of bytes pushed over SPI since begin().
+     */
+    unsigned long getTotalBytes() const noexcept;
+
+private:
+    struct field_state {
+        int16_t x;
+        int16_t y;
+        uint8_t size;
+        char text[FIELD_CAPACITY + 2]; // room for the cursor and terminator
+    };
+
+    /**
+     * Brings the field on the panel up to date with the wanted state.
+     */
+    void renderField(field_state& drawn, const field_state& wanted);
+
+    /**
+     * Counts pixels pushed to the panel at two bytes each.
+     */
+    void countPixels(int32_t width, int32_t height);
+
+    TFT_eSPI& tft_;
+    TFT_eSprite line_;
+    field_state wanted_[MAX_FIELDS];
+    field_state drawn_[MAX_FIELDS];
+    char alert_[FIELD_CAPACITY + 1];
+    unsigned long alert_until_;
+    bool alert_shown_;
+    unsigned long total_bytes_;
+    unsigned long window_start_;
+    unsigned long window_bytes_;
+    unsigned long bytes_per_second_;
+};
+
+
+#endif
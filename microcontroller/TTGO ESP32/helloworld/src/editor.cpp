@@ -0,0 +1,135 @@
+#include "editor.hpp"
+
+#include <string.h>
+
+
+MessageEditor::MessageEditor()
+    : letter_(), message_()
+{
+}
+
+
+bool MessageEditor::addElement(bool dash)
+{
+    return letter_.append(dash ? '-' : '.');
+}
+
+
+MessageEditor::letter_result MessageEditor::closeLetter()
+{
+    if (letter_.empty())
+    {
+        return message_.append(' ') ? SPACE_ADDED : MESSAGE_FULL;
+    }
+
+    // Look up the letter in the compile-time decoding table
+    const char* letter = morseDecode(morseFromString(letter_.c_str()));
+    if (letter == nullptr)
+    {
+        return LETTER_INVALID;
+    }
+
+    letter_.clear();
+    return message_.append(letter) ? LETTER_ADDED : MESSAGE_FULL;
+}
+
+
+bool MessageEditor::addWordSpace()
+{
+    size_t length = message_.length();
+    if (length == 0 || message_.c_str()[length - 1] == ' ')
+    {
+        return false;
+    }
+    return message_.append(' ');
+}
+
+
+bool MessageEditor::addText(const char* text)
+{
+    return message_.append(text);
+}
+
+
+const char* MessageEditor::getLastWord() const
+{
+    const char* message = message_.c_str();
+    const char* space = strrchr(message, ' ');
+    return space == nullptr ? message : space + 1;
+}
+
+
+const char* MessageEditor::getRecentWord(size_t& length) const
+{
+    const char* message = message_.c_str();
+    size_t end = message_.length();
+    if (end > 0 && message[end - 1] == ' ')
+    {
+        end--;
+    }
+    size_t start = end;
+    while (start > 0 && message[start - 1] != ' ')
+    {
+        start--;
+    }
+    length = end - start;
+    return message + start;
+}
+
+
+bool MessageEditor::completeWord(const char* completion)
+{
+    // The completion goes before the space that closed the word, if any
+    size_t length = message_.length();
+    bool closed = length > 0 && message_.c_str()[length - 1] == ' ';
+    if (closed)
+    {
+        message_.removeLast();
+    }
+    if (!message_.append(completion))
+    {
+        if (closed)
+        {
+            message_.append(' ');
+        }
+        return false;
+    }
+    addWordSpace();
+    return true;
+}
+
+
+void MessageEditor::removeElement()
+{
+    letter_.removeLast();
+}
+
+
+void MessageEditor::removeCharacter()
+{
+    message_.removeLast();
+}
+
+
+void MessageEditor::clearMessage()
+{
+    message_.clear();
+}
+
+
+const char* MessageEditor::getLetter() const
+{
+    return letter_.c_str();
+}
+
+
+const char* MessageEditor::getMessage() const
+{
+    return message_.c_str();
+}
+
+
+bool MessageEditor::hasElements() const
+{
+    return !letter_.empty();
+}
@@ -0,0 +1,103 @@
+#ifndef HELLOWORLD_EDITOR_HPP
+#define HELLOWORLD_EDITOR_HPP
+
+
+#include <stddef.h>
+
+#include "morse.hpp"
+#include "outbox.hpp"
+#include "text_buffer.hpp"
+
+
+/**
+ * The message being written: the Morse elements of the letter being keyed and
+ * the text decoded so far. The editor has no dependency on the board, so the
+ * decoding rules can be built and exercised on any host.
+ */
+class MessageEditor
+{
+public:
+    /**
+     * The longest message that can be written, which is the longest message
+     * the outbox can queue.
+     */
+    static const size_t MESSAGE_CAPACITY = Outbox::MESSAGE_CAPACITY;
+
+    enum letter_result {
+        LETTER_ADDED,
+        SPACE_ADDED,
+        LETTER_INVALID,
+        MESSAGE_FULL
+    };
+
+    MessageEditor();
+
+    /**
+     * Appends a dot or dash to the letter being keyed. Returns false if the
+     * letter is already as long as any symbol can be.
+     */
+    bool addElement(bool dash);
+
+    /**
+     * Decodes the letter being keyed and appends it to the message. A letter
+     * with no elements adds a space. An invalid letter is kept so that it can
+     * be corrected; otherwise the letter is cleared, even if the message was
+     * too full to take it.
+     */
+    letter_result closeLetter();
+
+    /**
+     * Appends a space between words, unless the message is empty or already
+     * ends with one. Returns true if a space was added.
+     */
+    bool addWordSpace();
+
+    /**
+     * Appends the text to the message, such as the completion of a word.
+     * Returns false and leaves the message unchanged if it does not fit.
+     */
+    bool addText(const char* text);
+
+    /**
+     * Returns the word at the end of the message, which is empty if the
+     * message is empty or ends with a space.
+     */
+    const char* getLastWord() const;
+
+    /**
+     * Returns the word at the end of the message and sets length to its
+     * length. Unlike getLastWord(), a word followed by a single space counts
+     * too, so it can still be completed after the pause that closed it.
+     */
+    const char* getRecentWord(size_t& length) const;
+
+    /**
+     * Appends the completion to the word returned by getRecentWord() and
+     * closes the word with a space. Returns false and leaves the message
+     * unchanged if it does not fit.
+     */
+    bool completeWord(const char* completion);
+
+    /**
+     * Removes the last element of the letter, or the last character of the
+     * message.
+     */
+    void removeElement();
+    void removeCharacter();
+
+    /**
+     * Empties the message, once it has been sent.
+     */
+    void clearMessage();
+
+    const char* getLetter() const;
+    const char* getMessage() const;
+    bool hasElements() const;
+
+private:
+    TextBuffer<MORSE_MAX_ELEMENTS> letter_;
+    TextBuffer<MESSAGE_CAPACITY> message_;
+};
+
+
+#endif
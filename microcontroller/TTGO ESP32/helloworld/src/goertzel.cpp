@@ -0,0 +1,90 @@
+#include "goertzel.hpp"
+
+#include <math.h>
+
+
+/**
+ * Fractional bits of the coefficient.
+ */
+static const int COEFFICIENT_SHIFT = 14;
+
+
+ToneDetector::ToneDetector(uint32_t sample_rate,
+                           uint32_t tone_hz,
+                           size_t block_size)
+    : coefficient_(0), block_size_(block_size), level_(0), on_(false)
+{
+    // The tone is measured in the bin nearest to it
+    uint32_t bin = (uint32_t)((uint64_t)block_size * tone_hz * 2 / sample_rate + 1) / 2;
+    double omega = 2.0 * M_PI * bin / block_size;
+    coefficient_ = (int32_t)lround(2.0 * cos(omega) * (1 << COEFFICIENT_SHIFT));
+}
+
+
+bool ToneDetector::process(const int16_t* samples) noexcept
+{
+    size_t n = block_size_;
+
+    // The mean is removed first so that the DC offset of the ADC counts
+    // neither as tone nor as power. These loops have no dependencies between
+    // iterations and are left for the compiler to unroll
+    int32_t sum = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        sum += samples[i];
+    }
+    int32_t mean = sum / (int32_t)n;
+
+    int64_t energy = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        int32_t x = samples[i] - mean;
+        energy += x * x;
+    }
+
+    // The Goertzel recurrence s = x + coefficient * s1 - s2
+    int32_t s1 = 0;
+    int32_t s2 = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        int32_t s = samples[i] - mean +
+                    (int32_t)(((int64_t)coefficient_ * s1) >> COEFFICIENT_SHIFT) -
+                    s2;
+        s2 = s1;
+        s1 = s;
+    }
+    int64_t power = (int64_t)s1 * s1 + (int64_t)s2 * s2 -
+                    ((((int64_t)coefficient_ * s1) >> COEFFICIENT_SHIFT) * s2);
+
+    // A pure tone of amplitude A has a bin power of (A * n / 2)^2 and a block
+    // power of A^2 * n / 2, so their ratio is scaled by n / 2 to make it 1
+    if (energy < (int64_t)MIN_AMPLITUDE * MIN_AMPLITUDE * (int64_t)n || power <= 0)
+    {
+        level_ = 0;
+    }
+    else
+    {
+        level_ = (uint32_t)((power << 9) / (energy * (int64_t)n));
+    }
+
+    on_ = level_ >= (on_ ? OFF_LEVEL : ON_LEVEL);
+    return on_;
+}
+
+
+bool ToneDetector::isOn() const noexcept
+{
+    return on_;
+}
+
+
+uint32_t ToneDetector::getLevel() const noexcept
+{
+    return level_;
+}
+
+
+size_t ToneDetector::getBlockSize() const noexcept
+{
+    return block_size_;
+}
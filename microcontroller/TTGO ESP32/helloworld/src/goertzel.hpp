@@ -0,0 +1,70 @@
+#ifndef HELLOWORLD_GOERTZEL_HPP
+#define HELLOWORLD_GOERTZEL_HPP
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * Detects a steady tone, such as a CW signal, in blocks of audio samples. The
+ * Goertzel algorithm measures the power of the single frequency bin nearest
+ * the tone, which is compared with the power of the whole block so that the
+ * detection does not depend on the volume. Hysteresis between the on and off
+ * levels keeps noise from chopping up a tone.
+ *
+ * All arithmetic is fixed point; the coefficient is the only floating point
+ * value and is computed once. The class does not depend on the Arduino core,
+ * so it can be run on recorded samples.
+ */
+class ToneDetector
+{
+public:
+    /**
+     * Tone levels are the power of the tone bin relative to the power of the
+     * block, in 1/256ths. A pure tone in the middle of the bin measures about
+     * 256.
+     */
+    static const uint32_t ON_LEVEL = 100;
+    static const uint32_t OFF_LEVEL = 50;
+
+    /**
+     * Blocks quieter than this root mean square amplitude are silence,
+     * whatever their spectrum.
+     */
+    static const int32_t MIN_AMPLITUDE = 8;
+
+    /**
+     * Creates a detector for the tone in blocks of the given number of
+     * samples. The bins are sample_rate / block_size wide, so the block sets
+     * both the bandwidth and the time resolution.
+     */
+    ToneDetector(uint32_t sample_rate, uint32_t tone_hz, size_t block_size);
+
+    /**
+     * Processes a block of getBlockSize() samples. Returns true if the tone
+     * is on after it.
+     */
+    bool process(const int16_t* samples) noexcept;
+
+    /**
+     * Returns true if the tone was on in the last block.
+     */
+    bool isOn() const noexcept;
+
+    /**
+     * Returns the tone level of the last block, see ON_LEVEL.
+     */
+    uint32_t getLevel() const noexcept;
+
+    size_t getBlockSize() const noexcept;
+
+private:
+    int32_t coefficient_; // 2cos(2*pi*bin/block_size) in Q14
+    size_t block_size_;
+    uint32_t level_;
+    bool on_;
+};
+
+
+#endif
@@ -0,0 +1,111 @@
+#include "heap_monitor.hpp"
+
+#include <Arduino.h>
+#include <Esp.h>
+#include <stdlib.h>
+
+
+/**
+ * The task whose allocations are counted, and the count. Allocations are only
+ * counted on that task, so the counter has a single writer.
+ */
+static volatile TaskHandle_t watched_task = NULL;
+static volatile uint32_t allocations = 0;
+
+
+static inline void countAllocation()
+{
+    if (watched_task != NULL && xTaskGetCurrentTaskHandle() == watched_task)
+    {
+        allocations = allocations + 1;
+    }
+}
+
+
+extern "C" {
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* pointer, size_t size);
+
+void* __wrap_malloc(size_t size)
+{
+    countAllocation();
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size)
+{
+    countAllocation();
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* pointer, size_t size)
+{
+    countAllocation();
+    return __real_realloc(pointer, size);
+}
+
+}
+
+
+HeapMonitor::HeapMonitor()
+    : loop_start_(0), loops_(0), last_loop_allocations_(0),
+      max_loop_allocations_(0), allocating_loops_(0)
+{
+}
+
+
+void HeapMonitor::watchCurrentTask()
+{
+    watched_task = xTaskGetCurrentTaskHandle();
+}
+
+
+void HeapMonitor::beginLoop() noexcept
+{
+    loop_start_ = allocations;
+}
+
+
+void HeapMonitor::endLoop() noexcept
+{
+    last_loop_allocations_ = allocations - loop_start_;
+    if (last_loop_allocations_ > max_loop_allocations_)
+    {
+        max_loop_allocations_ = last_loop_allocations_;
+    }
+    if (last_loop_allocations_ > 0)
+    {
+        allocating_loops_++;
+    }
+    loops_++;
+}
+
+
+uint32_t HeapMonitor::getAllocations() const noexcept
+{
+    return allocations;
+}
+
+
+HeapMonitor::heap_stats HeapMonitor::getStats() const
+{
+    heap_stats stats;
+    stats.free_heap = ESP.getFreeHeap();
+    stats.min_free_heap = ESP.getMinFreeHeap();
+    stats.largest_free_block = ESP.getMaxAllocHeap();
+    stats.loops = loops_;
+    stats.last_loop_allocations = last_loop_allocations_;
+    stats.max_loop_allocations = max_loop_allocations_;
+    stats.allocating_loops = allocating_loops_;
+    return stats;
+}
+
+
+void HeapMonitor::clearLoopStats() noexcept
+{
+    loops_ = 0;
+    max_loop_allocations_ = 0;
+    allocating_loops_ = 0;
+}
@@ -0,0 +1,68 @@
+#ifndef HELLOWORLD_HEAP_MONITOR_HPP
+#define HELLOWORLD_HEAP_MONITOR_HPP
+
+
+#include <stdint.h>
+
+
+/**
+ * Measures heap use of one task, meant to confirm that an iteration of the
+ * main loop does not allocate once the device is running.
+ *
+ * Allocations are counted by wrapping malloc, calloc and realloc at link time
+ * (see the --wrap flags in platformio.ini), which also catches the
+ * allocations made by operator new and Arduino Strings. Only the allocations
+ * made by the watched task are counted.
+ */
+class HeapMonitor
+{
+public:
+    struct heap_stats {
+        uint32_t free_heap;
+        uint32_t min_free_heap;
+        uint32_t largest_free_block;
+        uint32_t loops;
+        uint32_t last_loop_allocations;
+        uint32_t max_loop_allocations;
+        uint32_t allocating_loops;
+    };
+
+    HeapMonitor();
+
+    /**
+     * Counts the allocations made by the calling task from now on.
+     */
+    void watchCurrentTask();
+
+    /**
+     * Marks the start and the end of a loop iteration.
+     */
+    void beginLoop() noexcept;
+    void endLoop() noexcept;
+
+    /**
+     * Returns the number of allocations made by the watched task.
+     */
+    uint32_t getAllocations() const noexcept;
+
+    /**
+     * Returns the loop counters along with the current state of the heap.
+     */
+    heap_stats getStats() const;
+
+    /**
+     * Starts counting loops and allocating loops afresh, so that a report
+     * covers only the loops since the previous one.
+     */
+    void clearLoopStats() noexcept;
+
+private:
+    uint32_t loop_start_;
+    uint32_t loops_;
+    uint32_t last_loop_allocations_;
+    uint32_t max_loop_allocations_;
+    uint32_t allocating_loops_;
+};
+
+
+#endif
@@ -0,0 +1,142 @@
+#include "keyer.hpp"
+
+
+/**
+ * Break thresholds in units of silence after a release, halfway between the
+ * standard gaps so that uneven keying still lands on the right side.
+ */
+static const uint32_t DASH_THRESHOLD_UNITS = 2;
+static const uint32_t LETTER_THRESHOLD_UNITS = 2;
+static const uint32_t WORD_THRESHOLD_UNITS = 5;
+
+/**
+ * Presses longer than this many units are taken as a held key rather than a
+ * slow dash and do not change the estimate.
+ */
+static const uint32_t HELD_THRESHOLD_UNITS = 6;
+
+/**
+ * New samples move the estimate by a quarter of the difference.
+ */
+static const int32_t ADAPT_SHIFT = 2;
+
+
+MorseKeyer::MorseKeyer()
+    : unit_us_(INITIAL_UNIT_US), pressed_us_(0), released_us_(0), down_(false),
+      last_break_(WORD_BREAK)
+{
+}
+
+
+void MorseKeyer::press(uint32_t time_us) noexcept
+{
+    // A short gap since the last release separates elements of one letter,
+    // which is a unit long
+    if (last_break_ == NO_BREAK)
+    {
+        uint32_t gap_us = time_us - released_us_;
+        if (gap_us < LETTER_THRESHOLD_UNITS * unit_us_)
+        {
+            adapt(gap_us);
+        }
+    }
+
+    pressed_us_ = time_us;
+    down_ = true;
+}
+
+
+bool MorseKeyer::release(uint32_t time_us, bool& dash) noexcept
+{
+    if (!down_)
+    {
+        return false;
+    }
+    down_ = false;
+
+    uint32_t pressed_us = time_us - pressed_us_;
+    dash = pressed_us >= DASH_THRESHOLD_UNITS * unit_us_;
+    if (pressed_us < HELD_THRESHOLD_UNITS * unit_us_)
+    {
+        adapt(dash ? pressed_us / 3 : pressed_us);
+    }
+
+    released_us_ = time_us;
+    last_break_ = NO_BREAK;
+    return true;
+}
+
+
+MorseKeyer::keyer_break MorseKeyer::poll(uint32_t now_us) noexcept
+{
+    if (down_ || last_break_ == WORD_BREAK)
+    {
+        return NO_BREAK;
+    }
+
+    uint32_t silence_us = now_us - released_us_;
+    if (last_break_ == NO_BREAK &&
+        silence_us >= LETTER_THRESHOLD_UNITS * unit_us_)
+    {
+        last_break_ = LETTER_BREAK;
+        return LETTER_BREAK;
+    }
+    if (last_break_ == LETTER_BREAK &&
+        silence_us >= WORD_THRESHOLD_UNITS * unit_us_)
+    {
+        last_break_ = WORD_BREAK;
+        return WORD_BREAK;
+    }
+    return NO_BREAK;
+}
+
+
+bool MorseKeyer::getNextBreak(uint32_t now_us, uint32_t& delay_us) const noexcept
+{
+    if (down_ || last_break_ == WORD_BREAK)
+    {
+        return false;
+    }
+
+    uint32_t threshold_us = (last_break_ == NO_BREAK ? LETTER_THRESHOLD_UNITS
+                                                     : WORD_THRESHOLD_UNITS) *
+                            unit_us_;
+    uint32_t silence_us = now_us - released_us_;
+    delay_us = silence_us >= threshold_us ? 0 : threshold_us - silence_us;
+    return true;
+}
+
+
+void MorseKeyer::cancel() noexcept
+{
+    last_break_ = WORD_BREAK;
+}
+
+
+uint32_t MorseKeyer::getUnit() const noexcept
+{
+    return unit_us_;
+}
+
+
+uint32_t MorseKeyer::getWordsPerMinute() const noexcept
+{
+    // A minute holds 60000000 / (50 * unit) words
+    return 1200000 / unit_us_;
+}
+
+
+void MorseKeyer::adapt(uint32_t sample_us) noexcept
+{
+    int32_t difference = (int32_t)sample_us - (int32_t)unit_us_;
+    int32_t unit_us = (int32_t)unit_us_ + difference / (1 << ADAPT_SHIFT);
+    if (unit_us < (int32_t)MIN_UNIT_US)
+    {
+        unit_us = MIN_UNIT_US;
+    }
+    else if (unit_us > (int32_t)MAX_UNIT_US)
+    {
+        unit_us = MAX_UNIT_US;
+    }
+    unit_us_ = unit_us;
+}
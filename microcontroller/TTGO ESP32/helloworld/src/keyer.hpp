@@ -0,0 +1,101 @@
+#ifndef HELLOWORLD_KEYER_HPP
+#define HELLOWORLD_KEYER_HPP
+
+
+#include <stdint.h>
+
+
+/**
+ * Turns key presses into Morse elements and letter and word breaks, adapting
+ * to the speed of the operator.
+ *
+ * Standard Morse timing is measured in units: a dot is one unit long and a
+ * dash three, elements of a letter are one unit apart, letters three units and
+ * words seven. The keyer keeps a running estimate of the unit from the dots,
+ * dashes and element gaps it sees, classifies each press against it, and
+ * reports a letter or word break once the key has been up for long enough.
+ *
+ * All times are micros() values.
+ */
+class MorseKeyer
+{
+public:
+    enum keyer_break {
+        NO_BREAK,
+        LETTER_BREAK,
+        WORD_BREAK
+    };
+
+    /**
+     * The unit the keyer starts with, about 10 words per minute. Presses under
+     * 250 ms count as dots at this speed, which was the fixed threshold used
+     * before.
+     */
+    static const uint32_t INITIAL_UNIT_US = 125000;
+
+    /**
+     * The unit is kept between about 40 and 4 words per minute.
+     */
+    static const uint32_t MIN_UNIT_US = 30000;
+    static const uint32_t MAX_UNIT_US = 300000;
+
+    MorseKeyer();
+
+    /**
+     * Records that the key went down at the time.
+     */
+    void press(uint32_t time_us) noexcept;
+
+    /**
+     * Records that the key came up at the time and classifies the press. Sets
+     * dash to whether the press was a dash. Returns false if the key was not
+     * down.
+     */
+    bool release(uint32_t time_us, bool& dash) noexcept;
+
+    /**
+     * Returns the break reached since the last release as of the time. Each
+     * break is reported once: a letter break once the silence is closer to a
+     * letter gap than to an element gap, then a word break once it is closer
+     * to a word gap than to a letter gap.
+     */
+    keyer_break poll(uint32_t now_us) noexcept;
+
+    /**
+     * Sets delay to the microseconds from the time until poll() reports the
+     * next break, zero if it is already due. Returns false if no break is
+     * coming, while the key is down or after a word break.
+     */
+    bool getNextBreak(uint32_t now_us, uint32_t& delay_us) const noexcept;
+
+    /**
+     * Forgets the pending letter, so no break is reported for it.
+     */
+    void cancel() noexcept;
+
+    /**
+     * Returns the estimated length of a unit.
+     */
+    uint32_t getUnit() const noexcept;
+
+    /**
+     * Returns the estimated speed in words per minute, using the standard word
+     * PARIS of 50 units.
+     */
+    uint32_t getWordsPerMinute() const noexcept;
+
+private:
+    /**
+     * Moves the unit estimate towards the sample.
+     */
+    void adapt(uint32_t sample_us) noexcept;
+
+    uint32_t unit_us_;
+    uint32_t pressed_us_;
+    uint32_t released_us_;
+    bool down_;
+    keyer_break last_break_;
+};
+
+
+#endif
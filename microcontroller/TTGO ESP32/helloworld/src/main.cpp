@@ -3,11 +3,31 @@
 
 #include <WiFi.h>
 #include <WiFiManager.h>
-#include <HttpClient.h>
-#include <unordered_map>
 #include <TFT_eSPI.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <driver/gpio.h>
 
 #include "network.hpp"
+#include "network_task.hpp"
+#include "outbox.hpp"
+#include "preferences_storage.hpp"
+#include "poll_scheduler.hpp"
+#include "morse.hpp"
+#include "buttons.hpp"
+#include "display.hpp"
+#include "message_history.hpp"
+#include "editor.hpp"
+#include "heap_monitor.hpp"
+#include "keyer.hpp"
+#include "power_scheduler.hpp"
+#include "wifi_cache.hpp"
+#include "audio_input.hpp"
+#include "morse_player.hpp"
+#include "dictionary.hpp"
+#include "dictionary_data.hpp"
+#include "send_gesture.hpp"
+#include "trace.hpp"
 
 #define RECEIVE_BUTTON_PIN GPIO_NUM_33
 #define SEND_BUTTON_PIN    GPIO_NUM_25
@@ -18,64 +38,131 @@
 #define BUZZER_PIN         GPIO_NUM_12
 
 TFT_eSPI oled = TFT_eSPI();
+ScreenRenderer screen = ScreenRenderer(oled);
 uint8_t textSize = 2;
 
 //
 const char address[] = "[your ip address here]";
 short port = 5000;
+//Use the compact binary protocol instead of form data and JSON, see wire.hpp
+const bool use_binary_protocol = false;
+//Reuse the address leased on the first connection instead of asking DHCP on
+//every boot. Only enable this if the router keeps the lease for the device
+const bool use_static_ip = false;
+//Talk to the server over HTTPS, usually on port 443 or the port of
+//`make run-tls`. Only servers with a certificate signed by this CA are trusted,
+//see `make certs` in the server directory
+const bool use_tls = false;
+const char server_ca[] =
+  "-----BEGIN CERTIFICATE-----\n"
+  "[your ca certificate here]\n"
+  "-----END CERTIFICATE-----\n";
 ApplicationNetworkClient network = ApplicationNetworkClient(address, port);
-
-//deocoder variables
-const int NUM_CHAR = 26;
-static String morse[NUM_CHAR] = {".-", "-...", "-.-.", "-..", ".", "..-.", "--.", "....",
-"..", ".---", "-.-", ".-..", "--", "-.", "---", ".--.", "--.-",
-".-.", "...", "-", "..-", "...-", ".--", "-..-", "-.--", "--.."};
-static String letter[NUM_CHAR] = {"A", "B", "C", "D", "E", "F", "G", "H",
-"I", "J", "K", "L", "M", "N", "O", "P", "Q",
-"R", "S", "T", "U", "V", "W", "X", "Y", "Z"};
-struct Map {
-    String key;
-    String value;
-};
-struct Map decoder[NUM_CHAR]; 
-
-static String encoded_message;
-static String decoded_message;
+PreferencesOutboxStorage outbox_storage;
+Outbox outbox = Outbox(outbox_storage);
+NetworkTask network_task = NetworkTask(network, outbox);
+PollScheduler poll_scheduler;
+
+//The last WiFi connection, which later boots reconnect to without scanning.
+//The captive portal opens after WIFI_MAX_FAILURES boots in a row fail
+WifiCache wifi_cache;
+const uint8_t WIFI_MAX_FAILURES = 3;
+//How long a connection to the cached access point may take, first on its
+//channel and then after a scan in case it moved
+const unsigned long WIFI_FAST_TIMEOUT_MS = 3000;
+const unsigned long WIFI_SCAN_TIMEOUT_MS = 10000;
+//How long the portal waits to be configured before the device restarts
+const unsigned long WIFI_PORTAL_TIMEOUT_S = 180;
+
+//The letter being keyed and the message decoded so far
+static MessageEditor editor;
 //There's 3 modes, encode, decode, and read
 //encoding mode allows the user to write(write button), edit(undo button), and decode(send button)
 //the encoded message
 //decoded mode allows the user to edit(undo button) and send(send button) the decoded message
 //read mode allows the user to view received messages(read button)
-const String ENCODING = "encoding";
-const String DECODED = "decoded";
-const String READ = "read";
-static String mode = DECODED;
-static String prevMode = DECODED;
+enum ui_mode {
+  MODE_ENCODING,
+  MODE_DECODED,
+  MODE_READ
+};
+static ui_mode mode = MODE_DECODED;
+static ui_mode prevMode = MODE_DECODED;
 
+//The most likely completion of the last word of the decoded message, from
+//the dictionary in flash. Holding send accepts it, see SendGesture
+Dictionary dictionary = Dictionary(DICTIONARY_IMAGE, DICTIONARY_IMAGE_SIZE);
+char completion[Dictionary::MAX_DEPTH + 1] = "";
+SendGesture send_gesture;
+
+
+ButtonInput buttons;
+//Decode Morse heard as a tone on the audio input as well as keyed on the
+//write button. The microphone or line is wired to GPIO 36 (ADC1 channel 0)
+const bool use_audio_input = false;
+AudioInput audio_input = AudioInput(ADC1_CHANNEL_0);
+MessageHistory history;
 
 bool led_toggle = false;
-unsigned long last_pressed = millis();
-unsigned long last_released = millis();
-unsigned long last_LCD_update = millis();
-unsigned long last_message_check = millis();
+int pending_messages = 0;
+bool waiting_for_message = false;
+bool keying = false;
+//Received messages are played as Morse on the buzzer and LED when shown
+MorsePlayer player = MorsePlayer(BUZZER_PIN, LED_PIN);
+const bool play_received_messages = true;
+const uint32_t playback_wpm = 15;
+MorseKeyer keyer;
+//The | indicator of the line being edited blinks every BLINK_MS
+const unsigned long BLINK_MS = 500;
+
+//The loop sleeps until its next deadline or until a button edge or network
+//completion wakes it, see sleepUntilDeadline
+PowerScheduler power;
+//The interval the loop repeats at while it has work to retry, such as a poll
+//that could not be submitted, which was previously its fixed delay
+const unsigned long BUSY_INTERVAL_MS = 10;
+
+//Heap use of the loop is reported every HEAP_REPORT_MS
+HeapMonitor heap_monitor;
+const unsigned long HEAP_REPORT_MS = 10000;
+unsigned long last_heap_report = 0;
+//When the device became visible to the server and when WiFi connected, in
+//millis() after boot. Logged once at boot and again with every 'h' dump
+unsigned long visible_ms = 0;
+unsigned long wifi_ms = 0;
+
+//Time of the earliest button edge whose effect is not yet on the screen
+bool press_pending = false;
+uint32_t press_pending_us = 0;
 
 
 /**
  * Executes the connect to Wifi access point setup process for the
- * microcontroller. This process is blocking and will restart the device upon
- * failure to connect to an access point.
+ * microcontroller. The cached connection is tried first; the captive portal
+ * is only opened if there is none or it failed on the last few boots. This
+ * process is blocking and will restart the device upon failure to connect to
+ * an access point.
  */
 void setupWifi();
+bool connectCachedWifi(const WifiCache::wifi_config& config, bool fast);
+void saveWifi();
 void updateLCD();
 void decodeMessage();
-void buzzBuzzer();
-void writeAlert(String message);
+void writeAlert(const char* message);
 void checkMessages(bool override=false);
+void handleNetworkCompletions();
+bool readCachedMessage();
+void openHistory();
+void showSelectedMessage();
+void reportHeap();
+void updateCompletion();
+void setupPowerSaving();
+void sleepUntilDeadline();
 
 
 void setup()
 {
-  Serial.begin(9600);
+  Serial.begin(115200);
 
   //setup oled
   oled.init();
@@ -85,11 +172,41 @@ void setup()
 
   oled.fillScreen(TFT_BLACK);
   oled.drawString("Setting Up Wifi...", 10, 10);
-  setupWifi();  
+  setupWifi();
+  wifi_ms = millis();
   oled.fillScreen(TFT_BLACK);
+  if (!screen.begin()){
+    TRACE_ERROR("main", "Could not allocate the screen sprite.");
+  }
 
-  //register device with cloud
+  //register device with cloud, then hand the client over to the network task
+  if (use_binary_protocol){
+    network.setProtocol(ApplicationNetworkClient::BINARY_PROTOCOL);
+  }
+  if (use_tls){
+    network.setSecure(server_ca);
+  }
+  poll_scheduler.begin(millis());
   network.makeVisible();
+  visible_ms = millis();
+  TRACE_INFO("main", "Visible %lu ms after boot, WiFi connected after %lu ms",
+             visible_ms, wifi_ms);
+  if (network.getPendingCount() >= 0){
+    pending_messages = network.getPendingCount();
+    poll_scheduler.onPendingCount(millis(), network.getPendingCount(), true);
+  }
+  if (!outbox.begin(millis())){
+    TRACE_ERROR("main", "Could not open outbox storage.");
+  }
+  //The loop runs on the task that calls setup, and is woken by completions
+  network_task.setWakeTask(xTaskGetCurrentTaskHandle());
+  network_task.begin();
+
+  if (!dictionary.isValid()){
+    TRACE_ERROR("main", "The dictionary image is not valid.");
+  }
+  TRACE_INFO("main", "Dictionary uses %u bytes of flash and %u bytes of RAM",
+             (unsigned)DICTIONARY_IMAGE_SIZE, (unsigned)sizeof(dictionary));
 
   // setup GPIO pins
   pinMode(RECEIVE_BUTTON_PIN, PULLUP);
@@ -98,122 +215,216 @@ void setup()
   pinMode(UNDO_BUTTON_PIN, PULLUP);
   pinMode(LED_PIN, OUTPUT);
   pinMode(BUZZER_PIN, OUTPUT);
-
-  //initialize decoding map
-  for (int i=0; i<NUM_CHAR; i++){
-    struct Map map;
-    map.key = morse[i];
-    map.value = letter[i];
-    decoder[i] = map;
+  if (!player.begin()){
+    TRACE_ERROR("main", "Could not create the playback timer.");
+  }
+  player.setWordsPerMinute(playback_wpm);
+
+  buttons.setWakeTask(xTaskGetCurrentTaskHandle());
+  buttons.attach(RECEIVE_BUTTON_PIN);
+  buttons.attach(SEND_BUTTON_PIN);
+  buttons.attach(WRITE_BUTTON_PIN);
+  buttons.attach(UNDO_BUTTON_PIN);
+  setupPowerSaving();
+
+  if (use_audio_input){
+    audio_input.setWakeTask(xTaskGetCurrentTaskHandle());
+    if (!audio_input.begin()){
+      TRACE_ERROR("main", "Could not start the audio input.");
+    }
   }
-  
+
+  //The loop runs on the task that calls setup
+  heap_monitor.watchCurrentTask();
 }
 
 void loop()
 {
   // Serial.println("------------------------------");
-  if (!mode.equals(READ)){
+  uint32_t loop_start_us = micros();
+  heap_monitor.beginLoop();
+  if (mode != MODE_READ){
     updateLCD();
     checkMessages();
   }
-  led_toggle ? digitalWrite(LED_PIN, HIGH) : digitalWrite(LED_PIN, LOW);
-
-  unsigned long current_time = millis();
-
-  if (!digitalRead(WRITE_BUTTON_PIN))
+  handleNetworkCompletions();
+  //Messages already prefetched count as unread too
+  led_toggle = pending_messages > 0 || network_task.getCachedMessages() > 0;
+  player.setIdleLed(led_toggle);
+
+  //Handle the button edges captured by interrupt since the last iteration,
+  //in the order they happened
+  ButtonInput::button_event event;
+  while (buttons.poll(event))
   {
-    Serial.println("Write button pressed");
-    if (!mode.equals(READ)){
-      mode = ENCODING;
-      last_pressed = millis();
-      while(!digitalRead(WRITE_BUTTON_PIN)){
-        buzzBuzzer();
+    if (!press_pending){
+      press_pending = true;
+      press_pending_us = event.time_us;
+    }
+
+    if (event.pin == WRITE_BUTTON_PIN && event.pressed)
+    {
+      TRACE_DEBUG("main", "Write button pressed");
+      if (mode != MODE_READ){
+        mode = MODE_ENCODING;
+        keying = true;
+        player.setSidetone(true);
+        keyer.press(event.time_us);
       }
-      last_released = millis();
-      if (last_released-last_pressed < 250){
-        encoded_message.concat(".");
+      //In read mode the write button scrolls to older messages
+      else if (history.scrollOlder()){
+        showSelectedMessage();
       }
-      else if (last_released-last_pressed > 500){
-        encoded_message.concat("-");
+    }
+    else if (event.pin == WRITE_BUTTON_PIN && keying)
+    {
+      //The length of the press is measured between the interrupt timestamps
+      //and classified against the operator's own speed
+      keying = false;
+      player.setSidetone(false);
+      bool dash;
+      if (keyer.release(event.time_us, dash)){
+        editor.addElement(dash);
       }
     }
-    
-  }
 
-  if (!digitalRead(UNDO_BUTTON_PIN))
-  {
-    Serial.println("Undo button pressed");
-    while(!digitalRead(UNDO_BUTTON_PIN)){
-      updateLCD();
-      delay(10);
-    }
-    //remove last character in either decoded_message or encoded_message
-    if (mode.equals(DECODED)){
-      if (decoded_message.length() != 0){
-        decoded_message.remove(decoded_message.length()-1);
+    if (event.pin == UNDO_BUTTON_PIN && !event.pressed)
+    {
+      TRACE_DEBUG("main", "Undo button pressed");
+      //remove last character of either the message or the letter being keyed
+      switch (mode){
+        case MODE_DECODED:
+          editor.removeCharacter();
+          break;
+        case MODE_ENCODING:
+          editor.removeElement();
+          break;
+        case MODE_READ:
+          player.stop();
+          mode = prevMode;
+          updateLCD();
+          break;
       }
     }
-    else if (mode.equals(ENCODING)){
-      if (encoded_message.length() != 0){
-        encoded_message.remove(encoded_message.length()-1);
+
+    if (event.pin == SEND_BUTTON_PIN && event.pressed)
+    {
+      send_gesture.press(event.time_us, completion);
+    }
+    else if (event.pin == SEND_BUTTON_PIN)
+    {
+      TRACE_DEBUG("main", "Send button pressed");
+      SendGesture::gesture gesture = send_gesture.release(event.time_us);
+      //if you're currently editing the decoded message and press send, send message to the cloud
+      //if you're currently encoding a message and press send, proceed to decode the message
+      switch (mode){
+        case MODE_DECODED:
+          //Holding send accepts the completion offered when it went down
+          //instead of sending
+          if (gesture == SendGesture::ACCEPT){
+            if (!editor.completeWord(send_gesture.getCompletion())){
+              writeAlert("MESSAGE FULL");
+            }
+            updateLCD();
+            break;
+          }
+          //The outcome is shown when the network task completes the request,
+          //see handleNetworkCompletions
+          if (network_task.submit(NetworkTask::SEND, 0, editor.getMessage())){
+            editor.clearMessage();
+            poll_scheduler.onActivity(millis());
+          }
+          else{
+            writeAlert("BUSY");
+          }
+          updateLCD();
+          break;
+        case MODE_ENCODING:
+          decodeMessage();
+          break;
+        case MODE_READ:
+          //In read mode the send button scrolls back to newer messages
+          if (history.scrollNewer()){
+            showSelectedMessage();
+          }
+          break;
       }
     }
-    else if (mode.equals(READ)){
-      oled.fillScreen(TFT_BLACK);
-      mode = prevMode;
-      updateLCD;
+
+    if (event.pin == RECEIVE_BUTTON_PIN && event.pressed)
+    {
+      TRACE_DEBUG("main", "Receive button pressed");
+      //Prefetched messages are shown right away; otherwise the message is
+      //shown once the network task has fetched it
+      if (readCachedMessage()){
+        waiting_for_message = false;
+      }
+      else if (led_toggle == true){
+        waiting_for_message = true;
+        if (network_task.getInFlight(NetworkTask::FETCH) == 0){
+          network_task.submit(NetworkTask::FETCH, NetworkTask::PREFETCH_SIZE);
+        }
+      }
+      else{
+        writeAlert("NO MESSAGES");
+        //Messages already read can still be scrolled through
+        if (!history.empty()){
+          openHistory();
+        }
+        else{
+          if (mode == MODE_READ){
+            player.stop();
+            mode = prevMode;
+          }
+          updateLCD();
+        }
+      }
     }
   }
 
-  if (!digitalRead(SEND_BUTTON_PIN))
+  //Tones heard on the audio input are keyed like presses of the write
+  //button, without the buzzer
+  AudioInput::tone_event tone;
+  while (audio_input.poll(tone))
   {
-    Serial.println("Send button pressed");
-    while(!digitalRead(SEND_BUTTON_PIN)){
-      updateLCD();
-      delay(10);
+    if (mode == MODE_READ){
+      continue;
     }
-    //if you're currently editing the decoded message and press send, send message to the cloud
-    //if you're currently encoding a message and press send, proceed to decode the message
-    if (mode.equals(DECODED)){
-      network.sendMessage(decoded_message.c_str());
-      decoded_message = "";
-      writeAlert("SENT");
-      updateLCD();
+    if (tone.on){
+      mode = MODE_ENCODING;
+      keyer.press(tone.time_us);
     }
-    else if (mode.equals(ENCODING)){
-      decodeMessage();
+    else{
+      bool dash;
+      if (keyer.release(tone.time_us, dash)){
+        editor.addElement(dash);
+      }
     }
   }
 
-  if (!digitalRead(RECEIVE_BUTTON_PIN))
-  {
-    Serial.println("Receive button pressed");
-    if (led_toggle == true){
-      network.fetchPendingMessages(1);
-      struct ApplicationNetworkClient::message_map message = network.getFetchedMessages().at(0);
-      Serial.println(message.content);
-      oled.fillScreen(TFT_BLACK);
-      oled.drawString(message.content, 10, 10);
-      oled.setTextSize(1);
-      oled.drawString("From:", 10, 50);
-      oled.drawString(message.macAddress, 10, 60);
-      oled.drawString("When: ", 10, 80);
-      oled.drawString(message.time, 10, 90);
-      oled.setTextSize(textSize);
-
-      if (!mode.equals(READ)){
-        prevMode = mode;
+  //Letters and words are closed by the silence after the last element, so
+  //the send button is only needed to close a letter early. The breaks wait
+  //while send is held, so holding it does not close the word it completes
+  switch (send_gesture.isHeld() ? MorseKeyer::NO_BREAK : keyer.poll(micros())){
+    case MorseKeyer::LETTER_BREAK:
+      if (mode == MODE_ENCODING && editor.hasElements()){
+        decodeMessage();
+        TRACE_INFO("main", "Keying at %u WPM", keyer.getWordsPerMinute());
       }
-      mode = READ;
-      checkMessages(true);
-    }
-    else{
-      writeAlert("NO MESSAGES");
-      if (mode.equals(READ)){
-        mode = prevMode;
+      break;
+    case MorseKeyer::WORD_BREAK:
+      if (mode == MODE_DECODED){
+        editor.addWordSpace();
       }
-      updateLCD();
-    }
+      break;
+    case MorseKeyer::NO_BREAK:
+      break;
+  }
+
+  //Only the parts of the screen that changed are pushed to the display
+  if (screen.render(millis()) && press_pending){
+    traceLatency(TRACE_PRESS_TO_DISPLAY, micros() - press_pending_us);
+    press_pending = false;
   }
 
   // Serial.println("------------------------------");
@@ -221,110 +432,378 @@ void loop()
   // led_toggle ? digitalWrite(BUZZER_PIN, HIGH) : digitalWrite(BUZZER_PIN, LOW);
   // led_toggle = !led_toggle;
 
-  delay(10);
+  heap_monitor.endLoop();
+  traceLatency(TRACE_LOOP, micros() - loop_start_us);
+  //Reported outside of the measured part of the loop, as printing may allocate
+  if (millis() - last_heap_report >= HEAP_REPORT_MS){
+    reportHeap();
+  }
+  //Sending h over Serial dumps the boot timing and the latency histograms as
+  //CSV, whatever the trace level
+  if (Serial.available() > 0 && Serial.read() == 'h'){
+    Serial.printf("boot,visible_ms,%lu,wifi_ms,%lu\n", visible_ms, wifi_ms);
+    traceDump(Serial);
+  }
+
+  sleepUntilDeadline();
 }
 
-void buzzBuzzer() {
-  digitalWrite(BUZZER_PIN, HIGH);
-  digitalWrite(BUZZER_PIN, LOW);
+void sleepUntilDeadline(){
+  unsigned long current_time = millis();
+  power.begin(current_time);
+
+  //The cursor blinks and polls are made outside of read mode only. A poll
+  //in flight wakes the loop when it completes
+  if (mode != MODE_READ){
+    power.addDelay(BLINK_MS - current_time % BLINK_MS);
+    if (network_task.getInFlight(NetworkTask::COUNT) == 0){
+      power.addDelay(max(poll_scheduler.getDelay(current_time), BUSY_INTERVAL_MS));
+    }
+  }
+  unsigned long alert_delay;
+  if (screen.getAlertDelay(current_time, alert_delay)){
+    power.addDelay(alert_delay);
+  }
+  uint32_t break_delay_us;
+  if (!send_gesture.isHeld() && keyer.getNextBreak(micros(), break_delay_us)){
+    power.addDelay((break_delay_us + 999) / 1000);
+  }
+  power.addDeadline(last_heap_report + HEAP_REPORT_MS);
+
+  //Button edges and network completions notify the loop task, so it only
+  //blocks while nothing is left to do. The idle CPU enters light sleep if
+  //power management allows it, see setupPowerSaving
+  power.enter(PowerScheduler::BLOCKED, current_time);
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(power.getSleep()));
+  power.enter(PowerScheduler::ACTIVE, millis());
+  buttons.resync();
 }
 
 void decodeMessage(){
-  //empty encoded_message decodes into a whitespace
-  if (encoded_message.equals("")){
-    decoded_message.concat(" ");
-    mode = DECODED;
-  }
-  else{
-    bool decodable = false;
-    //Iterate through decoder mapping to decode message from morse code to letter.
-    for (int i = 0; i < NUM_CHAR; i++){
-      if (encoded_message.equals(decoder[i].key) ){
-        decoded_message.concat(decoder[i].value);
-        decodable = true;
-        encoded_message = "";
-        oled.fillScreen(TFT_BLACK);
-        updateLCD();
-        mode = DECODED;
-      }
-    }
-    //Write INVALID if encoded_message is unable to be decoded
-    if (!decodable){
+  //an empty letter decodes into a whitespace
+  switch (editor.closeLetter()){
+    case MessageEditor::LETTER_ADDED:
+    case MessageEditor::SPACE_ADDED:
+      break;
+    case MessageEditor::MESSAGE_FULL:
+      writeAlert("MESSAGE FULL");
+      break;
+    //Write INVALID if the letter is unable to be decoded, and keep encoding
+    case MessageEditor::LETTER_INVALID:
       writeAlert("INVALID");
       updateLCD();
-    }
+      return;
   }
+  mode = MODE_DECODED;
+  updateLCD();
 }
 
 void checkMessages(bool override){
   unsigned long current_time = millis();
-  if ((current_time - last_message_check > 5000 && led_toggle == false) || override){
-    int numMessages = network.countPendingMessages();
-    if (numMessages > 0){
-      led_toggle = true;
+  //Every response carries the pending count, so polls are only made when no
+  //other request has reported it recently
+  if (poll_scheduler.isDue(current_time) || override){
+    //led_toggle is updated when the count comes back, see handleNetworkCompletions
+    if (network_task.getInFlight(NetworkTask::COUNT) == 0 &&
+        network_task.submit(NetworkTask::COUNT)){
+      poll_scheduler.onPoll(current_time);
+      TRACE_DEBUG("main", "Polling every %lu ms",
+                  poll_scheduler.getInterval());
     }
-    else{
-      led_toggle = false;
+  }
+}
+
+void handleNetworkCompletions(){
+  NetworkTask::network_completion completion;
+  while (network_task.poll(completion)){
+    if (completion.pending >= 0){
+      pending_messages = completion.pending;
+      poll_scheduler.onPendingCount(millis(), completion.pending,
+                                    completion.type != NetworkTask::COUNT);
+    }
+    else if (completion.type == NetworkTask::COUNT){
+      pending_messages = completion.count;
+    }
+
+    if (completion.type == NetworkTask::SEND){
+      //Messages left in the outbox are retried by the network task
+      if (completion.count < 0){
+        writeAlert("OUTBOX FULL");
+      }
+      else{
+        writeAlert(completion.count == 0 ? "SENT" : "QUEUED");
+      }
+      updateLCD();
     }
-    last_message_check = current_time;
+    else if (completion.type == NetworkTask::FETCH && waiting_for_message){
+      //Stop waiting once the message is shown or there is nothing left to fetch
+      if (readCachedMessage() ||
+          network_task.getInFlight(NetworkTask::FETCH) == 0){
+        waiting_for_message = false;
+      }
+    }
+  }
+}
+
+bool readCachedMessage(){
+  ApplicationNetworkClient::message_map message;
+  if (!network_task.takeMessage(message)){
+    return false;
+  }
+
+  TRACE_DEBUG("main", "Received: %s", message.content.c_str());
+  //The message is copied into the history, which evicts the oldest when full
+  history.add(message.content.c_str(), message.macAddress.c_str(),
+              message.time.c_str());
+  openHistory();
+  poll_scheduler.onActivity(millis());
+  return true;
+}
+
+void openHistory(){
+  history.resetPosition();
+  showSelectedMessage();
+  if (mode != MODE_READ){
+    prevMode = mode;
+  }
+  mode = MODE_READ;
+}
+
+void showSelectedMessage(){
+  const MessageHistory::history_entry* message = history.getSelected();
+  if (message == NULL){
+    return;
   }
-  
 
+  //Position in the history, newest first
+  char position[12];
+  snprintf(position, sizeof(position), "%u/%u",
+           (unsigned)history.getPosition() + 1, (unsigned)history.size());
+
+  screen.setField(0, 10, 10, textSize, message->content);
+  screen.setField(1, 10, 50, 1, "From:");
+  screen.setField(2, 10, 60, 1, message->address);
+  screen.setField(3, 10, 80, 1, "When: ");
+  screen.setField(4, 10, 90, 1, message->time);
+  screen.setField(5, 10, 115, 1, position);
+
+  //Playback runs on its own timer, so the loop carries on meanwhile
+  if (play_received_messages){
+    player.play(message->content);
+  }
 }
 
 void setupWifi()
 {
-  WiFiManager wifi_manager;
+  WifiCache::wifi_config config;
+  if (!wifi_cache.begin()){
+    TRACE_ERROR("main", "Could not open WiFi cache storage.");
+  }
+  else if (wifi_cache.load(config) &&
+           wifi_cache.getFailures() < WIFI_MAX_FAILURES){
+    //The access point may have moved to another channel, so a connection
+    //with a scan is tried before counting the boot as failed
+    if (connectCachedWifi(config, true) || connectCachedWifi(config, false)){
+      wifi_cache.clearFailures();
+      saveWifi();
+      TRACE_INFO("main", "Successfully connected to cached wifi network.");
+      return;
+    }
 
-  // For debugging purposes only
-  wifi_manager.resetSettings();
+    uint8_t failures = wifi_cache.recordFailure();
+    TRACE_WARN("main", "Could not connect to cached wifi network (%u/%u), attempting to reboot.",
+               failures, WIFI_MAX_FAILURES);
+    ESP.restart();
+  }
+
+  WiFiManager wifi_manager;
+  wifi_manager.setConfigPortalTimeout(WIFI_PORTAL_TIMEOUT_S);
 
   const char* access_point_name = "Christian hello hello";
   const char* access_point_password = "helloworld";
 
-  bool result = wifi_manager.autoConnect(
-    access_point_name,
-    access_point_password
-  );
+  //After repeated failures the credentials the WiFi driver keeps are likely
+  //wrong too, so the portal is opened instead of trying them again
+  bool result;
+  if (wifi_cache.getFailures() >= WIFI_MAX_FAILURES){
+    result = wifi_manager.startConfigPortal(
+      access_point_name,
+      access_point_password
+    );
+  }
+  else{
+    result = wifi_manager.autoConnect(
+      access_point_name,
+      access_point_password
+    );
+  }
 
   if (!result)
   {
-    // Serial.println("Could not connect to wifi network, attempting to reboot.");
+    //The cached network gets another round of attempts after the reboot, in
+    //case it was only down
+    wifi_cache.clearFailures();
+    TRACE_WARN("main", "Could not connect to wifi network, attempting to reboot.");
     ESP.restart();
   }
 
-  Serial.println("Successfully connected to wifi network.");
+  wifi_cache.clearFailures();
+  saveWifi();
+  TRACE_INFO("main", "Successfully connected to wifi network.");
 }
 
-void updateLCD(){
-  unsigned long current_time = millis();
-  //Updates messages and blinks | indicator every half second
-  if (current_time - last_LCD_update < 500){
-      oled.drawString(encoded_message+"| ", 10, 10);
-      oled.drawString(decoded_message+"| ", 10, 80);
-  }
-  else if (current_time - last_LCD_update >= 500){
-    if (mode.equals(DECODED)){
-      oled.drawString(encoded_message+"| ", 10, 10);
-      oled.drawString(decoded_message+" ", 10, 80);
-    }
-    else if (mode.equals(ENCODING)){
-      oled.drawString(encoded_message+" ", 10, 10);
-      oled.drawString(decoded_message+"| ", 10, 80);
+bool connectCachedWifi(const WifiCache::wifi_config& config, bool fast){
+  //The connection is cached by this firmware, so the driver does not need to
+  //write it to flash again
+  WiFi.persistent(false);
+  WiFi.mode(WIFI_STA);
+  if (config.static_ip){
+    WiFi.config(IPAddress(config.ip), IPAddress(config.gateway),
+                IPAddress(config.subnet), IPAddress(config.dns));
+  }
+  //The fast attempt skips the scan by naming the channel and access point
+  if (fast){
+    WiFi.begin(config.ssid, config.password, config.channel, config.bssid);
+  }
+  else{
+    WiFi.begin(config.ssid, config.password);
+  }
+
+  unsigned long start = millis();
+  unsigned long timeout = fast ? WIFI_FAST_TIMEOUT_MS : WIFI_SCAN_TIMEOUT_MS;
+  while (WiFi.status() != WL_CONNECTED){
+    if (millis() - start >= timeout){
+      WiFi.disconnect();
+      return false;
     }
+    delay(10);
+  }
+  return true;
+}
 
+void saveWifi(){
+  //Zeroed so the padding compares equal and unchanged connections are not
+  //written again, see WifiCache::save
+  WifiCache::wifi_config config;
+  memset(&config, 0, sizeof(config));
+  strncpy(config.ssid, WiFi.SSID().c_str(), sizeof(config.ssid) - 1);
+  strncpy(config.password, WiFi.psk().c_str(), sizeof(config.password) - 1);
+  const uint8_t* bssid = WiFi.BSSID();
+  if (bssid != NULL){
+    memcpy(config.bssid, bssid, sizeof(config.bssid));
   }
-  if (current_time - last_LCD_update > 1000){
-    last_LCD_update = current_time;
+  config.channel = WiFi.channel();
+  if (use_static_ip){
+    config.static_ip = true;
+    config.ip = WiFi.localIP();
+    config.gateway = WiFi.gatewayIP();
+    config.subnet = WiFi.subnetMask();
+    config.dns = WiFi.dnsIP();
   }
 
+  if (!wifi_cache.save(config)){
+    TRACE_WARN("main", "Could not cache the wifi network.");
+  }
 }
 
-void writeAlert(String message){
-  oled.fillScreen(TFT_BLACK);
-  oled.drawString(message, 10, 10);
-  delay(1000);
-  oled.fillScreen(TFT_BLACK);
+void updateLCD(){
+  unsigned long current_time = millis();
+  //Blinks the | indicator of the line being edited every half second; the
+  //screen only pushes the columns that changed, see ScreenRenderer
+  bool blink_on = (current_time / BLINK_MS) % 2 == 0;
+  screen.setField(0, 10, 10, textSize, editor.getLetter(),
+                  blink_on || mode != MODE_ENCODING);
+  screen.setField(1, 10, 80, textSize, editor.getMessage(),
+                  blink_on || mode != MODE_DECODED);
+  screen.clearField(3);
+  screen.clearField(4);
+  screen.clearField(5);
+
+  //The completion is offered while the decoded message is edited
+  updateCompletion();
+  if (mode == MODE_DECODED && completion[0] != '\0'){
+    size_t length;
+    const char* word = editor.getRecentWord(length);
+    char hint[ScreenRenderer::FIELD_CAPACITY + 1];
+    snprintf(hint, sizeof(hint), "HOLD SEND: %.*s%s", (int)length, word,
+             completion);
+    screen.setField(2, 10, 115, 1, hint);
+  }
+  else{
+    screen.clearField(2);
+  }
+}
+
+void updateCompletion(){
+  //The dictionary only steps through the letters that changed, so this is
+  //cheap when nothing did. The word stays offered after the pause that
+  //closed it, until the next letter starts another
+  uint32_t start_us = micros();
+  size_t length;
+  const char* word = editor.getRecentWord(length);
+  if (!dictionary.setPrefix(word, length)){
+    return;
+  }
+  dictionary.getCompletion(completion, sizeof(completion));
+  traceLatency(TRACE_COMPLETION, micros() - start_us);
+}
+
+void writeAlert(const char* message){
+  //The alert covers the screen for a second without holding up the loop
+  screen.showAlert(message, millis());
+}
+
+void reportHeap(){
+#if TRACE_LEVEL >= TRACE_LEVEL_INFO
+  HeapMonitor::heap_stats stats = heap_monitor.getStats();
+  TRACE_INFO("heap", "%u free, %u min free, %u largest block",
+             stats.free_heap, stats.min_free_heap, stats.largest_free_block);
+  TRACE_INFO("heap", "%u of %u loop iterations allocated, at most %u times",
+             stats.allocating_loops, stats.loops, stats.max_loop_allocations);
+  TRACE_INFO("heap", "%u bytes of the network task stack never used",
+             network_task.getStackHighWaterMark());
+#endif
+  heap_monitor.clearLoopStats();
+  last_heap_report = millis();
+
+  //Blocked is the most the CPU could have been in light sleep, see
+  //PowerScheduler
+  TRACE_INFO("power", "%lu ms active, %lu ms blocked in %lu waits",
+             power.getTime(PowerScheduler::ACTIVE, last_heap_report),
+             power.getTime(PowerScheduler::BLOCKED, last_heap_report),
+             power.getBlocks());
+  TRACE_INFO("poll", "Polling every %lu ms, %lu polls, %lu counts piggybacked, "
+             "%ld requests/hour saved", poll_scheduler.getInterval(),
+             poll_scheduler.getPolls(), poll_scheduler.getPiggybacked(),
+             poll_scheduler.getSavedPerHour(last_heap_report));
+  TRACE_INFO("screen", "%lu bytes/s to the panel, %lu bytes in all",
+             screen.getBytesPerSecond(), screen.getTotalBytes());
+  if (use_audio_input){
+    TRACE_INFO("audio", "%u samples/s processed, %lu tone events dropped",
+               audio_input.getSamplesPerSecond(),
+               audio_input.getDroppedEvents());
+  }
+}
+
+void setupPowerSaving(){
+  //The radio sleeps between beacons of the access point
+  WiFi.setSleep(WIFI_PS_MIN_MODEM);
+
+  //The CPU enters light sleep whenever every task is blocked. This needs a
+  //core built with tickless idle; otherwise the loop still blocks instead of
+  //spinning. The frequency is not scaled, as the Arduino drivers don't
+  //follow changes of the APB clock
+  esp_pm_config_esp32_t pm_config = {240, 240, true};
+  esp_err_t result = esp_pm_configure(&pm_config);
+  if (result != ESP_OK){
+    TRACE_WARN("power", "Light sleep is not available (%d).", result);
+    return;
+  }
+
+  //Edge interrupts don't fire in light sleep, so the buttons interrupt and
+  //wake the CPU by level instead, see ButtonInput::enableWakeup
+  buttons.enableWakeup();
+  esp_sleep_enable_gpio_wakeup();
 }
 
 
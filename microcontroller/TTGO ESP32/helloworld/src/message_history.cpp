@@ -0,0 +1,113 @@
+#include "message_history.hpp"
+
+#include <string.h>
+
+
+/**
+ * Copies the string into the buffer, truncating it to fit.
+ */
+static void copyField(char* buffer, size_t size, const char* value)
+{
+    strncpy(buffer, value != NULL ? value : "", size - 1);
+    buffer[size - 1] = '\0';
+}
+
+
+MessageHistory::MessageHistory()
+    : entries_(), newest_(CAPACITY - 1), size_(0), position_(0), evicted_(0)
+{
+}
+
+
+void MessageHistory::add(const char* content, const char* address,
+                         const char* time)
+{
+    newest_ = (newest_ + 1) % CAPACITY;
+    history_entry& entry = entries_[newest_];
+    copyField(entry.content, sizeof(entry.content), content);
+    copyField(entry.address, sizeof(entry.address), address);
+    copyField(entry.time, sizeof(entry.time), time);
+
+    if (size_ < CAPACITY)
+    {
+        size_++;
+    }
+    else
+    {
+        evicted_++;
+    }
+
+    // Keep the same message selected unless it was the one evicted
+    if (size_ > 1 && position_ + 1 < size_)
+    {
+        position_++;
+    }
+}
+
+
+const MessageHistory::history_entry* MessageHistory::get(size_t index) const noexcept
+{
+    if (index >= size_)
+    {
+        return NULL;
+    }
+    return &entries_[(newest_ + CAPACITY - index) % CAPACITY];
+}
+
+
+const MessageHistory::history_entry* MessageHistory::getSelected() const noexcept
+{
+    return get(position_);
+}
+
+
+size_t MessageHistory::getPosition() const noexcept
+{
+    return position_;
+}
+
+
+void MessageHistory::resetPosition() noexcept
+{
+    position_ = 0;
+}
+
+
+bool MessageHistory::scrollOlder() noexcept
+{
+    if (position_ + 1 >= size_)
+    {
+        return false;
+    }
+    position_++;
+    return true;
+}
+
+
+bool MessageHistory::scrollNewer() noexcept
+{
+    if (position_ == 0)
+    {
+        return false;
+    }
+    position_--;
+    return true;
+}
+
+
+size_t MessageHistory::size() const noexcept
+{
+    return size_;
+}
+
+
+bool MessageHistory::empty() const noexcept
+{
+    return size_ == 0;
+}
+
+
+uint32_t MessageHistory::getEvicted() const noexcept
+{
+    return evicted_;
+}
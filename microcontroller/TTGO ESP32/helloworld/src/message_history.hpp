@@ -0,0 +1,96 @@
+#ifndef HELLOWORLD_MESSAGE_HISTORY_HPP
+#define HELLOWORLD_MESSAGE_HISTORY_HPP
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "outbox.hpp"
+
+
+/**
+ * The most recently received messages, kept in a fixed ring of slots that is
+ * allocated with the object. Adding a message copies it into the slot of the
+ * oldest one once the history is full, so keeping and reading the history
+ * never touches the heap.
+ *
+ * The history has a position used for scrolling, counted from the newest
+ * message. The position follows the selected message as new ones arrive.
+ */
+class MessageHistory
+{
+public:
+    /**
+     * The number of messages kept.
+     */
+    static const size_t CAPACITY = 16;
+
+    /**
+     * The longest content, address and time kept, not counting the
+     * terminator. Longer values are truncated.
+     */
+    static const size_t CONTENT_CAPACITY = Outbox::MESSAGE_CAPACITY;
+    static const size_t ADDRESS_CAPACITY = 17;
+    static const size_t TIME_CAPACITY = 31;
+
+    struct history_entry {
+        char content[CONTENT_CAPACITY + 1];
+        char address[ADDRESS_CAPACITY + 1];
+        char time[TIME_CAPACITY + 1];
+    };
+
+    MessageHistory();
+
+    /**
+     * Adds a message as the newest, evicting the oldest if the history is
+     * full. The position is moved so the same message stays selected; if that
+     * message was evicted the oldest one is selected instead.
+     */
+    void add(const char* content, const char* address, const char* time);
+
+    /**
+     * Returns the message at the index counted from the newest, or NULL if
+     * there is no such message.
+     */
+    const history_entry* get(size_t index) const noexcept;
+
+    /**
+     * Returns the selected message, or NULL if the history is empty.
+     */
+    const history_entry* getSelected() const noexcept;
+
+    /**
+     * Returns the position of the selected message counted from the newest.
+     */
+    size_t getPosition() const noexcept;
+
+    /**
+     * Selects the newest message.
+     */
+    void resetPosition() noexcept;
+
+    /**
+     * Moves the selection one message older or newer. Returns false if there is
+     * no message in that direction.
+     */
+    bool scrollOlder() noexcept;
+    bool scrollNewer() noexcept;
+
+    size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    /**
+     * Returns the number of messages evicted to make room for new ones.
+     */
+    uint32_t getEvicted() const noexcept;
+
+private:
+    history_entry entries_[CAPACITY];
+    size_t newest_;
+    size_t size_;
+    size_t position_;
+    uint32_t evicted_;
+};
+
+
+#endif
@@ -0,0 +1,164 @@
+#include "morse.hpp"
+
+
+namespace {
+
+
+struct MorseEntry {
+    const char* elements;
+    const char* text;
+};
+
+
+/**
+ * The symbols understood by the decoder. Where a prosign shares its elements
+ * with a punctuation mark (AR and "+", BT and "=", KN and "("), the
+ * punctuation mark is used.
+ */
+constexpr MorseEntry ENTRIES[] = {
+    {".-", "A"}, {"-...", "B"}, {"-.-.", "C"}, {"-..", "D"}, {".", "E"},
+    {"..-.", "F"}, {"--.", "G"}, {"....", "H"}, {"..", "I"}, {".---", "J"},
+    {"-.-", "K"}, {".-..", "L"}, {"--", "M"}, {"-.", "N"}, {"---", "O"},
+    {".--.", "P"}, {"--.-", "Q"}, {".-.", "R"}, {"...", "S"}, {"-", "T"},
+    {"..-", "U"}, {"...-", "V"}, {".--", "W"}, {"-..-", "X"}, {"-.--", "Y"},
+    {"--..", "Z"},
+
+    {"-----", "0"}, {".----", "1"}, {"..---", "2"}, {"...--", "3"},
+    {"....-", "4"}, {".....", "5"}, {"-....", "6"}, {"--...", "7"},
+    {"---..", "8"}, {"----.", "9"},
+
+    {".-.-.-", "."}, {"--..--", ","}, {"..--..", "?"}, {".----.", "'"},
+    {"-.-.--", "!"}, {"-..-.", "/"}, {"-.--.", "("}, {"-.--.-", ")"},
+    {".-...", "&"}, {"---...", ":"}, {"-.-.-.", ";"}, {"-...-", "="},
+    {".-.-.", "+"}, {"-....-", "-"}, {"..--.-", "_"}, {".-..-.", "\""},
+    {"...-..-", "$"}, {".--.-.", "@"},
+
+    {"...-.-", "<SK>"}, {"-.-.-", "<KA>"}, {"...-.", "<SN>"},
+    {"........", "<HH>"}, {"...---...", "<SOS>"},
+};
+
+constexpr size_t NUM_ENTRIES = sizeof(ENTRIES) / sizeof(ENTRIES[0]);
+
+static_assert(NUM_ENTRIES < 255, "entry indices must fit in a byte");
+
+
+/**
+ * Maps every code to one plus the index of its entry, or 0 if the code has no
+ * entry. Built by the compiler and stored in flash.
+ */
+struct MorseTable {
+    uint8_t entry[MORSE_TABLE_SIZE];
+};
+
+
+constexpr MorseTable buildTable()
+{
+    MorseTable table = {};
+    for (size_t i = 0; i < NUM_ENTRIES; i++)
+    {
+        morse_code_t code = morseFromString(ENTRIES[i].elements);
+        table.entry[code] = (uint8_t)(i + 1);
+    }
+    return table;
+}
+
+
+constexpr bool entriesAreValidAndUnique()
+{
+    MorseTable seen = {};
+    for (size_t i = 0; i < NUM_ENTRIES; i++)
+    {
+        morse_code_t code = morseFromString(ENTRIES[i].elements);
+        if (code == MORSE_INVALID || code == MORSE_EMPTY || seen.entry[code])
+        {
+            return false;
+        }
+        seen.entry[code] = 1;
+    }
+    return true;
+}
+
+
+static_assert(entriesAreValidAndUnique(),
+              "Morse entries must be non-empty, valid and distinct");
+
+constexpr MorseTable TABLE = buildTable();
+
+
+/**
+ * Maps every 7-bit character to the code of the entry that decodes to it, or
+ * MORSE_INVALID. Lowercase letters share the codes of uppercase ones.
+ */
+struct MorseEncodeTable {
+    morse_code_t code[128];
+};
+
+
+constexpr MorseEncodeTable buildEncodeTable()
+{
+    MorseEncodeTable table = {};
+    for (size_t i = 0; i < NUM_ENTRIES; i++)
+    {
+        const char* text = ENTRIES[i].text;
+        if (text[0] == '\0' || text[1] != '\0')
+        {
+            continue;
+        }
+        morse_code_t code = morseFromString(ENTRIES[i].elements);
+        table.code[(uint8_t)text[0]] = code;
+        if (text[0] >= 'A' && text[0] <= 'Z')
+        {
+            table.code[(uint8_t)(text[0] - 'A' + 'a')] = code;
+        }
+    }
+    return table;
+}
+
+
+constexpr MorseEncodeTable ENCODE_TABLE = buildEncodeTable();
+
+
+} // namespace
+
+
+size_t morseToString(morse_code_t code, char* buffer, size_t size)
+{
+    size_t length = morseLength(code);
+    if (code == MORSE_INVALID || length + 1 > size)
+    {
+        if (size > 0)
+        {
+            buffer[0] = '\0';
+        }
+        return 0;
+    }
+
+    for (size_t i = length; i > 0; i--)
+    {
+        buffer[i - 1] = (code & 1) ? '-' : '.';
+        code >>= 1;
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+
+const char* morseDecode(morse_code_t code)
+{
+    if (code >= MORSE_TABLE_SIZE || TABLE.entry[code] == 0)
+    {
+        return nullptr;
+    }
+    return ENTRIES[TABLE.entry[code] - 1].text;
+}
+
+
+morse_code_t morseEncode(char character)
+{
+    uint8_t index = (uint8_t)character;
+    if (index >= sizeof(ENCODE_TABLE.code) / sizeof(ENCODE_TABLE.code[0]))
+    {
+        return MORSE_INVALID;
+    }
+    return ENCODE_TABLE.code[index];
+}
@@ -0,0 +1,113 @@
+#ifndef HELLOWORLD_MORSE_HPP
+#define HELLOWORLD_MORSE_HPP
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * A Morse symbol packed into an integer. The elements are stored as bits
+ * (dot = 0, dash = 1) below a leading 1 bit that marks the length of the
+ * symbol, so ".-" is 0b101 and the empty symbol is 0b1. Every symbol of up to
+ * MORSE_MAX_ELEMENTS elements therefore has a unique code smaller than
+ * MORSE_TABLE_SIZE, which lets a table be indexed by the code directly.
+ */
+typedef uint16_t morse_code_t;
+
+/**
+ * The code of a symbol with no elements.
+ */
+constexpr morse_code_t MORSE_EMPTY = 1;
+
+/**
+ * The code used for anything that is not a valid symbol.
+ */
+constexpr morse_code_t MORSE_INVALID = 0;
+
+/**
+ * The longest symbol that can be decoded (the SOS prosign).
+ */
+constexpr size_t MORSE_MAX_ELEMENTS = 9;
+
+/**
+ * The number of distinct codes of up to MORSE_MAX_ELEMENTS elements.
+ */
+constexpr size_t MORSE_TABLE_SIZE = (size_t)1 << (MORSE_MAX_ELEMENTS + 1);
+
+
+/**
+ * Returns the code with a dot or dash appended to it. Appending to a symbol
+ * that is already MORSE_MAX_ELEMENTS long makes it invalid.
+ */
+constexpr morse_code_t morseAppend(morse_code_t code, bool dash)
+{
+    return (code == MORSE_INVALID || code >= MORSE_TABLE_SIZE / 2)
+        ? MORSE_INVALID
+        : (morse_code_t)((code << 1) | (dash ? 1 : 0));
+}
+
+/**
+ * Returns the code with its last element removed. The empty symbol stays
+ * empty.
+ */
+constexpr morse_code_t morseRemoveLast(morse_code_t code)
+{
+    return code <= MORSE_EMPTY ? code : (morse_code_t)(code >> 1);
+}
+
+/**
+ * Returns the number of elements of the code.
+ */
+constexpr size_t morseLength(morse_code_t code)
+{
+    size_t length = 0;
+    while (code > MORSE_EMPTY)
+    {
+        code >>= 1;
+        length++;
+    }
+    return length;
+}
+
+/**
+ * Converts a string of '.' and '-' characters into a code. Any other
+ * character, or a string longer than MORSE_MAX_ELEMENTS, gives MORSE_INVALID.
+ */
+constexpr morse_code_t morseFromString(const char* elements)
+{
+    morse_code_t code = MORSE_EMPTY;
+    for (; *elements != '\0'; elements++)
+    {
+        if (*elements != '.' && *elements != '-')
+        {
+            return MORSE_INVALID;
+        }
+        code = morseAppend(code, *elements == '-');
+    }
+    return code;
+}
+
+/**
+ * Writes the elements of the code into the buffer as '.' and '-' characters
+ * followed by a null terminator. The buffer should hold at least
+ * MORSE_MAX_ELEMENTS + 1 characters. Returns the number of elements written.
+ */
+size_t morseToString(morse_code_t code, char* buffer, size_t size);
+
+/**
+ * Returns the text a code decodes to: a letter, digit or punctuation mark, or
+ * a prosign written in angle brackets such as "<SK>". Returns NULL if the code
+ * is not a known symbol. The lookup is a single table access.
+ */
+const char* morseDecode(morse_code_t code);
+
+/**
+ * Returns the code of a letter, digit or punctuation mark. Letters may be of
+ * either case. Returns MORSE_INVALID for characters that have no symbol of
+ * their own, including the space. The lookup is a single table access.
+ */
+morse_code_t morseEncode(char character);
+
+
+#endif
@@ -0,0 +1,197 @@
+#include "morse_player.hpp"
+
+
+/**
+ * The LEDC channels of the buzzer and the LED, and their duty cycles out of
+ * 256: a square wave for the buzzer and a constant level for the LED, which
+ * holds without the LEDC clock while the CPU is in light sleep.
+ */
+static const uint8_t BUZZER_CHANNEL = 0;
+static const uint8_t LED_CHANNEL = 1;
+static const uint8_t PWM_RESOLUTION_BITS = 8;
+static const uint32_t BUZZER_DUTY = 128;
+static const uint32_t LED_DUTY = 256;
+static const uint32_t LED_PWM_HZ = 5000;
+
+
+MorsePlayer::MorsePlayer(uint8_t buzzer_pin, uint8_t led_pin)
+    : sequencer_(), lock_(portMUX_INITIALIZER_UNLOCKED), timer_(NULL),
+      pm_lock_(NULL), buzzer_pin_(buzzer_pin), led_pin_(led_pin),
+      unit_us_(1200000 / DEFAULT_WPM), next_step_us_(0), playing_(false),
+      step_on_(false), sidetone_(false), idle_led_(false), awake_(false)
+{
+}
+
+
+bool MorsePlayer::begin()
+{
+    ledcSetup(BUZZER_CHANNEL, TONE_HZ, PWM_RESOLUTION_BITS);
+    ledcAttachPin(buzzer_pin_, BUZZER_CHANNEL);
+    ledcWrite(BUZZER_CHANNEL, 0);
+    ledcSetup(LED_CHANNEL, LED_PWM_HZ, PWM_RESOLUTION_BITS);
+    ledcAttachPin(led_pin_, LED_CHANNEL);
+    ledcWrite(LED_CHANNEL, 0);
+
+    // Without power management there is no light sleep to hold off
+    if (esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "morse", &pm_lock_) != ESP_OK)
+    {
+        pm_lock_ = NULL;
+    }
+
+    esp_timer_create_args_t args = {};
+    args.callback = onTimer;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "morse";
+    return esp_timer_create(&args, &timer_) == ESP_OK;
+}
+
+
+void MorsePlayer::setWordsPerMinute(uint32_t wpm) noexcept
+{
+    if (wpm < MIN_WPM)
+    {
+        wpm = MIN_WPM;
+    }
+    else if (wpm > MAX_WPM)
+    {
+        wpm = MAX_WPM;
+    }
+    unit_us_ = 1200000 / wpm;
+}
+
+
+uint32_t MorsePlayer::getWordsPerMinute() const noexcept
+{
+    return 1200000 / unit_us_;
+}
+
+
+void MorsePlayer::play(const char* text)
+{
+    if (timer_ == NULL)
+    {
+        return;
+    }
+    esp_timer_stop(timer_);
+
+    portENTER_CRITICAL(&lock_);
+    sequencer_.start(text);
+    playing_ = sequencer_.isPlaying();
+    sidetone_ = false;
+    step_on_ = false;
+    next_step_us_ = esp_timer_get_time();
+    output();
+    portEXIT_CRITICAL(&lock_);
+
+    // The first step is taken by the timer task like the rest
+    if (playing_)
+    {
+        esp_timer_start_once(timer_, 1);
+    }
+}
+
+
+void MorsePlayer::stop()
+{
+    if (timer_ != NULL)
+    {
+        esp_timer_stop(timer_);
+    }
+
+    portENTER_CRITICAL(&lock_);
+    sequencer_.stop();
+    playing_ = false;
+    step_on_ = false;
+    output();
+    portEXIT_CRITICAL(&lock_);
+}
+
+
+bool MorsePlayer::isPlaying() const noexcept
+{
+    return playing_;
+}
+
+
+void MorsePlayer::setSidetone(bool on)
+{
+    if (on && playing_)
+    {
+        stop();
+    }
+
+    portENTER_CRITICAL(&lock_);
+    sidetone_ = on;
+    output();
+    portEXIT_CRITICAL(&lock_);
+}
+
+
+void MorsePlayer::setIdleLed(bool on)
+{
+    // Called every iteration of the loop, so unchanged states are not written
+    if (on == idle_led_)
+    {
+        return;
+    }
+
+    portENTER_CRITICAL(&lock_);
+    idle_led_ = on;
+    output();
+    portEXIT_CRITICAL(&lock_);
+}
+
+
+void MorsePlayer::onTimer(void* arg)
+{
+    MorsePlayer& self = *static_cast<MorsePlayer*>(arg);
+    MorseSequencer::morse_step step;
+
+    portENTER_CRITICAL(&self.lock_);
+    if (!self.playing_)
+    {
+        portEXIT_CRITICAL(&self.lock_);
+        return;
+    }
+    if (!self.sequencer_.next(step))
+    {
+        self.playing_ = false;
+        self.step_on_ = false;
+        self.output();
+        portEXIT_CRITICAL(&self.lock_);
+        return;
+    }
+
+    self.step_on_ = step.on;
+    self.output();
+
+    // Steps are scheduled from when the last one was due rather than from
+    // when its callback ran, so late callbacks do not stretch the message
+    self.next_step_us_ += (int64_t)step.units * self.unit_us_;
+    int64_t delay_us = self.next_step_us_ - esp_timer_get_time();
+    portEXIT_CRITICAL(&self.lock_);
+
+    esp_timer_start_once(self.timer_, delay_us > 0 ? delay_us : 1);
+}
+
+
+void MorsePlayer::output()
+{
+    bool sound = playing_ ? step_on_ : sidetone_;
+    bool light = playing_ ? step_on_ : idle_led_;
+    ledcWrite(BUZZER_CHANNEL, sound ? BUZZER_DUTY : 0);
+    ledcWrite(LED_CHANNEL, light ? LED_DUTY : 0);
+    holdAwake(playing_ || sidetone_);
+}
+
+
+void MorsePlayer::holdAwake(bool awake)
+{
+    if (pm_lock_ == NULL || awake == awake_)
+    {
+        return;
+    }
+    awake ? esp_pm_lock_acquire(pm_lock_) : esp_pm_lock_release(pm_lock_);
+    awake_ = awake;
+}
@@ -0,0 +1,110 @@
+#ifndef HELLOWORLD_MORSE_PLAYER_HPP
+#define HELLOWORLD_MORSE_PLAYER_HPP
+
+
+#include <Arduino.h>
+#include <esp_pm.h>
+#include <esp_timer.h>
+
+#include "morse_sequencer.hpp"
+
+
+/**
+ * Plays text as Morse on the buzzer and the LED, both driven by LEDC PWM
+ * channels. Each step of the code is timed by a one-shot esp_timer against an
+ * absolute schedule, so playback runs alongside the loop without delay() and
+ * without drifting when a callback runs late.
+ *
+ * The player also owns the buzzer and LED outside of playback: it sounds a
+ * sidetone while the key is held and shows the indicator the loop sets on the
+ * LED.
+ */
+class MorsePlayer
+{
+public:
+    /**
+     * The speed playback starts with, and the range it is kept in.
+     */
+    static const uint32_t DEFAULT_WPM = 15;
+    static const uint32_t MIN_WPM = 5;
+    static const uint32_t MAX_WPM = 40;
+
+    /**
+     * The pitch of the buzzer. It lies outside of the bin the audio input
+     * listens on, so the device does not decode its own playback.
+     */
+    static const uint32_t TONE_HZ = 600;
+
+    MorsePlayer(uint8_t buzzer_pin, uint8_t led_pin);
+
+    /**
+     * Attaches the pins to their LEDC channels and creates the timer. Returns
+     * false if the timer could not be created.
+     */
+    bool begin();
+
+    /**
+     * Sets the speed of playback, using the standard word PARIS of 50 units.
+     * Takes effect with the next step.
+     */
+    void setWordsPerMinute(uint32_t wpm) noexcept;
+
+    uint32_t getWordsPerMinute() const noexcept;
+
+    /**
+     * Starts playing the text, cutting off whatever was playing.
+     */
+    void play(const char* text);
+
+    /**
+     * Stops playback and silences the buzzer.
+     */
+    void stop();
+
+    /**
+     * Returns true while text is playing.
+     */
+    bool isPlaying() const noexcept;
+
+    /**
+     * Sounds the buzzer while the key is held. Keying stops playback.
+     */
+    void setSidetone(bool on);
+
+    /**
+     * Sets what the LED shows while nothing is playing.
+     */
+    void setIdleLed(bool on);
+
+private:
+    static void onTimer(void* arg);
+
+    /**
+     * Drives the buzzer and LED for the current state. Must be called with
+     * the lock held.
+     */
+    void output();
+
+    /**
+     * Keeps the CPU out of light sleep, which stops the LEDC clock, while
+     * anything sounds. Must be called with the lock held.
+     */
+    void holdAwake(bool awake);
+
+    MorseSequencer sequencer_;
+    portMUX_TYPE lock_;
+    esp_timer_handle_t timer_;
+    esp_pm_lock_handle_t pm_lock_;
+    uint8_t buzzer_pin_;
+    uint8_t led_pin_;
+    uint32_t unit_us_;
+    int64_t next_step_us_;
+    bool playing_;
+    bool step_on_;
+    bool sidetone_;
+    bool idle_led_;
+    bool awake_;
+};
+
+
+#endif
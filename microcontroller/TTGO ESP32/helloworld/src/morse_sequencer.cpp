@@ -0,0 +1,99 @@
+#include "morse_sequencer.hpp"
+
+#include <string.h>
+
+#include "morse.hpp"
+
+
+/**
+ * Standard Morse timing in units.
+ */
+static const uint8_t DOT_UNITS = 1;
+static const uint8_t DASH_UNITS = 3;
+static const uint8_t ELEMENT_GAP_UNITS = 1;
+static const uint8_t LETTER_GAP_UNITS = 3;
+static const uint8_t WORD_GAP_UNITS = 7;
+
+
+MorseSequencer::MorseSequencer()
+    : text_(), length_(0), position_(0), element_(0), gap_units_(0)
+{
+}
+
+
+void MorseSequencer::start(const char* text) noexcept
+{
+    strncpy(text_, text, CAPACITY);
+    text_[CAPACITY] = '\0';
+    length_ = strlen(text_);
+    position_ = 0;
+    element_ = 0;
+    gap_units_ = 0;
+    skipToSymbol();
+}
+
+
+bool MorseSequencer::next(morse_step& step) noexcept
+{
+    if (gap_units_ > 0)
+    {
+        step.on = false;
+        step.units = gap_units_;
+        gap_units_ = 0;
+        return true;
+    }
+    if (position_ >= length_)
+    {
+        return false;
+    }
+
+    // Elements are stored below the leading 1 bit of the code, first element
+    // highest
+    morse_code_t code = morseEncode(text_[position_]);
+    size_t length = morseLength(code);
+    bool dash = (code >> (length - 1 - element_)) & 1;
+    step.on = true;
+    step.units = dash ? DASH_UNITS : DOT_UNITS;
+
+    if (++element_ < length)
+    {
+        gap_units_ = ELEMENT_GAP_UNITS;
+        return true;
+    }
+
+    // The gap after a letter depends on what follows it, and there is none
+    // after the last
+    element_ = 0;
+    position_++;
+    bool word_gap = skipToSymbol();
+    if (position_ < length_)
+    {
+        gap_units_ = word_gap ? WORD_GAP_UNITS : LETTER_GAP_UNITS;
+    }
+    return true;
+}
+
+
+void MorseSequencer::stop() noexcept
+{
+    position_ = length_;
+    gap_units_ = 0;
+}
+
+
+bool MorseSequencer::isPlaying() const noexcept
+{
+    return position_ < length_;
+}
+
+
+bool MorseSequencer::skipToSymbol() noexcept
+{
+    bool skipped = false;
+    while (position_ < length_ && morseEncode(text_[position_]) == MORSE_INVALID)
+    {
+        skipped = true;
+        position_++;
+    }
+    return skipped;
+}
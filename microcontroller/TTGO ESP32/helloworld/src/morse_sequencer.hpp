@@ -0,0 +1,75 @@
+#ifndef HELLOWORLD_MORSE_SEQUENCER_HPP
+#define HELLOWORLD_MORSE_SEQUENCER_HPP
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * Turns text into the on and off steps of its Morse code, timed in units: a
+ * dot is one unit on and a dash three, followed by one unit off between the
+ * elements of a letter, three between letters and seven between words.
+ * Characters without a symbol of their own are skipped; spaces and other
+ * skipped characters between letters make a word gap.
+ *
+ * The steps are produced one at a time from the copy of the text, so a whole
+ * message never has to be expanded into memory. The class does not depend on
+ * the Arduino core.
+ */
+class MorseSequencer
+{
+public:
+    /**
+     * The key is held on or off for the units.
+     */
+    struct morse_step {
+        bool on;
+        uint8_t units;
+    };
+
+    /**
+     * The longest text that can be played, not counting the terminator.
+     * Longer text is truncated.
+     */
+    static const size_t CAPACITY = 127;
+
+    MorseSequencer();
+
+    /**
+     * Starts over with the text, dropping whatever was left to play.
+     */
+    void start(const char* text) noexcept;
+
+    /**
+     * Stores the next step in the step. Returns false once the text has been
+     * played; the last step is always an element, never a gap.
+     */
+    bool next(morse_step& step) noexcept;
+
+    /**
+     * Drops whatever is left to play.
+     */
+    void stop() noexcept;
+
+    /**
+     * Returns true if steps are left to play.
+     */
+    bool isPlaying() const noexcept;
+
+private:
+    /**
+     * Moves to the next character that has a symbol, and returns true if
+     * characters without one were skipped on the way.
+     */
+    bool skipToSymbol() noexcept;
+
+    char text_[CAPACITY + 1];
+    size_t length_;
+    size_t position_;
+    size_t element_;
+    uint8_t gap_units_;
+};
+
+
+#endif
@@ -1,28 +1,254 @@
 #include "network.hpp"
 
 #include <WiFi.h>
-#include <HttpClient.h>
-#include <vector>
+#include <time.h>
 
+#include "trace.hpp"
+#include "wire.hpp"
 
-static void DEBUG(String message)
+
+/**
+ * Milliseconds to wait on the server before a response is considered lost.
+ */
+static const unsigned long RESPONSE_TIMEOUT_MS = 10000;
+
+/**
+ * Size of the buffer a request is assembled in. Requests that fit are written
+ * to the socket in a single call, and therefore usually a single segment.
+ */
+static const size_t REQUEST_BUFFER_SIZE = 512;
+
+/**
+ * Returned by readResponseHead() when the server closed the connection
+ * without sending any of a response.
+ */
+static const int RESPONSE_CLOSED = -2;
+
+
+/**
+ * Size of the buffer a binary request body is built in, enough for the device
+ * id and the longest message the outbox holds with every character escaped.
+ */
+static const size_t BINARY_REQUEST_SIZE = 256;
+
+/**
+ * Size of the buffer a message of a binary response is read into. The part of
+ * a longer message that does not fit is skipped.
+ */
+static const size_t BINARY_FRAME_SIZE = 256;
+
+/**
+ * Writes the request line, headers and body of a POST request. Returns false
+ * if the socket did not take all of it.
+ */
+static bool sendRequest(WiFiClient& socket,
+                        const char* host,
+                        short port,
+                        const char* url_path,
+                        const RequestBody& request,
+                        bool keep_alive);
+
+/**
+ * The body of a request in the binary protocol, starting with the device id.
+ */
+class BinaryRequest : public RequestBody
 {
-    Serial.print("[NETWORK_DEBUG] ");
-    Serial.println(message);
-}
+public:
+    BinaryRequest(const uint8_t* device_id);
+
+    /**
+     * Appends a byte, a u32 or packed text. Returns false if it does not fit.
+     */
+    bool addByte(uint8_t value);
+    bool addU32(uint32_t value);
+    bool addText(const char* text);
+
+    /**
+     * Overwrites the byte at the offset, which must have been added already.
+     */
+    void setByte(size_t offset, uint8_t value);
+
+    /**
+     * Returns the number of bytes added so far.
+     */
+    size_t getLength() const noexcept;
+
+    /**
+     * Drops the bytes added after the first length bytes.
+     */
+    void truncate(size_t length);
+
+    const char* getContentType() const override;
+    size_t getContentLength() const override;
+    size_t writeTo(Print& out) const override;
+
+private:
+    uint8_t data_[BINARY_REQUEST_SIZE];
+    size_t length_;
+};
 
+/**
+ * Collects bytes written to it in a buffer and writes them to the socket each
+ * time the buffer fills up, and on flush(). This keeps a request to as few
+ * socket writes, and so segments, as the buffer allows.
+ */
+class RequestWriter : public Print
+{
+public:
+    /**
+     * Uses the buffer, of which the first length bytes are already filled.
+     */
+    RequestWriter(WiFiClient& socket, char* buffer, size_t size, size_t length);
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* data, size_t length) override;
+    void flush() override;
+
+    /**
+     * Returns true if a socket write has fallen short.
+     */
+    bool failed() const noexcept;
+
+private:
+    WiFiClient& socket_;
+    char* buffer_;
+    size_t size_;
+    size_t length_;
+    bool failed_;
+};
 
 /**
- * Writes to the server and returns the response received from the server.
+ * Reads the status line and headers of an http response. Returns the status
+ * code of the response, RESPONSE_CLOSED if the server closed the connection
+ * before sending any of it, or -1 if the response was cut off or did not
+ * arrive in time. The content length is -1 if the server did not send one.
  */
-static String writeToServer(ApplicationNetworkClient& client,
-                            FormDataFormatter& form,
-                            const char* url_path);
+static int readResponseHead(WiFiClient& socket,
+                            long& content_length,
+                            bool& connection_close);
+
+/**
+ * Reads the body of an http response straight from the socket without reading
+ * past its end, so the connection can be reused for the next response. Reads
+ * wait for data as long as the rest of the response does. If the length of
+ * the body is unknown (-1), it ends when the server closes the connection.
+ */
+class ResponseBodyStream : public Stream
+{
+public:
+    ResponseBodyStream(WiFiClient& socket, long length);
+
+    int available() override;
+    int read() override;
+    int peek() override;
+    size_t readBytes(char* buffer, size_t length) override;
+    size_t write(uint8_t) override;
+
+    /**
+     * Reads and discards the rest of the body. Returns true if the whole body
+     * was read.
+     */
+    bool skipRemaining();
+
+    /**
+     * Returns true if the whole body has been read.
+     */
+    bool finished() const noexcept;
+
+private:
+    /**
+     * Blocks until there is body left to read and it has arrived.
+     */
+    bool waitForBody();
+
+    WiFiClient& socket_;
+    long remaining_;
+    bool lost_;
+};
 
 /**
- * Outputs an http response into a string.
+ * Reads the body of an http response into the buffer and null-terminates it.
+ * Returns the length of the body, or -1 if the connection was lost or the body
+ * did not fit, in which case overflowed tells which. A body that does not fit
+ * is still read off the connection so that the next response can be read.
  */
-static String getResponseFromServer(HttpClient& http_client);
+static int getResponseFromServer(ResponseBodyStream& body,
+                                 char* buffer,
+                                 size_t size,
+                                 bool& overflowed);
+
+/**
+ * Reads off the rest of a response and closes the connection unless it can be
+ * used for the next request.
+ */
+static void finishResponse(WiFiClient& socket,
+                           ResponseBodyStream& body,
+                           bool connection_close);
+
+/**
+ * Parses a pending/get response from the body one field at a time. Message
+ * objects are parsed one at a time through the filter into the document and
+ * copied into the array, up to the capacity; any further messages are
+ * skipped. Outputs the number of messages stored and the "pending" field, or
+ * -1 if there was none. Returns false if the body is not a JSON object of the
+ * expected form.
+ */
+static bool parseMessages(Stream& body,
+                          JsonVariant message_filter,
+                          JsonDocument& doc,
+                          ApplicationNetworkClient::message_map* messages,
+                          int capacity,
+                          int& count,
+                          int& pending);
+
+/**
+ * Returns the next character of the stream that is not whitespace without
+ * consuming it, or -1 if the stream ended.
+ */
+static int peekToken(Stream& stream);
+
+/**
+ * Reads a JSON string into the buffer, truncating it to fit. Escaped
+ * characters are kept as they are. Returns false if the stream does not hold
+ * a string.
+ */
+static bool readJsonString(Stream& stream, char* buffer, size_t size);
+
+/**
+ * Reads a JSON integer. Returns false if the stream does not hold one.
+ */
+static bool readJsonInteger(Stream& stream, long& value);
+
+/**
+ * Reads past a JSON value of any type. Returns false if the stream does not
+ * hold a valid value.
+ */
+static bool skipJsonValue(Stream& stream);
+
+/**
+ * Reads one line of an http response head into the buffer without the line
+ * ending. Lines longer than the buffer are truncated. Returns the length of
+ * the line, or -1 if the connection closed or timed out first.
+ */
+static int readLine(WiFiClient& socket, char* buffer, size_t size);
+
+/**
+ * Blocks until the socket has data to read. Returns false if the connection
+ * closed or timed out first.
+ */
+static bool waitForData(WiFiClient& socket);
+
+/**
+ * Returns the length of the text once percent-encoded as form data.
+ */
+static size_t getEncodedLength(const char* text);
+
+/**
+ * Writes the text percent-encoded as form data. Letters, digits and "*-._" are
+ * written as they are, spaces as "+" and every other byte as "%XX". Returns the
+ * number of bytes written.
+ */
+static size_t writeEncoded(Print& out, const char* text);
 
 
 /******************************************************************************/
@@ -57,9 +283,15 @@ ApplicationNetworkClient::ApplicationNetworkClient(
     const char* address,
     short port
 )
-    : endpoint_address_(address), endpoint_port_(port), wifi_client_()
+    : endpoint_address_(address), endpoint_port_(port), plain_client_(),
+      secure_client_(), wifi_client_(&plain_client_),
+      keep_alive_(true), protocol_(FORM_PROTOCOL), stats_(),
+      last_status_code_(-1), pending_count_(-1), pending_count_time_(0),
+      mac_address_(), device_id_()
 {
-    wifi_client_.setTimeout(10);
+    plain_client_.setTimeout(10);
+    secure_client_.setTimeout(10);
+    secure_client_.setHandshakeTimeout(RESPONSE_TIMEOUT_MS / 1000);
 }
 
 
@@ -82,121 +314,598 @@ short ApplicationNetworkClient::getPort() noexcept
 
 WiFiClient& ApplicationNetworkClient::getWifiClient() noexcept
 {
-    return wifi_client_;
+    return *wifi_client_;
+}
+
+
+void ApplicationNetworkClient::setKeepAlive(bool enabled)
+{
+    keep_alive_ = enabled;
+    if (!keep_alive_)
+    {
+        disconnect();
+    }
+}
+
+
+bool ApplicationNetworkClient::isKeepAlive() const noexcept
+{
+    return keep_alive_;
+}
+
+
+void ApplicationNetworkClient::setProtocol(wire_protocol protocol)
+{
+    protocol_ = protocol;
+}
+
+
+ApplicationNetworkClient::wire_protocol
+ApplicationNetworkClient::getProtocol() const noexcept
+{
+    return protocol_;
+}
+
+
+void ApplicationNetworkClient::setSecure(const char* ca_certificate)
+{
+    disconnect();
+    if (ca_certificate != NULL)
+    {
+        secure_client_.setCACert(ca_certificate);
+    }
+    else
+    {
+        TRACE_WARN("network", "The server certificate will not be verified.");
+        secure_client_.setInsecure();
+    }
+    wifi_client_ = &secure_client_;
+}
+
+
+bool ApplicationNetworkClient::isSecure() const noexcept
+{
+    return wifi_client_ == &secure_client_;
+}
+
+
+const ApplicationNetworkClient::connection_stats&
+ApplicationNetworkClient::getConnectionStats() const noexcept
+{
+    return stats_;
+}
+
+
+int ApplicationNetworkClient::getLastStatusCode() const noexcept
+{
+    return last_status_code_;
+}
+
+
+void ApplicationNetworkClient::disconnect()
+{
+    wifi_client_->stop();
 }
 
 
 void ApplicationNetworkClient::makeVisible()
 {
-    const char* path = "/api/device/register";
+    bool binary = protocol_ == BINARY_PROTOCOL;
+    const char* path = binary ? "/api/binary/register" : "/api/device/register";
 
+    TraceTimer timer(TRACE_REGISTER);
     FormDataFormatter form_data;
-    form_data.addPair("macAddress", WiFi.macAddress().c_str());
+    form_data.addPair("macAddress", getMacAddress());
     // form_data.addPair("username", "my_username");
+    BinaryRequest binary_request(getDeviceId());
+    const RequestBody& request = binary ?
+        (const RequestBody&)binary_request : form_data;
 
-    DEBUG("makeVisible() -> /api/device/register");
-    DEBUG(form_data.toString());
-    writeToServer(*this, form_data, path);
+    TRACE_DEBUG("network", "makeVisible() -> %s", path);
+    TRACE_DEBUG("network", "\tbody: %u bytes", request.getContentLength());
+    readPendingCount(writeToServer(request, path, true));
 }
 
 
 void ApplicationNetworkClient::makeInvisible()
 {
-    const char* path = "/api/device/unregister";
+    bool binary = protocol_ == BINARY_PROTOCOL;
+    const char* path = binary ?
+        "/api/binary/unregister" : "/api/device/unregister";
     
+    TraceTimer timer(TRACE_UNREGISTER);
     FormDataFormatter form_data;
-    form_data.addPair("macAddress", WiFi.macAddress().c_str());
+    form_data.addPair("macAddress", getMacAddress());
+    BinaryRequest binary_request(getDeviceId());
+    const RequestBody& request = binary ?
+        (const RequestBody&)binary_request : form_data;
     
-    DEBUG("makeInvisible() -> /api/device/unregister");
-    DEBUG(form_data.toString());
-    writeToServer(*this, form_data, path);
+    TRACE_DEBUG("network", "makeInvisible() -> %s", path);
+    TRACE_DEBUG("network", "\tbody: %u bytes", request.getContentLength());
+    writeToServer(request, path, true);
 }
 
 
-void ApplicationNetworkClient::sendMessage(const char* message)
+bool ApplicationNetworkClient::sendMessage(const char* message)
 {
-    const char* path = "/api/device/message/receive";
-    HttpClient http_client(wifi_client_);
+    bool binary = protocol_ == BINARY_PROTOCOL;
+    const char* path = binary ?
+        "/api/binary/message/receive" : "/api/device/message/receive";
 
+    TraceTimer timer(TRACE_SEND);
     FormDataFormatter form_data;
-    form_data.addPair("macAddress", WiFi.macAddress().c_str());
+    form_data.addPair("macAddress", getMacAddress());
     form_data.addPair("message", message);
+    BinaryRequest binary_request(getDeviceId());
+    if (binary && !binary_request.addText(message))
+    {
+        TRACE_ERROR("network", "Message does not fit the request buffer");
+        return false;
+    }
+    const RequestBody& request = binary ?
+        (const RequestBody&)binary_request : form_data;
+
+    TRACE_DEBUG("network", "sendMessage() -> %s", path);
+    TRACE_DEBUG("network", "\tbody: %u bytes", request.getContentLength());
+    int length = writeToServer(request, path, false);
+    readPendingCount(length);
+    return length >= 0 && last_status_code_ == 200;
+}
+
+
+int ApplicationNetworkClient::sendMessages(const char* const* messages,
+                                           const unsigned long* ages_ms,
+                                           int count)
+{
+    bool binary = protocol_ == BINARY_PROTOCOL;
+    const char* path = binary ?
+        "/api/binary/message/receive/batch" : "/api/device/message/receive/batch";
+    if (count > MAX_BATCH_SIZE)
+    {
+        count = MAX_BATCH_SIZE;
+    }
 
-    DEBUG("sendMessage() -> /api/device/message/receive");
-    DEBUG(form_data.toString());
-    writeToServer(*this, form_data, path);
+    TraceTimer timer(TRACE_SEND);
+    // Form data repeats the message and age keys once for each message
+    FormDataFormatter form_data;
+    char ages[MAX_BATCH_SIZE][11];
+    form_data.addPair("macAddress", getMacAddress());
+    for (int i = 0; i < count; i++)
+    {
+        snprintf(ages[i], sizeof(ages[i]), "%lu", ages_ms[i]);
+        form_data.addPair("message", messages[i]);
+        form_data.addPair("age", ages[i]);
+    }
+
+    // The binary request holds as many messages as fit, and they are counted
+    // once the last one is in
+    BinaryRequest binary_request(getDeviceId());
+    if (binary)
+    {
+        binary_request.addByte(0);
+        int added = 0;
+        for (; added < count; added++)
+        {
+            size_t length = binary_request.getLength();
+            if (!binary_request.addU32(ages_ms[added]) ||
+                !binary_request.addText(messages[added]))
+            {
+                binary_request.truncate(length);
+                break;
+            }
+        }
+        if (added == 0)
+        {
+            TRACE_ERROR("network", "Message does not fit the request buffer");
+            return 0;
+        }
+        binary_request.setByte(WIRE_ID_SIZE, added);
+        count = added;
+    }
+    const RequestBody& request = binary ?
+        (const RequestBody&)binary_request : form_data;
+
+    TRACE_DEBUG("network", "sendMessages() -> %s", path);
+    TRACE_DEBUG("network", "\t%d messages, body: %u bytes", count,
+                request.getContentLength());
+    int length = writeToServer(request, path, false);
+    readPendingCount(length);
+    return length >= 0 && last_status_code_ == 200 ? count : 0;
 }
 
 
 int ApplicationNetworkClient::countPendingMessages()
 {
-    const char* path = "/api/device/message/pending/count";
-    HttpClient http_client(wifi_client_);
+    TraceTimer timer(TRACE_COUNT);
+    if (protocol_ == BINARY_PROTOCOL)
+    {
+        const char* path = "/api/binary/message/pending/count";
+        TRACE_DEBUG("network", "countPendingMessages() -> %s", path);
+        BinaryRequest binary_request(getDeviceId());
+        int length = writeToServer(binary_request, path, true);
+        if (length != 2 || last_status_code_ != 200)
+        {
+            return 0;
+        }
+
+        int count = wireGet16((const uint8_t*)response_buffer_);
+        pending_count_ = count;
+        pending_count_time_ = millis();
+        TRACE_DEBUG("network", "\treceived: %d", count);
+        return count;
+    }
 
+    const char* path = "/api/device/message/pending/count";
     FormDataFormatter form_data;
-    form_data.addPair("macAddress", WiFi.macAddress().c_str());
+    form_data.addPair("macAddress", getMacAddress());
+
+    TRACE_DEBUG("network", "countPendingMessages() -> %s", path);
+    long content_length;
+    bool connection_close;
+    if (startExchange(form_data, path, true, content_length,
+                      connection_close) < 0)
+    {
+        return 0;
+    }
+
+    StaticJsonDocument<32> filter;
+    filter["count"] = true;
+    filter["pending"] = true;
+
+    ResponseBodyStream body(*wifi_client_, content_length);
+    StaticJsonDocument<64> doc;
+    DeserializationError error = deserializeJson(
+        doc, body, DeserializationOption::Filter(filter)
+    );
+    finishResponse(*wifi_client_, body, connection_close || error);
 
-    // DEBUG("countPendingMessages() -> /api/device/message/pending/count");
-    // DEBUG(form_data.toString());
-    String response = writeToServer(*this, form_data, path);
-    DynamicJsonDocument doc(256);
-    deserializeJson(doc, response);
     int count = doc["count"];
+    updatePendingCount(doc);
 
-    DEBUG("\treceived: " + String(count));
+    TRACE_DEBUG("network", "\treceived: %d", count);
     return count;
 }
 
 
-void ApplicationNetworkClient::fetchPendingMessages(int amount = 1)
+int ApplicationNetworkClient::fetchPendingMessages(message_map* messages,
+                                                   int capacity)
 {
     const char* path = "/api/device/message/pending/get";
-    HttpClient http_client(wifi_client_);
 
-    String amount_str = String(amount);
+    TraceTimer timer(TRACE_FETCH);
+    if (protocol_ == BINARY_PROTOCOL)
+    {
+        return fetchBinaryMessages(messages, capacity);
+    }
+
+    char limit[12];
+    snprintf(limit, sizeof(limit), "%d", capacity);
 
     FormDataFormatter form_data;
-    form_data.addPair("macAddress", WiFi.macAddress().c_str());
-    form_data.addPair("limit", amount_str.c_str());
+    form_data.addPair("macAddress", getMacAddress());
+    form_data.addPair("limit", limit);
+
+    TRACE_DEBUG("network", "fetchPendingMessages() -> %s", path);
+    TRACE_DEBUG("network", "\tbody: %u bytes", form_data.getContentLength());
+    long content_length;
+    bool connection_close;
+    int status = startExchange(form_data, path, false, content_length,
+                               connection_close);
+    if (status < 0)
+    {
+        return 0;
+    }
 
-    DEBUG("fetchPendingMessages() -> /api/device/message/pending/get");
-    DEBUG(form_data.toString());
-    String response = writeToServer(*this, form_data, path);
+    // Only these fields of a message are kept; anything else the server adds
+    // is skipped without being stored
+    StaticJsonDocument<128> filter;
+    filter["messages"][0]["macAddress"] = true;
+    filter["messages"][0]["content"] = true;
+    filter["messages"][0]["time"] = true;
+    JsonVariant message_filter = filter["messages"][0];
+
+    ResponseBodyStream body(*wifi_client_, content_length);
+    int count = 0;
+    int pending = -1;
+    bool parsed = status == 200 &&
+        parseMessages(body, message_filter, message_document_, messages,
+                      capacity, count, pending);
+    finishResponse(*wifi_client_, body, connection_close || !parsed);
+
+    if (pending >= 0)
+    {
+        pending_count_ = pending;
+        pending_count_time_ = millis();
+    }
 
-    DEBUG("\tcalled response" + String(response));
+    TRACE_DEBUG("network", "\tmessages received: %d", count);
+    return count;
+}
 
 
-    DynamicJsonDocument doc(256);
-    deserializeJson(doc, response);
-    int count = doc["count"];
+int ApplicationNetworkClient::getPendingCount() const noexcept
+{
+    return pending_count_;
+}
+
+
+unsigned long ApplicationNetworkClient::getPendingCountTime() const noexcept
+{
+    return pending_count_time_;
+}
+
+
+int ApplicationNetworkClient::fetchBinaryMessages(message_map* messages,
+                                                  int capacity)
+{
+    const char* path = "/api/binary/message/pending/get";
+
+    BinaryRequest binary_request(getDeviceId());
+    binary_request.addByte(capacity < 0 ? 0 : capacity > 255 ? 255 : capacity);
+
+    TRACE_DEBUG("network", "fetchPendingMessages() -> %s", path);
+    long content_length;
+    bool connection_close;
+    int status = startExchange(binary_request, path, false, content_length,
+                               connection_close);
+    if (status < 0)
+    {
+        return 0;
+    }
+
+    ResponseBodyStream body(*wifi_client_, content_length);
+    int count = 0;
+    uint8_t head[3];
+    bool parsed = status == 200 &&
+        body.readBytes((char*)head, sizeof(head)) == sizeof(head);
+    int messages_sent = parsed ? head[2] : 0;
+
+    // Each message is read whole into the frame buffer and decoded from there;
+    // whatever does not fit is skipped
+    uint8_t frame[BINARY_FRAME_SIZE];
+    for (int i = 0; parsed && i < messages_sent; i++)
+    {
+        uint8_t length_bytes[2];
+        if (body.readBytes((char*)length_bytes, 2) != 2)
+        {
+            parsed = false;
+            break;
+        }
+        size_t length = wireGet16(length_bytes);
+        size_t kept = length < sizeof(frame) ? length : sizeof(frame);
+        if (body.readBytes((char*)frame, kept) != kept)
+        {
+            parsed = false;
+            break;
+        }
+        for (size_t skipped = kept; skipped < length; skipped++)
+        {
+            if (body.read() < 0)
+            {
+                parsed = false;
+                break;
+            }
+        }
+        if (!parsed || kept < WIRE_ID_SIZE + 4 + 1 || count >= capacity)
+        {
+            continue;
+        }
+
+        char sender[18];
+        snprintf(sender, sizeof(sender), "%02X:%02X:%02X:%02X:%02X:%02X",
+                 frame[0], frame[1], frame[2], frame[3], frame[4], frame[5]);
+
+        time_t sent = wireGet32(frame + WIRE_ID_SIZE);
+        struct tm sent_time;
+        gmtime_r(&sent, &sent_time);
+        char sent_at[32];
+        strftime(sent_at, sizeof(sent_at), "%Y-%m-%d %I:%M:%S %p", &sent_time);
+
+        char content[128];
+        wireUnpackText(frame + WIRE_ID_SIZE + 4, kept - WIRE_ID_SIZE - 4,
+                       content, sizeof(content));
+
+        message_map& message = messages[count++];
+        message.macAddress = sender;
+        message.content = content;
+        message.time = sent_at;
+    }
+    finishResponse(*wifi_client_, body, connection_close || !parsed);
+
+    if (parsed)
+    {
+        pending_count_ = wireGet16(head);
+        pending_count_time_ = millis();
+    }
+
+    TRACE_DEBUG("network", "\tmessages received: %d", count);
+    return count;
+}
+
+
+int ApplicationNetworkClient::writeToServer(const RequestBody& request,
+                                            const char* url_path,
+                                            bool idempotent)
+{
+    long content_length;
+    bool connection_close;
+    if (startExchange(request, url_path, idempotent, content_length,
+                      connection_close) < 0)
+    {
+        response_buffer_[0] = '\0';
+        return -1;
+    }
+
+    ResponseBodyStream body(*wifi_client_, content_length);
+    bool overflowed;
+    int length = getResponseFromServer(body, response_buffer_,
+                                       sizeof(response_buffer_), overflowed);
+    finishResponse(*wifi_client_, body, connection_close || length < 0);
+
+    if (overflowed)
+    {
+        stats_.overflows++;
+        TRACE_ERROR("network", "Response does not fit the response buffer");
+    }
+    if (length < 0)
+    {
+        stats_.failures++;
+        TRACE_ERROR("network", "Could not read response from server");
+    }
+    return length;
+}
+
+
+int ApplicationNetworkClient::startExchange(const RequestBody& request,
+                                            const char* url_path,
+                                            bool idempotent,
+                                            long& content_length,
+                                            bool& connection_close)
+{
+    last_status_code_ = -1;
+
+    // A reused connection may have been closed by the server while it was
+    // idle, in which case the request is retried once on a new connection.
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        bool reused = keep_alive_ && wifi_client_->connected();
+        if (!reused && !connectToServer())
+        {
+            break;
+        }
+
+        stats_.requests++;
+        if (reused)
+        {
+            stats_.reused++;
+        }
+
+        uint32_t start_us = micros();
+        bool written = sendRequest(*wifi_client_, endpoint_address_,
+                                   endpoint_port_, url_path, request,
+                                   keep_alive_);
+
+        content_length = -1;
+        connection_close = !keep_alive_;
+        int status = written ?
+            readResponseHead(*wifi_client_, content_length, connection_close) :
+            -1;
+        if (reused && status >= 0)
+        {
+            traceLatency(TRACE_REUSED, micros() - start_us);
+        }
+        if (status < 0)
+        {
+            wifi_client_->stop();
+
+            // Only a request that cannot have been handled is sent again: one
+            // the socket would not take, or one that does no harm if handled
+            // twice and was met with a close instead of a response. A request
+            // that timed out may have been handled, and sending a message
+            // again would deliver it twice.
+            if (reused && (!written ||
+                           (idempotent && status == RESPONSE_CLOSED)))
+            {
+                continue;
+            }
+            break;
+        }
+
+        last_status_code_ = status;
+        if (status != 200)
+        {
+            TRACE_ERROR("network", "Getting response failed with HTTP code %d",
+                        status);
+        }
+        return status;
+    }
 
-    DEBUG("\tmessages received: " + String(count));
+    stats_.failures++;
+    TRACE_ERROR("network", "No response from server");
+    return -1;
+}
 
-    // DynamicJsonDocument msg_doc(512);
-    // deserializeJson(msg_doc, ;
-    JsonArray messages = doc["messages"];
 
-    DEBUG("\tsuccessfully initializzed message JsonArray");
+void ApplicationNetworkClient::updatePendingCount(JsonDocument& doc)
+{
+    JsonVariant pending = doc["pending"];
+    if (pending.is<int>())
+    {
+        pending_count_ = pending.as<int>();
+        pending_count_time_ = millis();
+    }
+}
 
-    for (int i = 0; i < count; i++){
-        struct ApplicationNetworkClient::message_map mm;
-        JsonObject message = messages[i];
-        const char* macAddress = message["macAddress"];
-        const char* content = message["content"];
-        const char* time = message["time"];
-        mm.macAddress = String(macAddress);
-        mm.content = String(content);
-        mm.time = String(time);
 
-        pending_messages_.push_back(mm);
+void ApplicationNetworkClient::readPendingCount(int length)
+{
+    if (length < 0)
+    {
+        return;
     }
+
+    if (protocol_ == BINARY_PROTOCOL)
+    {
+        uint16_t pending = length >= 2 ?
+            wireGet16((const uint8_t*)response_buffer_) : WIRE_UNKNOWN_PENDING;
+        if (last_status_code_ == 200 && pending != WIRE_UNKNOWN_PENDING)
+        {
+            pending_count_ = pending;
+            pending_count_time_ = millis();
+        }
+        return;
+    }
+
+    StaticJsonDocument<16> filter;
+    filter["pending"] = true;
+
+    StaticJsonDocument<32> doc;
+    deserializeJson(doc, response_buffer_, length,
+                    DeserializationOption::Filter(filter));
+    updatePendingCount(doc);
 }
 
-std::vector<ApplicationNetworkClient::message_map> ApplicationNetworkClient::getFetchedMessages()
+
+bool ApplicationNetworkClient::connectToServer()
 {
-    std::vector<ApplicationNetworkClient::message_map> output = std::vector<ApplicationNetworkClient::message_map>(pending_messages_);
-    pending_messages_.clear();
-    return output;
+    wifi_client_->stop();
+    stats_.reconnects++;
+
+    // Over TLS, connect() also performs the handshake, which is most of the
+    // cost of a connection.
+    uint32_t start_us = micros();
+    if (!wifi_client_->connect(endpoint_address_, endpoint_port_))
+    {
+        TRACE_ERROR("network", "Could not connect to server");
+        return false;
+    }
+    traceLatency(TRACE_CONNECT, micros() - start_us);
+
+    // Requests are written in several small pieces; send them right away
+    // instead of waiting on the acknowledgement of the previous segment.
+    wifi_client_->setNoDelay(true);
+    return true;
+}
+
+
+const char* ApplicationNetworkClient::getMacAddress()
+{
+    if (mac_address_[0] == '\0')
+    {
+        WiFi.macAddress(device_id_);
+        snprintf(mac_address_, sizeof(mac_address_),
+                 "%02X:%02X:%02X:%02X:%02X:%02X",
+                 device_id_[0], device_id_[1], device_id_[2],
+                 device_id_[3], device_id_[4], device_id_[5]);
+    }
+    return mac_address_;
+}
+
+
+const uint8_t* ApplicationNetworkClient::getDeviceId()
+{
+    getMacAddress();
+    return device_id_;
 }
 
 
@@ -206,29 +915,139 @@ std::vector<ApplicationNetworkClient::message_map> ApplicationNetworkClient::get
 
 
 FormDataFormatter::FormDataFormatter()
-    : key_value_pairs_(0), output_()
+    : key_value_pairs_(0), keys_(), values_()
 {
 }
 
 
 void FormDataFormatter::addPair(const char* key, const char* value)
 {
-    if (key_value_pairs_ > 0)
+    if (key_value_pairs_ == MAX_PAIRS)
     {
-        output_ += "&";
+        return;
     }
 
-    output_ += key;
-    output_ += "=";
-    output_ += value;
-
+    keys_[key_value_pairs_] = key;
+    values_[key_value_pairs_] = value;
     key_value_pairs_++;
 }
 
 
-String FormDataFormatter::toString()
+const char* FormDataFormatter::getContentType() const
+{
+    return "application/x-www-form-urlencoded";
+}
+
+
+size_t FormDataFormatter::getContentLength() const
 {
-    return String(output_);
+    // Separators between the pairs and within each pair
+    size_t length = key_value_pairs_ > 0 ? 2 * key_value_pairs_ - 1 : 0;
+    for (int i = 0; i < key_value_pairs_; i++)
+    {
+        length += getEncodedLength(keys_[i]) + getEncodedLength(values_[i]);
+    }
+    return length;
+}
+
+
+size_t FormDataFormatter::writeTo(Print& out) const
+{
+    size_t length = 0;
+    for (int i = 0; i < key_value_pairs_; i++)
+    {
+        if (i > 0)
+        {
+            length += out.write('&');
+        }
+        length += writeEncoded(out, keys_[i]);
+        length += out.write('=');
+        length += writeEncoded(out, values_[i]);
+    }
+    return length;
+}
+
+
+/******************************************************************************/
+/* BinaryRequest                                                              */
+/******************************************************************************/
+
+
+BinaryRequest::BinaryRequest(const uint8_t* device_id)
+    : length_(WIRE_ID_SIZE)
+{
+    memcpy(data_, device_id, WIRE_ID_SIZE);
+}
+
+
+bool BinaryRequest::addByte(uint8_t value)
+{
+    if (length_ == sizeof(data_))
+    {
+        return false;
+    }
+    data_[length_++] = value;
+    return true;
+}
+
+
+bool BinaryRequest::addU32(uint32_t value)
+{
+    if (sizeof(data_) - length_ < 4)
+    {
+        return false;
+    }
+    wirePut32(data_ + length_, value);
+    length_ += 4;
+    return true;
+}
+
+
+bool BinaryRequest::addText(const char* text)
+{
+    size_t length = wirePackText(text, data_ + length_,
+                                 sizeof(data_) - length_);
+    length_ += length;
+    return length > 0;
+}
+
+
+void BinaryRequest::setByte(size_t offset, uint8_t value)
+{
+    data_[offset] = value;
+}
+
+
+size_t BinaryRequest::getLength() const noexcept
+{
+    return length_;
+}
+
+
+void BinaryRequest::truncate(size_t length)
+{
+    if (length < length_)
+    {
+        length_ = length;
+    }
+}
+
+
+const char* BinaryRequest::getContentType() const
+{
+    return "application/octet-stream";
+}
+
+
+size_t BinaryRequest::getContentLength() const
+{
+    return length_;
+}
+
+
+size_t BinaryRequest::writeTo(Print& out) const
+{
+    return out.write(data_, length_);
 }
 
 
@@ -237,59 +1056,609 @@ String FormDataFormatter::toString()
 /******************************************************************************/
 
 
-String writeToServer(ApplicationNetworkClient& client,
-                   FormDataFormatter& form,
-                   const char* url_path)
+bool sendRequest(WiFiClient& socket,
+                 const char* host,
+                 short port,
+                 const char* url_path,
+                 const RequestBody& request,
+                 bool keep_alive)
+{
+    char request_buffer[REQUEST_BUFFER_SIZE];
+    int head_length = snprintf(
+        request_buffer, sizeof(request_buffer),
+        "POST %s HTTP/1.1\r\n"
+        "Host: %s:%d\r\n"
+        "Connection: %s\r\n"
+        "Content-Type: %s\r\n"
+        "Content-Length: %u\r\n"
+        "\r\n",
+        url_path, host, (int)port, keep_alive ? "keep-alive" : "close",
+        request.getContentType(), (unsigned)request.getContentLength()
+    );
+    if (head_length < 0 || (size_t)head_length >= sizeof(request_buffer))
+    {
+        TRACE_ERROR("network", "Request head does not fit the request buffer");
+        return false;
+    }
+
+    // The body is encoded into the rest of the buffer, so head and body go
+    // out together when they fit
+    RequestWriter writer(socket, request_buffer, sizeof(request_buffer),
+                         head_length);
+    request.writeTo(writer);
+    writer.flush();
+    return !writer.failed();
+}
+
+
+int readResponseHead(WiFiClient& socket,
+                     long& content_length,
+                     bool& connection_close)
+{
+    char line[128];
+
+    // A server that closed the connection without reading the request, such
+    // as an idle connection it timed out, sends nothing at all
+    if (!waitForData(socket))
+    {
+        return socket.connected() ? -1 : RESPONSE_CLOSED;
+    }
+
+    // Status line, e.g. "HTTP/1.1 200 OK"
+    if (readLine(socket, line, sizeof(line)) < 0 ||
+        strncmp(line, "HTTP/1.", 7) != 0)
+    {
+        return -1;
+    }
+    const char* status = strchr(line, ' ');
+    if (status == NULL)
+    {
+        return -1;
+    }
+    // The line is reused for the header lines, so the code is read first
+    int status_code = atoi(status + 1);
+
+    // HTTP/1.0 servers close the connection unless told otherwise
+    if (line[7] == '0')
+    {
+        connection_close = true;
+    }
+
+    content_length = -1;
+    int length;
+    while ((length = readLine(socket, line, sizeof(line))) > 0)
+    {
+        if (strncasecmp(line, "Content-Length:", 15) == 0)
+        {
+            content_length = atol(line + 15);
+        }
+        else if (strncasecmp(line, "Connection:", 11) == 0)
+        {
+            const char* value = line + 11;
+            while (*value == ' ')
+            {
+                value++;
+            }
+            connection_close = strncasecmp(value, "close", 5) == 0;
+        }
+    }
+
+    // The head ends with an empty line
+    if (length < 0)
+    {
+        return -1;
+    }
+    return status_code;
+}
+
+
+int getResponseFromServer(ResponseBodyStream& body,
+                          char* buffer,
+                          size_t size,
+                          bool& overflowed)
+{
+    // One byte is kept for the null terminator
+    size_t length = 0;
+    while (length + 1 < size)
+    {
+        size_t received = body.readBytes(buffer + length, size - 1 - length);
+        if (received == 0)
+        {
+            break;
+        }
+        length += received;
+    }
+    buffer[length] = '\0';
+
+    overflowed = !body.finished() && body.peek() >= 0;
+    if (overflowed)
+    {
+        body.skipRemaining();
+        return -1;
+    }
+
+    // A body of unknown length ends with the connection; otherwise it must
+    // have arrived in full
+    return body.finished() ? (int)length : -1;
+}
+
+
+void finishResponse(WiFiClient& socket,
+                    ResponseBodyStream& body,
+                    bool connection_close)
+{
+    // Anything the caller left unread, such as a trailing newline, must be
+    // read off before the connection can carry the next response
+    if (!body.skipRemaining() || connection_close)
+    {
+        socket.stop();
+    }
+}
+
+
+bool parseMessages(Stream& body,
+                   JsonVariant message_filter,
+                   JsonDocument& doc,
+                   ApplicationNetworkClient::message_map* messages,
+                   int capacity,
+                   int& count,
+                   int& pending)
+{
+    count = 0;
+    pending = -1;
+
+    if (peekToken(body) != '{')
+    {
+        return false;
+    }
+    body.read();
+
+    if (peekToken(body) == '}')
+    {
+        body.read();
+        return true;
+    }
+
+    while (true)
+    {
+        char key[16];
+        if (!readJsonString(body, key, sizeof(key)) || peekToken(body) != ':')
+        {
+            return false;
+        }
+        body.read();
+
+        if (strcmp(key, "messages") == 0)
+        {
+            if (peekToken(body) != '[')
+            {
+                return false;
+            }
+            body.read();
+
+            bool more = peekToken(body) != ']';
+            if (!more)
+            {
+                body.read();
+            }
+            while (more)
+            {
+                if (count >= capacity)
+                {
+                    if (!skipJsonValue(body))
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    // Each message is parsed on its own, so only one is held
+                    // in the document at a time
+                    DeserializationError error = deserializeJson(
+                        doc, body, DeserializationOption::Filter(message_filter)
+                    );
+                    if (error)
+                    {
+                        TRACE_ERROR("network", "Could not parse message: %s",
+                                    error.c_str());
+                        return false;
+                    }
+
+                    ApplicationNetworkClient::message_map& message =
+                        messages[count++];
+                    message.macAddress = doc["macAddress"].as<const char*>();
+                    message.content = doc["content"].as<const char*>();
+                    message.time = doc["time"].as<const char*>();
+                }
+
+                // Either another message or the end of the array follows
+                int next = peekToken(body);
+                if (next != ',' && next != ']')
+                {
+                    return false;
+                }
+                body.read();
+                more = next == ',';
+            }
+        }
+        else if (strcmp(key, "pending") == 0)
+        {
+            long value;
+            if (!readJsonInteger(body, value))
+            {
+                return false;
+            }
+            pending = (int)value;
+        }
+        else if (!skipJsonValue(body))
+        {
+            return false;
+        }
+
+        int next = peekToken(body);
+        if (next == '}')
+        {
+            body.read();
+            return true;
+        }
+        if (next != ',')
+        {
+            return false;
+        }
+        body.read();
+    }
+}
+
+
+int peekToken(Stream& stream)
+{
+    int c = stream.peek();
+    while (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+    {
+        stream.read();
+        c = stream.peek();
+    }
+    return c;
+}
+
+
+bool readJsonString(Stream& stream, char* buffer, size_t size)
+{
+    if (peekToken(stream) != '"')
+    {
+        return false;
+    }
+    stream.read();
+
+    size_t length = 0;
+    bool escaped = false;
+    while (true)
+    {
+        int c = stream.read();
+        if (c < 0)
+        {
+            return false;
+        }
+        if (c == '"' && !escaped)
+        {
+            break;
+        }
+        escaped = c == '\\' && !escaped;
+        if (length + 1 < size)
+        {
+            buffer[length++] = (char)c;
+        }
+    }
+    buffer[length] = '\0';
+    return true;
+}
+
+
+bool readJsonInteger(Stream& stream, long& value)
+{
+    int c = peekToken(stream);
+    bool negative = c == '-';
+    if (negative)
+    {
+        stream.read();
+        c = stream.peek();
+    }
+    if (c < '0' || c > '9')
+    {
+        return false;
+    }
+
+    value = 0;
+    while (c >= '0' && c <= '9')
+    {
+        value = value * 10 + (c - '0');
+        stream.read();
+        c = stream.peek();
+    }
+    if (negative)
+    {
+        value = -value;
+    }
+    return true;
+}
+
+
+bool skipJsonValue(Stream& stream)
+{
+    int c = peekToken(stream);
+    if (c == '{' || c == '[' || c == '"')
+    {
+        // A filter of false keeps nothing, so the value is read but not stored
+        StaticJsonDocument<16> skip;
+        skip.set(false);
+        StaticJsonDocument<16> doc;
+        return !deserializeJson(doc, stream,
+                                DeserializationOption::Filter(skip));
+    }
+
+    // Numbers and literals end at the next delimiter, which is left unread
+    bool read_any = false;
+    while (c >= 0 && c != ',' && c != '}' && c != ']' && c != ' ' &&
+           c != '\t' && c != '\r' && c != '\n')
+    {
+        stream.read();
+        c = stream.peek();
+        read_any = true;
+    }
+    return read_any;
+}
+
+
+int readLine(WiFiClient& socket, char* buffer, size_t size)
+{
+    size_t length = 0;
+    while (true)
+    {
+        if (!waitForData(socket))
+        {
+            return -1;
+        }
+
+        char c = (char)socket.read();
+        if (c == '\n')
+        {
+            break;
+        }
+        if (c != '\r' && length + 1 < size)
+        {
+            buffer[length++] = c;
+        }
+    }
+    buffer[length] = '\0';
+    return (int)length;
+}
+
+
+bool waitForData(WiFiClient& socket)
+{
+    unsigned long start = millis();
+    while (!socket.available())
+    {
+        if (!socket.connected() || millis() - start > RESPONSE_TIMEOUT_MS)
+        {
+            return false;
+        }
+        delay(1);
+    }
+    return true;
+}
+
+
+/**
+ * Returns true if the byte is sent as it is in form data.
+ */
+static bool isUnreserved(unsigned char c)
+{
+    return isalnum(c) || c == '*' || c == '-' || c == '.' || c == '_';
+}
+
+
+size_t getEncodedLength(const char* text)
+{
+    size_t length = 0;
+    for (const unsigned char* c = (const unsigned char*)text; *c != '\0'; c++)
+    {
+        length += isUnreserved(*c) || *c == ' ' ? 1 : 3;
+    }
+    return length;
+}
+
+
+size_t writeEncoded(Print& out, const char* text)
+{
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
+
+    size_t length = 0;
+    for (const unsigned char* c = (const unsigned char*)text; *c != '\0'; c++)
+    {
+        if (isUnreserved(*c))
+        {
+            length += out.write(*c);
+        }
+        else if (*c == ' ')
+        {
+            length += out.write('+');
+        }
+        else
+        {
+            uint8_t escaped[3] = {'%', (uint8_t)HEX_DIGITS[*c >> 4],
+                                  (uint8_t)HEX_DIGITS[*c & 0x0F]};
+            length += out.write(escaped, sizeof(escaped));
+        }
+    }
+    return length;
+}
+
+
+/******************************************************************************/
+/* RequestWriter                                                              */
+/******************************************************************************/
+
+
+RequestWriter::RequestWriter(WiFiClient& socket,
+                             char* buffer,
+                             size_t size,
+                             size_t length)
+    : socket_(socket), buffer_(buffer), size_(size), length_(length),
+      failed_(false)
+{
+}
+
+
+size_t RequestWriter::write(uint8_t c)
+{
+    if (length_ == size_)
+    {
+        flush();
+    }
+    buffer_[length_++] = (char)c;
+    return 1;
+}
+
+
+size_t RequestWriter::write(const uint8_t* data, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        write(data[i]);
+    }
+    return length;
+}
+
+
+void RequestWriter::flush()
+{
+    if (length_ > 0)
+    {
+        if (socket_.write((const uint8_t*)buffer_, length_) != length_)
+        {
+            failed_ = true;
+        }
+        length_ = 0;
+    }
+}
+
+
+bool RequestWriter::failed() const noexcept
+{
+    return failed_;
+}
+
+
+/******************************************************************************/
+/* ResponseBodyStream                                                         */
+/******************************************************************************/
+
+
+ResponseBodyStream::ResponseBodyStream(WiFiClient& socket, long length)
+    : socket_(socket), remaining_(length), lost_(false)
 {
-    HttpClient http_client(client.getWifiClient());
-    String content = form.toString();
+}
+
+
+int ResponseBodyStream::available()
+{
+    if (remaining_ == 0 || lost_)
+    {
+        return 0;
+    }
 
-    http_client.beginRequest();
-    http_client.startRequest(client.getAddress(), client.getPort(), url_path,
-                             "POST", NULL);
-    http_client.sendHeader("Content-Type", "application/x-www-form-urlencoded");
-    http_client.sendHeader("Content-Length", content.length());
-    for (int i = 0; i < content.length(); i++)
+    int available = socket_.available();
+    if (remaining_ > 0 && available > remaining_)
+    {
+        available = (int)remaining_;
+    }
+    return available;
+}
+
+
+int ResponseBodyStream::read()
+{
+    if (!waitForBody())
     {
-        http_client.write(content.charAt(i));
+        return -1;
     }
-    http_client.endRequest();
 
-    // Check for OK response from server
-    String server_response = getResponseFromServer(http_client);
-    if (server_response.indexOf("OK\n") != 0)
+    int c = socket_.read();
+    if (c >= 0 && remaining_ > 0)
     {
-        Serial.println("Bad request");
+        remaining_--;
     }
+    return c;
+}
+
 
-    http_client.stop();
-    return server_response;
+int ResponseBodyStream::peek()
+{
+    if (!waitForBody())
+    {
+        return -1;
+    }
+    return socket_.peek();
 }
 
 
-String getResponseFromServer(HttpClient& http_client)
+size_t ResponseBodyStream::readBytes(char* buffer, size_t length)
 {
-    int error = http_client.responseStatusCode();
-    if (error != 200)
+    if (!waitForBody())
     {
-        // throw ApplicationNetworkException(
-        //     String("Getting response failed with HTTP code") + String(error)
-        // );
-        DEBUG("[ERROR] Getting response failed with HTTP code " + String(error));
+        return 0;
     }
 
-    error = http_client.skipResponseHeaders();
-    if (error < 0)
+    if (remaining_ > 0 && (long)length > remaining_)
+    {
+        length = (size_t)remaining_;
+    }
+    int received = socket_.read((uint8_t*)buffer, length);
+    if (received <= 0)
     {
-        // throw ApplicationNetworkException("Failed to skip response headers");
-        DEBUG("[ERROR] Failed to skip response errors; code " + String(error));
+        return 0;
     }
+    if (remaining_ > 0)
+    {
+        remaining_ -= received;
+    }
+    return (size_t)received;
+}
+
+
+size_t ResponseBodyStream::write(uint8_t)
+{
+    return 0;
+}
+
 
-    // Read response body
-    String response_message = String();
-    while (http_client.available())
+bool ResponseBodyStream::skipRemaining()
+{
+    char discard[64];
+    while (readBytes(discard, sizeof(discard)) > 0)
+    {
+    }
+    return finished();
+}
+
+
+bool ResponseBodyStream::finished() const noexcept
+{
+    return remaining_ == 0 || (remaining_ < 0 && lost_);
+}
+
+
+bool ResponseBodyStream::waitForBody()
+{
+    if (remaining_ == 0 || lost_)
     {
-        response_message += (char)http_client.read();
+        return false;
     }
-    return response_message;
-}
\ No newline at end of file
+    if (!waitForData(socket_))
+    {
+        lost_ = true;
+        return false;
+    }
+    return true;
+}
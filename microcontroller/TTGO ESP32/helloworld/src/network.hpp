@@ -3,11 +3,13 @@
 
 
 #include <Wifi.h>
-#include <HttpClient.h>
-#include <vector>
+#include <WiFiClientSecure.h>
 #include <ArduinoJson.h>
 
 
+class RequestBody;
+
+
 class ApplicationNetworkException
 {
 public:
@@ -35,6 +37,40 @@ public:
         String content;
         String time;
     };
+
+    /**
+     * Counters describing how the client has used its connection to the
+     * server since it was created.
+     */
+    struct connection_stats {
+        unsigned long requests;   // requests written to the server
+        unsigned long reused;     // requests sent over an already open socket
+        unsigned long reconnects; // times a new socket had to be opened,
+                                  // each with a handshake over TLS
+        unsigned long failures;   // requests that got no usable response
+        unsigned long overflows;  // responses too large for the buffer
+    };
+
+    /**
+     * How requests and responses are encoded. The form protocol posts form
+     * data and reads JSON; the binary protocol is described in wire.hpp.
+     */
+    enum wire_protocol {
+        FORM_PROTOCOL,
+        BINARY_PROTOCOL
+    };
+
+    /**
+     * Size of the buffer that holds the body of the last response. Larger
+     * responses are discarded, see writeToServer().
+     */
+    static const size_t RESPONSE_BUFFER_SIZE = 1024;
+
+    /**
+     * The most messages sent in one batch request.
+     */
+    static const int MAX_BATCH_SIZE = 4;
+
     /**
      * Creates a network client that will connect to a server. Any http requests
      * made by this client will be directed to that server and port.
@@ -57,10 +93,70 @@ public:
     short getPort() noexcept;
 
     /**
-     * Returns the Wifi client.
+     * Returns the Wifi client, which is a WiFiClientSecure over TLS.
      */
     WiFiClient& getWifiClient() noexcept;
 
+    /**
+     * Switches the client to HTTPS. The server must present a certificate
+     * signed by the CA, given in PEM form and kept by the caller, so only the
+     * pinned CA is trusted. Without a CA the server is not verified, which is
+     * only meant for testing. The open connection, if any, is closed.
+     *
+     * A TLS handshake costs far more than a request, so it is only paid when
+     * the connection has to be opened again; see setKeepAlive().
+     */
+    void setSecure(const char* ca_certificate);
+
+    /**
+     * Returns true if the client connects over TLS.
+     */
+    bool isSecure() const noexcept;
+
+    /**
+     * Enables or disables connection reuse. When enabled, requests are sent
+     * with "Connection: keep-alive" and the socket is left open for the next
+     * request. If the server has closed the socket in the meantime, a new one
+     * is opened, and a request already sent on the closed one is only sent
+     * again where that is safe, see startExchange(). Connection reuse is
+     * enabled by default.
+     */
+    void setKeepAlive(bool enabled);
+
+    /**
+     * Returns true if the client keeps its connection open between requests.
+     */
+    bool isKeepAlive() const noexcept;
+
+    /**
+     * Selects how requests and responses are encoded. The server must serve
+     * the protocol; it answers both by default. The form protocol is used by
+     * default.
+     */
+    void setProtocol(wire_protocol protocol);
+
+    /**
+     * Returns how requests and responses are encoded.
+     */
+    wire_protocol getProtocol() const noexcept;
+
+    /**
+     * Returns the connection reuse counters of this client.
+     */
+    const connection_stats& getConnectionStats() const noexcept;
+
+    /**
+     * Returns the HTTP status code of the last response, or -1 if the last
+     * request got no response.
+     */
+    int getLastStatusCode() const noexcept;
+
+    /**
+     * Closes the connection to the server if one is open. The next request
+     * opens a new connection.
+     */
+    void disconnect();
+
     /**
      * Notifies the server that the device exists. The device will be able to
      * send and receive messages in the application network. If the device is
@@ -83,8 +179,23 @@ public:
      * 
      * NOTICE: Sending a message will be broadcasted to all other devices
      * visible to the server.
+     *
+     * Returns true if the server accepted the message.
+     */
+    bool sendMessage(const char* message);
+
+    /**
+     * Sends up to MAX_BATCH_SIZE messages, oldest first, to the server in a
+     * single HTTP POST request. Each message carries its age, the milliseconds
+     * since it was composed, from which the server dates it.
+     *
+     * Returns the number of leading messages the server accepted, which is
+     * fewer than the count if the rest did not fit in the request, or 0 if the
+     * request failed.
      */
-    void sendMessage(const char* message);
+    int sendMessages(const char* const* messages,
+                     const unsigned long* ages_ms,
+                     int count);
 
     /**
      * Returns the number of messages the server has stored but not sent to the
@@ -97,31 +208,157 @@ public:
      * those messages will be sent. The number of pending messages to be sent to
      * the client are limited by the amount requested. There may be pending
      * messages afterwards. This sends an HTTP request to the server.
+     *
+     * The response is parsed as it arrives on the socket, one message at a
+     * time, into the array provided, which holds up to capacity messages and
+     * also limits how many are requested. Fields other than those of
+     * message_map are skipped unparsed, so the memory used does not depend on
+     * the number of messages. Returns the number of messages stored.
      */
-    void fetchPendingMessages(int amount);
+    int fetchPendingMessages(message_map* messages, int capacity);
 
     /**
-     * Returns a vector of message_maps representing messages that the client has
-     * fetched from the server. All the messages fetched will be returned and no
-     * longer managed by the ApplicationNetworkClient.
+     * Returns the number of messages pending for the device as of the last
+     * response that carried it, or -1 if none has yet. The server includes
+     * this count in the responses to every request, not only to
+     * countPendingMessages(), so it is often current without polling.
      */
-    std::vector<message_map> getFetchedMessages();
+    int getPendingCount() const noexcept;
+
+    /**
+     * Returns the millis() time at which getPendingCount() was last updated.
+     */
+    unsigned long getPendingCountTime() const noexcept;
 
 private:
+    /**
+     * Fetches pending messages with the binary protocol, see
+     * fetchPendingMessages().
+     */
+    int fetchBinaryMessages(message_map* messages, int capacity);
+
+    /**
+     * Writes the body to the server as a POST request to the url path. The body
+     * of the response is stored null-terminated in response_buffer_ and its
+     * length is returned. If no usable response was received, -1 is returned.
+     * See startExchange() for idempotent.
+     *
+     * A body that does not fit in the buffer is read off the connection and
+     * discarded, counted as an overflow, and reported as no response, so a
+     * truncated body is never handed to the JSON parser.
+     */
+    int writeToServer(const RequestBody& request, const char* url_path,
+                      bool idempotent);
+
+    /**
+     * Writes the body to the server as a POST request to the url path and reads
+     * the head of the response, leaving the body on the connection for the
+     * caller to read. Returns the HTTP status code, or -1 if no response was
+     * received. The content length is -1 if the server did not send one, and
+     * connection_close tells whether the server closes the connection after
+     * the body.
+     *
+     * If a reused connection turns out to be closed, the request is sent again
+     * on a new one only if it cannot have reached the server, or if it is
+     * idempotent, meaning that the server handling it twice does no harm, and
+     * the server closed the connection without answering. Requests that store
+     * or hand out messages are not idempotent.
+     */
+    int startExchange(const RequestBody& request,
+                      const char* url_path,
+                      bool idempotent,
+                      long& content_length,
+                      bool& connection_close);
+
+    /**
+     * Updates the pending count from the "pending" field of a response, if it
+     * has one.
+     */
+    void updatePendingCount(JsonDocument& doc);
+
+    /**
+     * Parses only the pending count of the last response body and updates the
+     * pending count from it.
+     */
+    void readPendingCount(int length);
+
+    /**
+     * Opens a new connection to the server, closing the previous one. Returns
+     * true if the connection was established.
+     */
+    bool connectToServer();
+
+    /**
+     * Returns the MAC address of the device, which identifies it to the
+     * server, as text and as the 6-byte id of the binary protocol. It is read
+     * once and kept, since every request carries it.
+     */
+    const char* getMacAddress();
+    const uint8_t* getDeviceId();
+
     const char* endpoint_address_;
     const short endpoint_port_;
-    WiFiClient wifi_client_;
-    std::vector<message_map> pending_messages_;
+    WiFiClient plain_client_;
+    WiFiClientSecure secure_client_;
+    WiFiClient* wifi_client_; // whichever of the two is in use
+    bool keep_alive_;
+    wire_protocol protocol_;
+    connection_stats stats_;
+    int last_status_code_;
+    int pending_count_;
+    unsigned long pending_count_time_;
+    char mac_address_[18];
+    uint8_t device_id_[6];
+    char response_buffer_[RESPONSE_BUFFER_SIZE];
+
+    // A fetched message is parsed into this rather than into a local, to keep
+    // it off the stack of the network task, which a TLS handshake also needs
+    StaticJsonDocument<512> message_document_;
+};
+
+
+/**
+ * The body of a POST request to the server.
+ */
+class RequestBody
+{
+public:
+    virtual ~RequestBody() {}
+
+    /**
+     * Returns the value of the Content-Type header.
+     */
+    virtual const char* getContentType() const = 0;
+
+    /**
+     * Returns the exact number of bytes writeTo() writes.
+     */
+    virtual size_t getContentLength() const = 0;
+
+    /**
+     * Writes the body. Returns the number of bytes written.
+     */
+    virtual size_t writeTo(Print& out) const = 0;
 };
 
 
 /**
  * Used since the server only requires http POST requests. This requires the
  * content body of the request to be in form data.
+ *
+ * The pairs are not copied: the formatter only keeps pointers to the keys and
+ * values, which must outlive it. The body is encoded as it is written, so it
+ * never exists as a whole in memory.
  */
-class FormDataFormatter
+class FormDataFormatter : public RequestBody
 {
 public:
+    /**
+     * The most key-value pairs a formatter holds, enough for the device and a
+     * full batch of messages with their ages. Further pairs are ignored.
+     */
+    static const int MAX_PAIRS = 1 + 2 * ApplicationNetworkClient::MAX_BATCH_SIZE;
+
     /**
      * Creates a formatter to format key-value pairs in the proper format.
      */
@@ -132,14 +369,24 @@ public:
      */
     void addPair(const char* key, const char* value);
 
+    const char* getContentType() const override;
+
+    /**
+     * Returns the length of the body once the pairs are percent-encoded,
+     * which is the Content-Length of the request.
+     */
+    size_t getContentLength() const override;
+
     /**
-     * Converts the pairs into a string.
+     * Writes the percent-encoded pairs. Returns the number of bytes written,
+     * which is getContentLength().
      */
-    String toString();
+    size_t writeTo(Print& out) const override;
 
 private:
     int key_value_pairs_;
-    String output_;
+    const char* keys_[MAX_PAIRS];
+    const char* values_[MAX_PAIRS];
 };
 
 
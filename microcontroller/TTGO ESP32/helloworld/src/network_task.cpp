@@ -0,0 +1,378 @@
+#include "network_task.hpp"
+#include "trace.hpp"
+
+
+/**
+ * Stack size of the network task in bytes. The document a fetched message is
+ * parsed into is a member of the client, but the smaller JSON documents, the
+ * request buffer and the messages of flushOutbox() and prefetch() live on the
+ * stack.
+ */
+static const uint32_t NETWORK_TASK_STACK_SIZE = 8192;
+
+/**
+ * Stack size of the network task over TLS. The mbedTLS handshake and record
+ * layer run on the task, on top of what the plain client needs.
+ */
+static const uint32_t NETWORK_TASK_TLS_STACK_SIZE = 12288;
+
+
+NetworkTask::NetworkTask(ApplicationNetworkClient& client, Outbox& outbox)
+    : client_(client), outbox_(outbox), task_(NULL), wake_task_(NULL), requests_(), completions_(), cache_(),
+      in_flight_(), batch_size_(BATCH_SIZE), batch_latency_ms_(BATCH_LATENCY_MS),
+      batch_route_(true)
+{
+}
+
+
+bool NetworkTask::begin(BaseType_t core)
+{
+    if (task_ != NULL)
+    {
+        return true;
+    }
+
+    uint32_t stack_size = client_.isSecure() ?
+        NETWORK_TASK_TLS_STACK_SIZE : NETWORK_TASK_STACK_SIZE;
+    BaseType_t result = xTaskCreatePinnedToCore(
+        run, "network", stack_size, this, 1, &task_, core
+    );
+    return result == pdPASS;
+}
+
+
+uint32_t NetworkTask::getStackHighWaterMark() const noexcept
+{
+    return task_ == NULL ? 0 : uxTaskGetStackHighWaterMark(task_);
+}
+
+
+void NetworkTask::setWakeTask(TaskHandle_t task) noexcept
+{
+    wake_task_ = task;
+}
+
+
+void NetworkTask::setBatching(size_t size, unsigned long latency_ms) noexcept
+{
+    if (size < 1)
+    {
+        size = 1;
+    }
+    else if (size > (size_t)ApplicationNetworkClient::MAX_BATCH_SIZE)
+    {
+        size = ApplicationNetworkClient::MAX_BATCH_SIZE;
+    }
+    batch_size_ = size;
+    batch_latency_ms_ = latency_ms;
+}
+
+
+bool NetworkTask::submit(request_type type, int amount, const char* message)
+{
+    network_request request;
+    request.type = type;
+    request.amount = amount;
+    request.message[0] = '\0';
+    if (message != NULL)
+    {
+        strncpy(request.message, message, MESSAGE_CAPACITY);
+        request.message[MESSAGE_CAPACITY] = '\0';
+    }
+
+    // Count the request before the task can complete it
+    in_flight_[type]++;
+    if (!requests_.push(request))
+    {
+        in_flight_[type]--;
+        return false;
+    }
+
+    xTaskNotifyGive(task_);
+    return true;
+}
+
+
+bool NetworkTask::poll(network_completion& completion)
+{
+    return completions_.pop(completion);
+}
+
+
+bool NetworkTask::takeMessage(ApplicationNetworkClient::message_map& message)
+{
+    if (!cache_.pop(message))
+    {
+        return false;
+    }
+
+    // Let the network task refill the cache
+    xTaskNotifyGive(task_);
+    return true;
+}
+
+
+size_t NetworkTask::getCachedMessages() const noexcept
+{
+    return cache_.size();
+}
+
+
+size_t NetworkTask::getInFlight() const noexcept
+{
+    size_t total = 0;
+    for (size_t i = 0; i <= FETCH; i++)
+    {
+        total += in_flight_[i];
+    }
+    return total;
+}
+
+
+size_t NetworkTask::getInFlight(request_type type) const noexcept
+{
+    return in_flight_[type];
+}
+
+
+void NetworkTask::run(void* arg)
+{
+    NetworkTask& self = *static_cast<NetworkTask*>(arg);
+    network_request request;
+
+    while (true)
+    {
+        // Sleep until a request comes in or the next delivery attempt is due,
+        // which waits for both the backoff and the batch
+        TickType_t timeout = portMAX_DELAY;
+        if (!self.outbox_.empty())
+        {
+            unsigned long now = millis();
+            timeout = pdMS_TO_TICKS(max(self.outbox_.getDelay(now),
+                                        self.getBatchDelay(now)));
+        }
+        ulTaskNotifyTake(pdTRUE, timeout);
+
+        while (self.requests_.pop(request))
+        {
+            self.complete(self.perform(request));
+            self.in_flight_[request.type]--;
+        }
+        if (self.outbox_.isDue(millis()) && self.isBatchDue(millis()))
+        {
+            // A message reported as queued is reported again once it leaves
+            // the outbox, so the caller learns that it was sent
+            unsigned long pending_count_time = self.client_.getPendingCountTime();
+            if (self.flushOutbox() > 0)
+            {
+                network_completion completion;
+                completion.type = SEND;
+                completion.count = (int)self.outbox_.size();
+                completion.pending = -1;
+                if (self.client_.getPendingCountTime() != pending_count_time)
+                {
+                    completion.pending = self.client_.getPendingCount();
+                }
+                self.complete(completion);
+            }
+        }
+
+        // Keep the cache filled while the server has messages for the device
+        if (self.client_.getPendingCount() > 0 &&
+            self.cache_.size() < self.cache_.capacity())
+        {
+            request.type = FETCH;
+            request.amount = PREFETCH_SIZE;
+            self.complete(self.perform(request));
+        }
+    }
+}
+
+
+NetworkTask::network_completion NetworkTask::perform(
+    const network_request& request
+)
+{
+    network_completion completion;
+    completion.type = request.type;
+    completion.count = 0;
+    completion.pending = -1;
+
+    unsigned long pending_count_time = client_.getPendingCountTime();
+
+    switch (request.type)
+    {
+    case REGISTER:
+        client_.makeVisible();
+        break;
+
+    case SEND:
+        if (!outbox_.push(request.message, millis()))
+        {
+            completion.count = -1;
+            break;
+        }
+        if (outbox_.isDue(millis()) && isBatchDue(millis()))
+        {
+            flushOutbox();
+        }
+        completion.count = (int)outbox_.size();
+        break;
+
+    case COUNT:
+        completion.count = client_.countPendingMessages();
+        break;
+
+    case FETCH:
+        completion.count = prefetch(request.amount);
+        break;
+    }
+
+    // Any response may have carried the pending count; pass it on if so
+    if (client_.getPendingCountTime() != pending_count_time)
+    {
+        completion.pending = client_.getPendingCount();
+    }
+    return completion;
+}
+
+
+int NetworkTask::prefetch(int amount)
+{
+    int space = (int)(cache_.capacity() - cache_.size());
+    if (amount > PREFETCH_SIZE)
+    {
+        amount = PREFETCH_SIZE;
+    }
+    if (amount > space)
+    {
+        amount = space;
+    }
+    if (amount <= 0)
+    {
+        return 0;
+    }
+
+    // Only this task adds to the cache, so the room counted above remains
+    ApplicationNetworkClient::message_map messages[PREFETCH_SIZE];
+    int fetched = client_.fetchPendingMessages(messages, amount);
+
+    int added = 0;
+    for (int i = 0; i < fetched; i++)
+    {
+        if (cache_.push(std::move(messages[i])))
+        {
+            added++;
+        }
+    }
+    return added;
+}
+
+
+void NetworkTask::complete(const network_completion& completion)
+{
+    while (!completions_.push(completion))
+    {
+        vTaskDelay(1);
+    }
+    if (wake_task_ != NULL)
+    {
+        xTaskNotifyGive(wake_task_);
+    }
+}
+
+
+bool NetworkTask::isBatchDue(unsigned long now) const noexcept
+{
+    return !outbox_.empty() && getBatchDelay(now) == 0;
+}
+
+
+unsigned long NetworkTask::getBatchDelay(unsigned long now) const noexcept
+{
+    if (outbox_.size() >= batch_size_)
+    {
+        return 0;
+    }
+    unsigned long waited = now - outbox_.getQueuedAt(0);
+    return waited >= batch_latency_ms_ ? 0 : batch_latency_ms_ - waited;
+}
+
+
+int NetworkTask::flushOutbox()
+{
+    const int max_batch = ApplicationNetworkClient::MAX_BATCH_SIZE;
+    char messages[max_batch][MESSAGE_CAPACITY + 1];
+    const char* batch[max_batch];
+    unsigned long ages_ms[max_batch];
+    unsigned long now = millis();
+
+    size_t count = 0;
+    int removed = 0;
+    while (count < batch_size_ && count < outbox_.size())
+    {
+        if (!outbox_.peek(count, messages[count], sizeof(messages[count])))
+        {
+            // A slot that cannot be read would block the outbox forever
+            if (count == 0)
+            {
+                outbox_.pop();
+                removed++;
+                continue;
+            }
+            break;
+        }
+        batch[count] = messages[count];
+        ages_ms[count] = now - outbox_.getQueuedAt(count);
+        count++;
+    }
+    if (count == 0)
+    {
+        return removed;
+    }
+
+    // The server may take fewer messages than were batched if they did not
+    // fit in the request; the rest go with the next batch
+    int sent = 0;
+    int status = 0;
+    if (batch_route_)
+    {
+        sent = client_.sendMessages(batch, ages_ms, (int)count);
+        status = client_.getLastStatusCode();
+        if (sent == 0 && (status == 404 || status == 405))
+        {
+            TRACE_WARN("network", "No batch route on the server (%d), "
+                       "sending messages one at a time", status);
+            batch_route_ = false;
+        }
+    }
+    if (!batch_route_)
+    {
+        // Stop at the first failure so the messages stay in order
+        while (sent < (int)count && client_.sendMessage(batch[sent]))
+        {
+            sent++;
+        }
+        status = client_.getLastStatusCode();
+    }
+    if (sent > 0)
+    {
+        outbox_.pop(sent);
+        outbox_.onSuccess();
+        return removed + sent;
+    }
+
+    // The server rejected the messages themselves; sending them again will
+    // not change that. A missing route is not a rejection of the messages.
+    if (status >= 400 && status < 500 && status != 404 && status != 405)
+    {
+        int rejected = batch_route_ ? (int)count : 1;
+        TRACE_WARN("network", "The server rejected %d messages (%d)",
+                   rejected, status);
+        outbox_.pop(rejected);
+        return removed + rejected;
+    }
+
+    outbox_.onFailure(millis(), esp_random());
+    return removed;
+}
@@ -0,0 +1,207 @@
+#ifndef HELLOWORLD_NETWORK_TASK_HPP
+#define HELLOWORLD_NETWORK_TASK_HPP
+
+
+#include <Arduino.h>
+#include <atomic>
+
+#include "network.hpp"
+#include "outbox.hpp"
+#include "ring_buffer.hpp"
+
+
+/**
+ * Runs the requests of an ApplicationNetworkClient on a FreeRTOS task of its
+ * own, so that the caller never waits on the network. Requests are submitted
+ * and completions are collected through bounded lock-free queues; the caller
+ * polls for completions instead of blocking.
+ *
+ * Incoming messages are prefetched into a bounded cache whenever the server
+ * reports pending messages, so they can be read without waiting on the
+ * network.
+ *
+ * Outgoing messages go through an outbox: they are stored first and delivered
+ * by the network task, which retries failed deliveries with backoff. Messages
+ * composed in quick succession are coalesced and delivered together in one
+ * batch request, or one at a time if the server has no batch route.
+ *
+ * Once begin() has been called, the network task owns the client, its socket
+ * and the outbox. They must not be used directly anymore.
+ */
+class NetworkTask
+{
+public:
+    /**
+     * The longest message that can be sent, not counting the terminator.
+     * Longer messages are truncated.
+     */
+    static const size_t MESSAGE_CAPACITY = Outbox::MESSAGE_CAPACITY;
+
+    /**
+     * The most messages fetched in one request.
+     */
+    static const int PREFETCH_SIZE = 4;
+
+    /**
+     * The default number of queued messages that are delivered together in
+     * one batch request. A batch is sent as soon as this many messages are
+     * queued.
+     */
+    static const size_t BATCH_SIZE = 4;
+
+    /**
+     * The default longest time a message waits in the outbox for others to
+     * join its batch.
+     */
+    static const unsigned long BATCH_LATENCY_MS = 1500;
+
+    enum request_type {
+        REGISTER, // ApplicationNetworkClient::makeVisible()
+        SEND,     // Outbox::push(), then delivery
+        COUNT,    // ApplicationNetworkClient::countPendingMessages()
+        FETCH,    // prefetch of up to `amount` messages into the cache
+    };
+
+    struct network_request {
+        request_type type;
+        int amount;                         // FETCH only
+        char message[MESSAGE_CAPACITY + 1]; // SEND only
+    };
+
+    /**
+     * The result of a request. Prefetches made by the network task on its own
+     * also produce FETCH completions, and deliveries it makes on its own, of
+     * batches and retries, produce SEND completions.
+     */
+    struct network_completion {
+        request_type type;
+        int count;   // COUNT: pending messages; FETCH: messages added to the
+                     // cache; SEND: messages still in the outbox, -1 if the
+                     // message could not be stored
+        int pending; // messages pending for the device as reported with the
+                     // response, -1 if it did not report them
+    };
+
+    NetworkTask(ApplicationNetworkClient& client, Outbox& outbox);
+
+    /**
+     * Starts the network task pinned to the core. The Arduino loop runs on
+     * core 1, so core 0 keeps network latency out of the loop. The task gets
+     * a larger stack if the client uses TLS, so setSecure() must be called
+     * before. Returns false if the task could not be created.
+     */
+    bool begin(BaseType_t core = 0);
+
+    /**
+     * Returns the fewest bytes of the stack of the task that were ever left
+     * unused, or 0 before the task is started.
+     */
+    uint32_t getStackHighWaterMark() const noexcept;
+
+    /**
+     * Notifies the task whenever a completion is queued, so a task blocked in
+     * ulTaskNotifyTake() wakes up for it.
+     */
+    void setWakeTask(TaskHandle_t task) noexcept;
+
+    /**
+     * Sets how many messages are delivered together, at most
+     * ApplicationNetworkClient::MAX_BATCH_SIZE, and how long the oldest
+     * message waits for the batch to fill. A size of 1 or a latency of 0 sends
+     * each message on its own right away. Must be called before begin().
+     */
+    void setBatching(size_t size, unsigned long latency_ms) noexcept;
+
+    /**
+     * Queues a request for the network task. Returns false if the request
+     * queue is full.
+     *
+     * A SEND completes once the message is stored; a count above zero means
+     * it is still queued, and a later SEND completion follows when the batch
+     * or retry that carries it has been delivered.
+     */
+    bool submit(request_type type, int amount = 0, const char* message = NULL);
+
+    /**
+     * Removes the oldest completion and stores it in the completion. Returns
+     * false if no request has completed.
+     */
+    bool poll(network_completion& completion);
+
+    /**
+     * Moves the oldest cached message into the message. Returns false if no
+     * message is cached. Taking a message makes room for the network task to
+     * prefetch another.
+     */
+    bool takeMessage(ApplicationNetworkClient::message_map& message);
+
+    /**
+     * Returns the number of messages in the cache.
+     */
+    size_t getCachedMessages() const noexcept;
+
+    /**
+     * Returns the number of submitted requests that have not been completed
+     * yet.
+     */
+    size_t getInFlight() const noexcept;
+
+    /**
+     * Returns the number of submitted requests of the type that have not been
+     * completed yet.
+     */
+    size_t getInFlight(request_type type) const noexcept;
+
+private:
+    static void run(void* arg);
+
+    /**
+     * Performs a request on the client and returns its completion.
+     */
+    network_completion perform(const network_request& request);
+
+    /**
+     * Fetches up to the amount of pending messages into the cache, limited by
+     * PREFETCH_SIZE and the room left. Returns the number of messages added.
+     */
+    int prefetch(int amount);
+
+    /**
+     * Queues a completion, waiting for the caller to make space if needed.
+     */
+    void complete(const network_completion& completion);
+
+    /**
+     * Returns true if the queued messages make a batch at the time, because
+     * there are enough of them or the oldest has waited long enough.
+     */
+    bool isBatchDue(unsigned long now) const noexcept;
+
+    /**
+     * Returns the milliseconds from the time until the queued messages make a
+     * batch, zero if they already do.
+     */
+    unsigned long getBatchDelay(unsigned long now) const noexcept;
+
+    /**
+     * Delivers the oldest messages of the outbox in one batch request, or one
+     * at a time if the server has no batch route. Returns the number of
+     * messages removed from the outbox, whether delivered or rejected.
+     */
+    int flushOutbox();
+
+    ApplicationNetworkClient& client_;
+    Outbox& outbox_;
+    TaskHandle_t task_;
+    TaskHandle_t wake_task_;
+    RingBuffer<network_request, 8> requests_;
+    RingBuffer<network_completion, 8> completions_;
+    RingBuffer<ApplicationNetworkClient::message_map, 8> cache_;
+    std::atomic<size_t> in_flight_[FETCH + 1];
+    size_t batch_size_;
+    unsigned long batch_latency_ms_;
+    bool batch_route_; // false once the server answered a batch with 404/405
+};
+
+
+#endif
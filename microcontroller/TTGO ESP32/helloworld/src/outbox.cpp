@@ -0,0 +1,219 @@
+#include "outbox.hpp"
+
+#include <string.h>
+
+
+/******************************************************************************/
+/* MemoryOutboxStorage                                                        */
+/******************************************************************************/
+
+
+MemoryOutboxStorage::MemoryOutboxStorage()
+    : head_(0), tail_(0), slots_()
+{
+}
+
+
+bool MemoryOutboxStorage::begin()
+{
+    return true;
+}
+
+
+void MemoryOutboxStorage::readCounters(uint32_t& head, uint32_t& tail)
+{
+    head = head_;
+    tail = tail_;
+}
+
+
+bool MemoryOutboxStorage::writeHead(uint32_t head)
+{
+    head_ = head;
+    return true;
+}
+
+
+bool MemoryOutboxStorage::writeTail(uint32_t tail)
+{
+    tail_ = tail;
+    return true;
+}
+
+
+bool MemoryOutboxStorage::readSlot(size_t slot, char* message, size_t size)
+{
+    if (slot >= sizeof(slots_) / sizeof(slots_[0]) || size == 0)
+    {
+        return false;
+    }
+    strncpy(message, slots_[slot], size - 1);
+    message[size - 1] = '\0';
+    return true;
+}
+
+
+bool MemoryOutboxStorage::writeSlot(size_t slot, const char* message)
+{
+    if (slot >= sizeof(slots_) / sizeof(slots_[0]))
+    {
+        return false;
+    }
+    strncpy(slots_[slot], message, sizeof(slots_[slot]) - 1);
+    slots_[slot][sizeof(slots_[slot]) - 1] = '\0';
+    return true;
+}
+
+
+/******************************************************************************/
+/* Outbox                                                                     */
+/******************************************************************************/
+
+
+Outbox::Outbox(OutboxStorage& storage)
+    : storage_(storage), head_(0), tail_(0), queued_at_(), backoff_ms_(MIN_BACKOFF_MS),
+      next_attempt_(0), waiting_(false)
+{
+}
+
+
+bool Outbox::begin(unsigned long now)
+{
+    if (!storage_.begin())
+    {
+        return false;
+    }
+
+    storage_.readCounters(head_, tail_);
+
+    // Counters that do not describe a valid queue start it over empty
+    if (tail_ - head_ > CAPACITY)
+    {
+        head_ = tail_;
+        storage_.writeHead(head_);
+    }
+    for (size_t i = 0; i < CAPACITY; i++)
+    {
+        queued_at_[i] = now;
+    }
+    return true;
+}
+
+
+bool Outbox::push(const char* message, unsigned long now)
+{
+    if (size() >= CAPACITY || strlen(message) > MESSAGE_CAPACITY)
+    {
+        return false;
+    }
+
+    // Messages such as "CQ" come round to the same slot again; reading the
+    // slot is cheaper than wearing the flash with a write that changes nothing
+    size_t slot = tail_ % CAPACITY;
+    char stored[MESSAGE_CAPACITY + 1];
+    bool unchanged = storage_.readSlot(slot, stored, sizeof(stored)) &&
+                     strcmp(stored, message) == 0;
+
+    // The slot is written before the tail so a restart in between cannot
+    // expose a slot that was never written
+    if ((!unchanged && !storage_.writeSlot(slot, message)) ||
+        !storage_.writeTail(tail_ + 1))
+    {
+        return false;
+    }
+    queued_at_[slot] = now;
+    tail_++;
+    return true;
+}
+
+
+bool Outbox::peek(char* message, size_t size)
+{
+    return peek(0, message, size);
+}
+
+
+bool Outbox::peek(size_t index, char* message, size_t size)
+{
+    if (index >= this->size())
+    {
+        return false;
+    }
+    return storage_.readSlot((head_ + index) % CAPACITY, message, size);
+}
+
+
+unsigned long Outbox::getQueuedAt(size_t index) const noexcept
+{
+    return queued_at_[(head_ + index) % CAPACITY];
+}
+
+
+void Outbox::pop()
+{
+    pop(1);
+}
+
+
+void Outbox::pop(size_t count)
+{
+    if (count > size())
+    {
+        count = size();
+    }
+    if (count == 0)
+    {
+        return;
+    }
+    head_ += count;
+    storage_.writeHead(head_);
+}
+
+
+size_t Outbox::size() const noexcept
+{
+    return tail_ - head_;
+}
+
+
+bool Outbox::empty() const noexcept
+{
+    return head_ == tail_;
+}
+
+
+bool Outbox::isDue(unsigned long now) const noexcept
+{
+    return !empty() && getDelay(now) == 0;
+}
+
+
+unsigned long Outbox::getDelay(unsigned long now) const noexcept
+{
+    if (!waiting_ || (long)(now - next_attempt_) >= 0)
+    {
+        return 0;
+    }
+    return next_attempt_ - now;
+}
+
+
+void Outbox::onSuccess() noexcept
+{
+    backoff_ms_ = MIN_BACKOFF_MS;
+    waiting_ = false;
+}
+
+
+void Outbox::onFailure(unsigned long now, uint32_t entropy) noexcept
+{
+    unsigned long half = backoff_ms_ / 2;
+    next_attempt_ = now + half + entropy % (half + 1);
+    waiting_ = true;
+
+    backoff_ms_ *= 2;
+    if (backoff_ms_ > MAX_BACKOFF_MS)
+    {
+        backoff_ms_ = MAX_BACKOFF_MS;
+    }
+}
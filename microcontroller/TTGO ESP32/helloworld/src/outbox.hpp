@@ -0,0 +1,173 @@
+#ifndef HELLOWORLD_OUTBOX_HPP
+#define HELLOWORLD_OUTBOX_HPP
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * Where the outbox keeps its messages. Messages are stored in a fixed number
+ * of slots that are reused in order, so each message costs one slot write when
+ * queued and one counter write each when queued and removed.
+ */
+class OutboxStorage
+{
+public:
+    virtual ~OutboxStorage() {}
+
+    /**
+     * Prepares the storage for use. Returns false if it is not available.
+     */
+    virtual bool begin() = 0;
+
+    /**
+     * Reads the head and tail counters. A storage that was never written
+     * reports both as zero.
+     */
+    virtual void readCounters(uint32_t& head, uint32_t& tail) = 0;
+
+    virtual bool writeHead(uint32_t head) = 0;
+    virtual bool writeTail(uint32_t tail) = 0;
+
+    /**
+     * Reads the null-terminated message of the slot into the buffer. Returns
+     * false if the slot could not be read.
+     */
+    virtual bool readSlot(size_t slot, char* message, size_t size) = 0;
+
+    virtual bool writeSlot(size_t slot, const char* message) = 0;
+};
+
+
+/**
+ * A durable queue of outgoing messages with a retry schedule. Messages are
+ * removed only once the server has accepted them. After a failed delivery the
+ * next attempt is delayed with exponential backoff and jitter.
+ */
+class Outbox
+{
+public:
+    /**
+     * The number of messages the outbox holds.
+     */
+    static const size_t CAPACITY = 16;
+
+    /**
+     * The longest message that can be queued, not counting the terminator.
+     * Longer messages are refused rather than sent cut short.
+     */
+    static const size_t MESSAGE_CAPACITY = 127;
+
+    /**
+     * The delay after the first failure, and the most the delay grows to.
+     */
+    static const unsigned long MIN_BACKOFF_MS = 2000;
+    static const unsigned long MAX_BACKOFF_MS = 300000;
+
+    Outbox(OutboxStorage& storage);
+
+    /**
+     * Loads the messages left in storage from before a restart, which count
+     * as queued at the time. Returns false if the storage is not available.
+     */
+    bool begin(unsigned long now);
+
+    /**
+     * Appends a message queued at the time. Returns false if the outbox is
+     * full, the message is longer than MESSAGE_CAPACITY or it could not be
+     * stored; the message is not queued then. A slot that already holds the
+     * message is not written again.
+     */
+    bool push(const char* message, unsigned long now);
+
+    /**
+     * Copies the oldest message into the buffer. Returns false if the outbox
+     * is empty or the message could not be read.
+     */
+    bool peek(char* message, size_t size);
+
+    /**
+     * Copies the message at the index, counted from the oldest, into the
+     * buffer. Returns false if there is no such message or it could not be
+     * read.
+     */
+    bool peek(size_t index, char* message, size_t size);
+
+    /**
+     * Returns the time the message at the index, counted from the oldest, was
+     * queued at. The times are only kept in memory.
+     */
+    unsigned long getQueuedAt(size_t index) const noexcept;
+
+    /**
+     * Removes the oldest message.
+     */
+    void pop();
+
+    /**
+     * Removes the count oldest messages with a single write of the head.
+     */
+    void pop(size_t count);
+
+    size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    /**
+     * Returns true if a delivery may be attempted at the time.
+     */
+    bool isDue(unsigned long now) const noexcept;
+
+    /**
+     * Returns the milliseconds from the time until a delivery may be
+     * attempted, zero if one may be attempted right away.
+     */
+    unsigned long getDelay(unsigned long now) const noexcept;
+
+    /**
+     * Records a successful delivery, which resets the backoff.
+     */
+    void onSuccess() noexcept;
+
+    /**
+     * Records a failed delivery at the time. The next attempt is scheduled a
+     * random delay between half and all of the current backoff later, taken
+     * from the entropy, and the backoff doubles up to MAX_BACKOFF_MS.
+     */
+    void onFailure(unsigned long now, uint32_t entropy) noexcept;
+
+private:
+    OutboxStorage& storage_;
+    uint32_t head_;
+    uint32_t tail_;
+    unsigned long queued_at_[CAPACITY];
+    unsigned long backoff_ms_;
+    unsigned long next_attempt_;
+    bool waiting_;
+};
+
+
+/**
+ * Storage that keeps the outbox in RAM. Messages do not survive a restart, but
+ * the outbox can be used where no flash is available, such as on a host.
+ */
+class MemoryOutboxStorage : public OutboxStorage
+{
+public:
+    MemoryOutboxStorage();
+
+    bool begin() override;
+    void readCounters(uint32_t& head, uint32_t& tail) override;
+    bool writeHead(uint32_t head) override;
+    bool writeTail(uint32_t tail) override;
+    bool readSlot(size_t slot, char* message, size_t size) override;
+    bool writeSlot(size_t slot, const char* message) override;
+
+private:
+    uint32_t head_;
+    uint32_t tail_;
+    char slots_[Outbox::CAPACITY][Outbox::MESSAGE_CAPACITY + 1];
+};
+
+
+#endif
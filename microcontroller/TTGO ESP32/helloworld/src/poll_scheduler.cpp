@@ -0,0 +1,103 @@
+#include "poll_scheduler.hpp"
+
+
+PollScheduler::PollScheduler()
+    : start_(0), next_poll_(0), interval_(BASE_INTERVAL_MS), last_count_(-1),
+      polls_(0), piggybacked_(0)
+{
+}
+
+
+void PollScheduler::begin(unsigned long now) noexcept
+{
+    start_ = now;
+    next_poll_ = now;
+}
+
+
+bool PollScheduler::isDue(unsigned long now) const noexcept
+{
+    return (long)(now - next_poll_) >= 0;
+}
+
+
+unsigned long PollScheduler::getDelay(unsigned long now) const noexcept
+{
+    return isDue(now) ? 0 : next_poll_ - now;
+}
+
+
+unsigned long PollScheduler::getInterval() const noexcept
+{
+    return interval_;
+}
+
+
+void PollScheduler::onPoll(unsigned long now) noexcept
+{
+    polls_++;
+    next_poll_ = now + interval_;
+}
+
+
+void PollScheduler::onPendingCount(unsigned long now,
+                                   int count,
+                                   bool piggybacked) noexcept
+{
+    if (piggybacked)
+    {
+        piggybacked_++;
+    }
+
+    if (count != last_count_)
+    {
+        interval_ = MIN_INTERVAL_MS;
+    }
+    else
+    {
+        interval_ += interval_ / 2;
+        if (interval_ > MAX_INTERVAL_MS)
+        {
+            interval_ = MAX_INTERVAL_MS;
+        }
+    }
+    last_count_ = count;
+
+    // The count is fresh, so the next poll is an interval from now
+    next_poll_ = now + interval_;
+}
+
+
+void PollScheduler::onActivity(unsigned long now) noexcept
+{
+    interval_ = MIN_INTERVAL_MS;
+    if (getDelay(now) > interval_)
+    {
+        next_poll_ = now + interval_;
+    }
+}
+
+
+unsigned long PollScheduler::getPolls() const noexcept
+{
+    return polls_;
+}
+
+
+unsigned long PollScheduler::getPiggybacked() const noexcept
+{
+    return piggybacked_;
+}
+
+
+long PollScheduler::getSavedPerHour(unsigned long now) const noexcept
+{
+    unsigned long elapsed = now - start_;
+    if (elapsed == 0)
+    {
+        return 0;
+    }
+
+    long saved = (long)(elapsed / BASE_INTERVAL_MS) - (long)polls_;
+    return (long)((long long)saved * 3600000LL / (long long)elapsed);
+}
@@ -0,0 +1,103 @@
+#ifndef HELLOWORLD_POLL_SCHEDULER_HPP
+#define HELLOWORLD_POLL_SCHEDULER_HPP
+
+
+/**
+ * Decides when to poll the server for the number of pending messages. Every
+ * response from the server carries the pending count, so any request counts
+ * as a poll and pushes the next one back. The interval between polls shortens
+ * after recent activity and grows while nothing changes.
+ *
+ * All times are millis() values.
+ */
+class PollScheduler
+{
+public:
+    /**
+     * The interval right after activity.
+     */
+    static const unsigned long MIN_INTERVAL_MS = 2000;
+
+    /**
+     * The interval the scheduler starts with, which was previously used as a
+     * fixed interval. Savings are reported against it.
+     */
+    static const unsigned long BASE_INTERVAL_MS = 5000;
+
+    /**
+     * The longest interval reached while idle.
+     */
+    static const unsigned long MAX_INTERVAL_MS = 30000;
+
+    PollScheduler();
+
+    /**
+     * Starts scheduling at the time, when the device first reaches the
+     * server. The first poll is due right away, and savings are counted from
+     * then on.
+     */
+    void begin(unsigned long now) noexcept;
+
+    /**
+     * Returns true if a poll should be made at the time.
+     */
+    bool isDue(unsigned long now) const noexcept;
+
+    /**
+     * Returns the milliseconds from the time until the next poll, zero if a
+     * poll is due.
+     */
+    unsigned long getDelay(unsigned long now) const noexcept;
+
+    /**
+     * Returns the current interval between polls.
+     */
+    unsigned long getInterval() const noexcept;
+
+    /**
+     * Records that a poll request was made at the time.
+     */
+    void onPoll(unsigned long now) noexcept;
+
+    /**
+     * Records a pending count received at the time. The count is piggybacked
+     * if it came with the response to a request other than a poll. A count
+     * that differs from the last one counts as activity; an unchanged one
+     * lengthens the interval.
+     */
+    void onPendingCount(unsigned long now, int count, bool piggybacked) noexcept;
+
+    /**
+     * Records activity such as a message being sent or read, which shortens
+     * the interval.
+     */
+    void onActivity(unsigned long now) noexcept;
+
+    /**
+     * Returns the number of polls made.
+     */
+    unsigned long getPolls() const noexcept;
+
+    /**
+     * Returns the number of counts received with other requests.
+     */
+    unsigned long getPiggybacked() const noexcept;
+
+    /**
+     * Returns how many requests per hour were saved, from the start up to the
+     * time, compared to polling every BASE_INTERVAL_MS. The value is negative if more polls
+     * were made.
+     */
+    long getSavedPerHour(unsigned long now) const noexcept;
+
+private:
+    unsigned long start_;
+    unsigned long next_poll_;
+    unsigned long interval_;
+    int last_count_;
+    unsigned long polls_;
+    unsigned long piggybacked_;
+};
+
+
+#endif
@@ -0,0 +1,73 @@
+#include "power_scheduler.hpp"
+
+
+PowerScheduler::PowerScheduler()
+    : now_(0), sleep_(MAX_SLEEP_MS), state_(ACTIVE), entered_(0), time_(),
+      blocks_(0)
+{
+}
+
+
+void PowerScheduler::begin(unsigned long now) noexcept
+{
+    now_ = now;
+    sleep_ = MAX_SLEEP_MS;
+}
+
+
+void PowerScheduler::addDeadline(unsigned long deadline) noexcept
+{
+    if ((long)(deadline - now_) <= 0)
+    {
+        sleep_ = 0;
+    }
+    else
+    {
+        addDelay(deadline - now_);
+    }
+}
+
+
+void PowerScheduler::addDelay(unsigned long delay) noexcept
+{
+    if (delay < sleep_)
+    {
+        sleep_ = delay;
+    }
+}
+
+
+unsigned long PowerScheduler::getSleep() const noexcept
+{
+    return sleep_;
+}
+
+
+void PowerScheduler::enter(loop_state state, unsigned long now) noexcept
+{
+    time_[state_] += now - entered_;
+    entered_ = now;
+    if (state == BLOCKED && state_ != BLOCKED)
+    {
+        blocks_++;
+    }
+    state_ = state;
+}
+
+
+unsigned long PowerScheduler::getTime(loop_state state,
+                                      unsigned long now) const noexcept
+{
+    unsigned long time = time_[state];
+    if (state == state_)
+    {
+        time += now - entered_;
+    }
+    return time;
+}
+
+
+unsigned long PowerScheduler::getBlocks() const noexcept
+{
+    return blocks_;
+}
@@ -0,0 +1,86 @@
+#ifndef HELLOWORLD_POWER_SCHEDULER_HPP
+#define HELLOWORLD_POWER_SCHEDULER_HPP
+
+
+/**
+ * Decides how long the loop may sleep and accounts the time it spends active
+ * and blocked. Each iteration the loop starts a new round, adds the deadlines
+ * of everything it has to do on its own (polls, the cursor blink, the end of
+ * an alert), and then sleeps until the earliest one unless an interrupt wakes
+ * it first.
+ *
+ * Blocked time is not time in light sleep, only an upper bound on it: the CPU
+ * sleeps only while every task is blocked and no power management lock, such
+ * as the one the MorsePlayer holds while it plays or those of the WiFi
+ * driver, keeps it up.
+ *
+ * All times are millis() values. The class does not depend on the Arduino
+ * core, so the deadline logic can be run against any clock.
+ */
+class PowerScheduler
+{
+public:
+    enum loop_state {
+        ACTIVE,  // the loop is running
+        BLOCKED, // the loop is blocked waiting for a deadline or a wakeup
+        LOOP_STATE_COUNT
+    };
+
+    /**
+     * The longest sleep, so that input polled by the loop such as the serial
+     * port is still handled when no deadline is near.
+     */
+    static const unsigned long MAX_SLEEP_MS = 1000;
+
+    PowerScheduler();
+
+    /**
+     * Starts a round of deadlines at the time, forgetting those of the last
+     * round.
+     */
+    void begin(unsigned long now) noexcept;
+
+    /**
+     * Adds a deadline at the time. Deadlines already passed make the sleep
+     * zero.
+     */
+    void addDeadline(unsigned long deadline) noexcept;
+
+    /**
+     * Adds a deadline the milliseconds after the start of the round.
+     */
+    void addDelay(unsigned long delay) noexcept;
+
+    /**
+     * Returns the milliseconds from the start of the round to its earliest
+     * deadline, at most MAX_SLEEP_MS.
+     */
+    unsigned long getSleep() const noexcept;
+
+    /**
+     * Records that the state was entered at the time. The time since the last
+     * change is added to the state that was left.
+     */
+    void enter(loop_state state, unsigned long now) noexcept;
+
+    /**
+     * Returns the milliseconds spent in the state up to the time.
+     */
+    unsigned long getTime(loop_state state, unsigned long now) const noexcept;
+
+    /**
+     * Returns the number of times BLOCKED was entered.
+     */
+    unsigned long getBlocks() const noexcept;
+
+private:
+    unsigned long now_;
+    unsigned long sleep_;
+    loop_state state_;
+    unsigned long entered_;
+    unsigned long time_[LOOP_STATE_COUNT];
+    unsigned long blocks_;
+};
+
+
+#endif
@@ -0,0 +1,59 @@
+#include "preferences_storage.hpp"
+
+
+/**
+ * Writes the key of the slot, such as "m3", into the buffer.
+ */
+static void slotKey(size_t slot, char* key, size_t size)
+{
+    snprintf(key, size, "m%u", (unsigned)slot);
+}
+
+
+PreferencesOutboxStorage::PreferencesOutboxStorage(const char* name)
+    : name_(name), preferences_()
+{
+}
+
+
+bool PreferencesOutboxStorage::begin()
+{
+    return preferences_.begin(name_, false);
+}
+
+
+void PreferencesOutboxStorage::readCounters(uint32_t& head, uint32_t& tail)
+{
+    head = preferences_.getUInt("head", 0);
+    tail = preferences_.getUInt("tail", 0);
+}
+
+
+bool PreferencesOutboxStorage::writeHead(uint32_t head)
+{
+    return preferences_.putUInt("head", head) > 0;
+}
+
+
+bool PreferencesOutboxStorage::writeTail(uint32_t tail)
+{
+    return preferences_.putUInt("tail", tail) > 0;
+}
+
+
+bool PreferencesOutboxStorage::readSlot(size_t slot, char* message, size_t size)
+{
+    char key[8];
+    slotKey(slot, key, sizeof(key));
+    return preferences_.getString(key, message, size) > 0;
+}
+
+
+bool PreferencesOutboxStorage::writeSlot(size_t slot, const char* message)
+{
+    char key[8];
+    slotKey(slot, key, sizeof(key));
+
+    // Empty messages are stored as such; putString reports their length as 0
+    return preferences_.putString(key, message) == strlen(message);
+}
@@ -0,0 +1,37 @@
+#ifndef HELLOWORLD_PREFERENCES_STORAGE_HPP
+#define HELLOWORLD_PREFERENCES_STORAGE_HPP
+
+
+#include <Preferences.h>
+
+#include "outbox.hpp"
+
+
+/**
+ * Stores the outbox in the NVS partition of the flash through the Preferences
+ * library. Each slot is its own key, so queueing a message rewrites one slot
+ * and one counter, and NVS spreads those writes across its pages.
+ */
+class PreferencesOutboxStorage : public OutboxStorage
+{
+public:
+    /**
+     * Creates a storage in the NVS namespace. The name must stay the same
+     * across firmware updates for queued messages to survive them.
+     */
+    PreferencesOutboxStorage(const char* name = "outbox");
+
+    bool begin() override;
+    void readCounters(uint32_t& head, uint32_t& tail) override;
+    bool writeHead(uint32_t head) override;
+    bool writeTail(uint32_t tail) override;
+    bool readSlot(size_t slot, char* message, size_t size) override;
+    bool writeSlot(size_t slot, const char* message) override;
+
+private:
+    const char* name_;
+    Preferences preferences_;
+};
+
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef HELLOWORLD_RING_BUFFER_HPP
+#define HELLOWORLD_RING_BUFFER_HPP
+
+
+#include <atomic>
+#include <stddef.h>
+#include <utility>
+
+
+/**
+ * A bounded, lock-free queue for exactly one producer and one consumer. The
+ * producer may be an interrupt handler or another task; neither side ever
+ * blocks. The capacity must be a power of two.
+ */
+template <typename T, size_t N>
+class RingBuffer
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0,
+                  "RingBuffer capacity must be a power of two");
+
+public:
+    RingBuffer()
+        : head_(0), tail_(0)
+    {
+    }
+
+    /**
+     * Adds an item to the back of the queue. Returns false and drops the item
+     * if the queue is full. Only the producer may call this.
+     */
+    bool push(const T& item)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == N)
+        {
+            return false;
+        }
+        items_[tail & (N - 1)] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Moves an item to the back of the queue. Returns false and leaves the
+     * item untouched if the queue is full. Only the producer may call this.
+     */
+    bool push(T&& item)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == N)
+        {
+            return false;
+        }
+        items_[tail & (N - 1)] = std::move(item);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Removes the item at the front of the queue by moving it into the item.
+     * Returns false if the queue is empty. Only the consumer may call this.
+     */
+    bool pop(T& item)
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+        item = std::move(items_[head & (N - 1)]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Returns the number of items in the queue. The value may already be out
+     * of date when the other side is active.
+     */
+    size_t size() const
+    {
+        return tail_.load(std::memory_order_acquire) -
+               head_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    static constexpr size_t capacity()
+    {
+        return N;
+    }
+
+private:
+    T items_[N];
+    std::atomic<size_t> head_;
+    std::atomic<size_t> tail_;
+};
+
+
+#endif
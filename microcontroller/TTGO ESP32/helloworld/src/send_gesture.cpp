@@ -0,0 +1,46 @@
+#include "send_gesture.hpp"
+
+#include <string.h>
+
+
+SendGesture::SendGesture()
+    : completion_(), pressed_us_(0), held_(false)
+{
+}
+
+
+void SendGesture::press(uint32_t time_us, const char* completion) noexcept
+{
+    strncpy(completion_, completion, sizeof(completion_) - 1);
+    completion_[sizeof(completion_) - 1] = '\0';
+    pressed_us_ = time_us;
+    held_ = true;
+}
+
+
+SendGesture::gesture SendGesture::release(uint32_t time_us) noexcept
+{
+    if (!held_)
+    {
+        return SEND;
+    }
+    held_ = false;
+
+    if (completion_[0] != '\0' && time_us - pressed_us_ >= ACCEPT_HOLD_US)
+    {
+        return ACCEPT;
+    }
+    return SEND;
+}
+
+
+bool SendGesture::isHeld() const noexcept
+{
+    return held_;
+}
+
+
+const char* SendGesture::getCompletion() const noexcept
+{
+    return completion_;
+}
@@ -0,0 +1,66 @@
+#ifndef HELLOWORLD_SEND_GESTURE_HPP
+#define HELLOWORLD_SEND_GESTURE_HPP
+
+
+#include <stdint.h>
+
+#include "dictionary.hpp"
+
+
+/**
+ * Tells a press of the send button from a hold. A press sends the message;
+ * holding the button for ACCEPT_HOLD_US accepts the completion offered when it
+ * went down. The completion is saved on the press, so nothing that changes on
+ * the screen during the hold changes what is accepted.
+ *
+ * The keyer's breaks should be held back while the button is down, so the
+ * pause of the hold does not close the word being completed.
+ *
+ * All times are micros() values.
+ */
+class SendGesture
+{
+public:
+    /**
+     * How long the button is held to accept the completion.
+     */
+    static const uint32_t ACCEPT_HOLD_US = 500000;
+
+    enum gesture {
+        SEND,
+        ACCEPT
+    };
+
+    SendGesture();
+
+    /**
+     * Records that the button went down at the time while the completion was
+     * offered, which is empty if there was none.
+     */
+    void press(uint32_t time_us, const char* completion) noexcept;
+
+    /**
+     * Records that the button came up at the time. Returns ACCEPT if it was
+     * held long enough while a completion was offered, otherwise SEND, also if
+     * it was not down.
+     */
+    gesture release(uint32_t time_us) noexcept;
+
+    /**
+     * Returns true while the button is down.
+     */
+    bool isHeld() const noexcept;
+
+    /**
+     * Returns the completion saved by the last press.
+     */
+    const char* getCompletion() const noexcept;
+
+private:
+    char completion_[Dictionary::MAX_DEPTH + 1];
+    uint32_t pressed_us_;
+    bool held_;
+};
+
+
+#endif
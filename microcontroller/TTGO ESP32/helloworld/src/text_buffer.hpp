@@ -0,0 +1,97 @@
+#ifndef HELLOWORLD_TEXT_BUFFER_HPP
+#define HELLOWORLD_TEXT_BUFFER_HPP
+
+
+#include <stddef.h>
+#include <string.h>
+
+
+/**
+ * A null-terminated string of at most N characters stored in place. Text that
+ * does not fit is refused rather than truncated, so an edit either happens in
+ * full or not at all.
+ */
+template <size_t N>
+class TextBuffer
+{
+public:
+    TextBuffer()
+        : length_(0)
+    {
+        text_[0] = '\0';
+    }
+
+    /**
+     * Appends the text. Returns false and leaves the buffer unchanged if it
+     * does not fit.
+     */
+    bool append(const char* text)
+    {
+        size_t length = strlen(text);
+        if (length > N - length_)
+        {
+            return false;
+        }
+        memcpy(text_ + length_, text, length + 1);
+        length_ += length;
+        return true;
+    }
+
+    /**
+     * Appends a character. Returns false if the buffer is full.
+     */
+    bool append(char c)
+    {
+        if (length_ == N)
+        {
+            return false;
+        }
+        text_[length_++] = c;
+        text_[length_] = '\0';
+        return true;
+    }
+
+    /**
+     * Removes the last character, if any.
+     */
+    void removeLast()
+    {
+        if (length_ > 0)
+        {
+            text_[--length_] = '\0';
+        }
+    }
+
+    void clear()
+    {
+        length_ = 0;
+        text_[0] = '\0';
+    }
+
+    const char* c_str() const
+    {
+        return text_;
+    }
+
+    size_t length() const
+    {
+        return length_;
+    }
+
+    bool empty() const
+    {
+        return length_ == 0;
+    }
+
+    constexpr size_t capacity() const
+    {
+        return N;
+    }
+
+private:
+    char text_[N + 1];
+    size_t length_;
+};
+
+
+#endif
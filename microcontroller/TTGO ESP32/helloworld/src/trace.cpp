@@ -0,0 +1,112 @@
+#include "trace.hpp"
+
+#include <atomic>
+#include <stdarg.h>
+
+
+/**
+ * The longest line written by traceLog(), including the prefix.
+ */
+static const size_t TRACE_LINE_SIZE = 128;
+
+
+void traceLog(char level, const char* tag, const char* format, ...)
+{
+    char line[TRACE_LINE_SIZE];
+    int length = snprintf(line, sizeof(line), "[%c %s] ", level, tag);
+    if (length < 0 || (size_t)length >= sizeof(line))
+    {
+        return;
+    }
+
+    va_list args;
+    va_start(args, format);
+    int message_length = vsnprintf(line + length, sizeof(line) - length,
+                                   format, args);
+    va_end(args);
+    if (message_length < 0)
+    {
+        return;
+    }
+
+    length += message_length;
+    if ((size_t)length >= sizeof(line))
+    {
+        length = sizeof(line) - 1;
+    }
+    Serial.write((const uint8_t*)line, length);
+    Serial.write('\n');
+}
+
+
+#if TRACE_LATENCY
+
+struct latency_histogram {
+    std::atomic<uint32_t> buckets[TRACE_BUCKETS];
+    std::atomic<uint32_t> count;
+    std::atomic<uint32_t> max_us;
+};
+
+static latency_histogram histograms[TRACE_HISTOGRAM_COUNT];
+
+static const char* const HISTOGRAM_NAMES[TRACE_HISTOGRAM_COUNT] = {
+    "loop",
+    "register",
+    "unregister",
+    "send",
+    "count",
+    "fetch",
+    "press_to_display",
+    "completion",
+    "connect",
+    "reused_exchange",
+};
+
+
+void traceLatency(trace_histogram histogram, uint32_t latency_us)
+{
+    // Bucket i holds latencies below 2^(i + 1) microseconds
+    size_t bucket = latency_us < 2 ? 0 : 31 - __builtin_clz(latency_us);
+    if (bucket >= TRACE_BUCKETS)
+    {
+        bucket = TRACE_BUCKETS - 1;
+    }
+
+    latency_histogram& h = histograms[histogram];
+    h.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    h.count.fetch_add(1, std::memory_order_relaxed);
+    if (latency_us > h.max_us.load(std::memory_order_relaxed))
+    {
+        h.max_us.store(latency_us, std::memory_order_relaxed);
+    }
+}
+
+
+void traceDump(Print& out)
+{
+    out.print("histogram,count,max_us");
+    for (size_t i = 0; i + 1 < TRACE_BUCKETS; i++)
+    {
+        out.print(",<");
+        out.print((uint32_t)1 << (i + 1));
+    }
+    out.println(",more");
+
+    for (size_t i = 0; i < TRACE_HISTOGRAM_COUNT; i++)
+    {
+        const latency_histogram& h = histograms[i];
+        out.print(HISTOGRAM_NAMES[i]);
+        out.print(',');
+        out.print(h.count.load(std::memory_order_relaxed));
+        out.print(',');
+        out.print(h.max_us.load(std::memory_order_relaxed));
+        for (size_t j = 0; j < TRACE_BUCKETS; j++)
+        {
+            out.print(',');
+            out.print(h.buckets[j].load(std::memory_order_relaxed));
+        }
+        out.println();
+    }
+}
+
+#endif
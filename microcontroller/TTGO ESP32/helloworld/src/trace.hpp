@@ -0,0 +1,138 @@
+#ifndef HELLOWORLD_TRACE_HPP
+#define HELLOWORLD_TRACE_HPP
+
+
+#include <Arduino.h>
+#include <stdint.h>
+
+
+/**
+ * Log levels. Messages above TRACE_LEVEL are compiled out along with their
+ * arguments, so they cost nothing at run time. The default, INFO, keeps the
+ * periodic metrics; DEBUG adds a line for every request.
+ */
+#define TRACE_LEVEL_NONE  0
+#define TRACE_LEVEL_ERROR 1
+#define TRACE_LEVEL_WARN  2
+#define TRACE_LEVEL_INFO  3
+#define TRACE_LEVEL_DEBUG 4
+
+#ifndef TRACE_LEVEL
+#define TRACE_LEVEL TRACE_LEVEL_INFO
+#endif
+
+/**
+ * Latency histograms are recorded unless TRACE_LATENCY is defined as 0.
+ */
+#ifndef TRACE_LATENCY
+#define TRACE_LATENCY 1
+#endif
+
+
+/**
+ * Writes a printf-style message tagged with its level and the subsystem it
+ * came from. The message is formatted on the stack and truncated to a line.
+ * Use the TRACE_* macros rather than calling this directly.
+ */
+void traceLog(char level, const char* tag, const char* format, ...)
+    __attribute__((format(printf, 3, 4)));
+
+#if TRACE_LEVEL >= TRACE_LEVEL_ERROR
+#define TRACE_ERROR(tag, ...) traceLog('E', tag, __VA_ARGS__)
+#else
+#define TRACE_ERROR(tag, ...) do {} while (0)
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_WARN
+#define TRACE_WARN(tag, ...) traceLog('W', tag, __VA_ARGS__)
+#else
+#define TRACE_WARN(tag, ...) do {} while (0)
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_INFO
+#define TRACE_INFO(tag, ...) traceLog('I', tag, __VA_ARGS__)
+#else
+#define TRACE_INFO(tag, ...) do {} while (0)
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_DEBUG
+#define TRACE_DEBUG(tag, ...) traceLog('D', tag, __VA_ARGS__)
+#else
+#define TRACE_DEBUG(tag, ...) do {} while (0)
+#endif
+
+
+/**
+ * The latencies that are recorded.
+ */
+enum trace_histogram {
+    TRACE_LOOP,             // one iteration of loop(), without its delay
+    TRACE_REGISTER,         // round trip to /api/device/register
+    TRACE_UNREGISTER,       // round trip to /api/device/unregister
+    TRACE_SEND,             // round trip to /api/device/message/receive
+    TRACE_COUNT,            // round trip to /api/device/message/pending/count
+    TRACE_FETCH,            // round trip to /api/device/message/pending/get
+    TRACE_PRESS_TO_DISPLAY, // button edge until the screen shows the change
+    TRACE_COMPLETION,       // following a changed word and completing it
+    TRACE_CONNECT,          // opening a connection, with its TLS handshake
+    TRACE_REUSED,           // request and response head on an open connection
+    TRACE_HISTOGRAM_COUNT
+};
+
+/**
+ * Each histogram has a bucket for every power of two of microseconds, the
+ * last one also holding anything longer.
+ */
+static const size_t TRACE_BUCKETS = 24;
+
+#if TRACE_LATENCY
+
+/**
+ * Records a latency in microseconds. Each histogram must be recorded from a
+ * single task, but may be dumped from any.
+ */
+void traceLatency(trace_histogram histogram, uint32_t latency_us);
+
+/**
+ * Writes all histograms as CSV: a header line with the upper bound of each
+ * bucket, then a line per histogram with its name, count, longest latency
+ * and bucket counts.
+ */
+void traceDump(Print& out);
+
+/**
+ * Records the time from its construction to its destruction.
+ */
+class TraceTimer
+{
+public:
+    TraceTimer(trace_histogram histogram)
+        : histogram_(histogram), start_us_(micros())
+    {
+    }
+
+    ~TraceTimer()
+    {
+        traceLatency(histogram_, micros() - start_us_);
+    }
+
+private:
+    trace_histogram histogram_;
+    uint32_t start_us_;
+};
+
+#else
+
+inline void traceLatency(trace_histogram, uint32_t) {}
+inline void traceDump(Print&) {}
+
+class TraceTimer
+{
+public:
+    TraceTimer(trace_histogram) {}
+};
+
+#endif
+
+
+#endif
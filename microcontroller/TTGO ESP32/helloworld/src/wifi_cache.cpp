@@ -0,0 +1,84 @@
+#include "wifi_cache.hpp"
+
+
+/**
+ * Stored alongside the connection, and changed whenever the layout of
+ * wifi_config changes so that old entries are ignored.
+ */
+static const uint8_t CONFIG_VERSION = 1;
+
+
+WifiCache::WifiCache(const char* name)
+    : name_(name), preferences_()
+{
+}
+
+
+bool WifiCache::begin()
+{
+    return preferences_.begin(name_, false);
+}
+
+
+bool WifiCache::load(wifi_config& config)
+{
+    if (preferences_.getUChar("version", 0) != CONFIG_VERSION ||
+        preferences_.getBytesLength("config") != sizeof(config))
+    {
+        return false;
+    }
+    return preferences_.getBytes("config", &config, sizeof(config)) ==
+           sizeof(config);
+}
+
+
+bool WifiCache::save(const wifi_config& config)
+{
+    // An unchanged connection is not written again, which spares the flash
+    // on every boot
+    wifi_config stored;
+    if (load(stored) && memcmp(&stored, &config, sizeof(config)) == 0)
+    {
+        return true;
+    }
+
+    if (preferences_.putBytes("config", &config, sizeof(config)) != sizeof(config))
+    {
+        return false;
+    }
+    return preferences_.putUChar("version", CONFIG_VERSION) > 0;
+}
+
+
+void WifiCache::clear()
+{
+    preferences_.remove("config");
+    preferences_.remove("version");
+}
+
+
+uint8_t WifiCache::getFailures()
+{
+    return preferences_.getUChar("failures", 0);
+}
+
+
+uint8_t WifiCache::recordFailure()
+{
+    uint8_t failures = getFailures();
+    if (failures < UINT8_MAX)
+    {
+        failures++;
+    }
+    preferences_.putUChar("failures", failures);
+    return failures;
+}
+
+
+void WifiCache::clearFailures()
+{
+    if (getFailures() != 0)
+    {
+        preferences_.putUChar("failures", 0);
+    }
+}
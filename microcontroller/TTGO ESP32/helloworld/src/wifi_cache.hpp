@@ -0,0 +1,82 @@
+#ifndef HELLOWORLD_WIFI_CACHE_HPP
+#define HELLOWORLD_WIFI_CACHE_HPP
+
+
+#include <Preferences.h>
+
+
+/**
+ * Keeps the details of the last successful WiFi connection in the NVS
+ * partition of the flash, so the next boot can connect straight to the same
+ * access point on the same channel without scanning or opening the captive
+ * portal. A failure count survives restarts and decides when the portal is
+ * needed after all.
+ */
+class WifiCache
+{
+public:
+    /**
+     * The details of a connection. The addresses are only set if the lease of
+     * the connection was stored to be reused as a static configuration.
+     */
+    struct wifi_config {
+        char ssid[33];
+        char password[65];
+        uint8_t bssid[6];
+        int32_t channel;
+        bool static_ip;
+        uint32_t ip;
+        uint32_t gateway;
+        uint32_t subnet;
+        uint32_t dns;
+    };
+
+    /**
+     * Creates a cache in the NVS namespace.
+     */
+    WifiCache(const char* name = "wifi");
+
+    /**
+     * Opens the storage. Returns false if it could not be opened.
+     */
+    bool begin();
+
+    /**
+     * Reads the stored connection into the config. Returns false if none is
+     * stored or it was written by an incompatible firmware.
+     */
+    bool load(wifi_config& config);
+
+    /**
+     * Stores the connection. Returns false if it could not be written.
+     */
+    bool save(const wifi_config& config);
+
+    /**
+     * Forgets the stored connection.
+     */
+    void clear();
+
+    /**
+     * Returns the number of boots in a row that failed to connect with the
+     * stored connection.
+     */
+    uint8_t getFailures();
+
+    /**
+     * Counts a failed boot and returns the new count.
+     */
+    uint8_t recordFailure();
+
+    /**
+     * Resets the failure count after a successful connection.
+     */
+    void clearFailures();
+
+private:
+    const char* name_;
+    Preferences preferences_;
+};
+
+
+#endif
@@ -0,0 +1,116 @@
+#include "wire.hpp"
+
+#include <string.h>
+
+
+/**
+ * Returns the 6-bit code of the character, or WIRE_ESCAPE if it has none.
+ */
+static uint8_t getCode(char c)
+{
+    const char* found = c != '\0' ? strchr(WIRE_CHARSET, c) : NULL;
+    return found != NULL ? (uint8_t)(found - WIRE_CHARSET) : WIRE_ESCAPE;
+}
+
+
+size_t wireTextSize(const char* text)
+{
+    size_t characters = 0;
+    size_t bits = 0;
+    for (const char* c = text; *c != '\0'; c++)
+    {
+        characters++;
+        bits += getCode(*c) == WIRE_ESCAPE ? 6 + 8 : 6;
+    }
+    if (characters > WIRE_MAX_CHARACTERS)
+    {
+        return 0;
+    }
+    return 1 + (bits + 7) / 8;
+}
+
+
+size_t wirePackText(const char* text, uint8_t* buffer, size_t size)
+{
+    size_t packed_size = wireTextSize(text);
+    if (packed_size == 0 || packed_size > size)
+    {
+        return 0;
+    }
+
+    memset(buffer, 0, packed_size);
+    buffer[0] = (uint8_t)strlen(text);
+
+    // Bits are appended most significant first after the count
+    size_t bit = 8;
+    auto put = [&](uint32_t value, size_t width) {
+        for (size_t i = width; i-- > 0; bit++)
+        {
+            if (value & (1u << i))
+            {
+                buffer[bit / 8] |= 0x80 >> (bit % 8);
+            }
+        }
+    };
+
+    for (const char* c = text; *c != '\0'; c++)
+    {
+        uint8_t code = getCode(*c);
+        put(code, 6);
+        if (code == WIRE_ESCAPE)
+        {
+            put((uint8_t)*c, 8);
+        }
+    }
+    return packed_size;
+}
+
+
+size_t wireUnpackText(const uint8_t* data, size_t length,
+                      char* text, size_t size)
+{
+    if (length == 0 || size == 0)
+    {
+        return 0;
+    }
+
+    size_t characters = data[0];
+    size_t bit = 8;
+    bool truncated = false;
+    auto get = [&](size_t width, uint32_t& value) {
+        if (bit + width > length * 8)
+        {
+            truncated = true;
+            return;
+        }
+        value = 0;
+        for (size_t i = 0; i < width; i++, bit++)
+        {
+            value = (value << 1) | ((data[bit / 8] >> (7 - bit % 8)) & 1);
+        }
+    };
+
+    size_t written = 0;
+    for (size_t i = 0; i < characters && !truncated; i++)
+    {
+        uint32_t code = 0;
+        get(6, code);
+        char c;
+        if (code == WIRE_ESCAPE)
+        {
+            uint32_t byte = 0;
+            get(8, byte);
+            c = (char)byte;
+        }
+        else
+        {
+            c = code < sizeof(WIRE_CHARSET) - 1 ? WIRE_CHARSET[code] : '?';
+        }
+        if (!truncated && written + 1 < size)
+        {
+            text[written++] = c;
+        }
+    }
+    text[written] = '\0';
+    return truncated ? 0 : (bit + 7) / 8;
+}
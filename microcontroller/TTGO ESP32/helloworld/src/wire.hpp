@@ -0,0 +1,114 @@
+#ifndef HELLOWORLD_WIRE_HPP
+#define HELLOWORLD_WIRE_HPP
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/**
+ * Encoding of the compact binary protocol, an alternative to form data and
+ * JSON for talking to the server. Devices are identified by their 6-byte MAC
+ * address, integers are big-endian and text is packed at 6 bits a character.
+ *
+ * Requests are posted to /api/binary/<endpoint> with the device id first:
+ *
+ *     register, unregister, message/pending/count:   id
+ *     message/receive:                               id, text
+ *     message/receive/batch:                         id, u8 count, count
+ *                                                    pairs of u32 age, text
+ *     message/pending/get:                           id, u8 limit
+ *
+ * Responses carry no body on error. Otherwise, with a pending count of 0xFFFF
+ * when the server does not know the device:
+ *
+ *     register, message/receive,
+ *     message/receive/batch:       u16 pending
+ *     message/pending/count:       u16 count
+ *     message/pending/get:         u16 pending, u8 count, count messages
+ *
+ * Each message is framed by its length so a reader can skip what it cannot
+ * hold: u16 length of the rest, sender id, u32 time, text. The time counts the
+ * seconds of the server's local time since 1970. The age of a batched message
+ * counts the milliseconds between its composition and the request, since the
+ * device has no clock of its own.
+ *
+ * Text is a u8 count of characters followed by the characters packed
+ * most significant bit first and padded to a whole byte. Each character is
+ * the 6-bit index of its position in WIRE_CHARSET, which holds everything the
+ * Morse table decodes to; other bytes are sent as WIRE_ESCAPE and the byte
+ * itself in 8 bits.
+ */
+
+/**
+ * The size of a device id.
+ */
+static const size_t WIRE_ID_SIZE = 6;
+
+/**
+ * The pending count sent when the server does not know the device.
+ */
+static const uint16_t WIRE_UNKNOWN_PENDING = 0xFFFF;
+
+/**
+ * The characters that are sent in 6 bits, in order of their codes.
+ */
+static const char WIRE_CHARSET[] =
+    " ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789.,?'!/()&:;=+-_\"$@<>#%*";
+
+/**
+ * The code that precedes a byte sent as it is.
+ */
+static const uint8_t WIRE_ESCAPE = 63;
+
+/**
+ * The most characters text can have.
+ */
+static const size_t WIRE_MAX_CHARACTERS = 255;
+
+
+/**
+ * Returns the number of bytes the text takes once packed, or 0 if it has more
+ * than WIRE_MAX_CHARACTERS characters.
+ */
+size_t wireTextSize(const char* text);
+
+/**
+ * Packs the text into the buffer. Returns the number of bytes written, or 0 if
+ * the text does not fit.
+ */
+size_t wirePackText(const char* text, uint8_t* buffer, size_t size);
+
+/**
+ * Unpacks text from the data into a null-terminated string, dropping the
+ * characters that do not fit. Returns the number of bytes of data used, or 0
+ * if the data ends before the text does.
+ */
+size_t wireUnpackText(const uint8_t* data, size_t length,
+                      char* text, size_t size);
+
+
+inline void wirePut16(uint8_t* data, uint16_t value)
+{
+    data[0] = value >> 8;
+    data[1] = value & 0xFF;
+}
+
+inline void wirePut32(uint8_t* data, uint32_t value)
+{
+    wirePut16(data, value >> 16);
+    wirePut16(data + 2, value & 0xFFFF);
+}
+
+inline uint16_t wireGet16(const uint8_t* data)
+{
+    return ((uint16_t)data[0] << 8) | data[1];
+}
+
+inline uint32_t wireGet32(const uint8_t* data)
+{
+    return ((uint32_t)wireGet16(data) << 16) | wireGet16(data + 2);
+}
+
+
+#endif
@@ -0,0 +1,134 @@
+#include <math.h>
+#include <stdio.h>
+#include <unity.h>
+
+#include <bench.hpp>
+
+#include "editor.hpp"
+#include "goertzel.hpp"
+#include "keyer.hpp"
+#include "morse.hpp"
+
+
+/**
+ * The letters of PARIS, the standard word for timing Morse.
+ */
+static const char* const PARIS[] = {".--.", ".-", ".-.", "..", "..."};
+static const size_t PARIS_LETTERS = sizeof(PARIS) / sizeof(PARIS[0]);
+
+/**
+ * Keeps the compiler from dropping results that are not otherwise used.
+ */
+static volatile uintptr_t sink;
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void bench_morse_decode()
+{
+    morse_code_t codes[PARIS_LETTERS];
+    for (size_t i = 0; i < PARIS_LETTERS; i++)
+    {
+        codes[i] = morseFromString(PARIS[i]);
+    }
+
+    size_t next = 0;
+    bench_result result = benchRun("morseDecode", [&]() {
+        sink = (uintptr_t)morseDecode(codes[next]);
+        next = next + 1 < PARIS_LETTERS ? next + 1 : 0;
+    });
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+}
+
+
+void bench_morse_encode()
+{
+    const char* text = "PARIS 1234567890";
+    size_t next = 0;
+    bench_result result = benchRun("morseEncode", [&]() {
+        sink = morseEncode(text[next]);
+        next = text[next + 1] != '\0' ? next + 1 : 0;
+    });
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+}
+
+
+void bench_editor_letter()
+{
+    // One letter keyed element by element and closed into the message
+    MessageEditor editor;
+    size_t next = 0;
+    bench_result result = benchRun("MessageEditor letter", [&]() {
+        for (const char* element = PARIS[next]; *element != '\0'; element++)
+        {
+            editor.addElement(*element == '-');
+        }
+        if (editor.closeLetter() == MessageEditor::MESSAGE_FULL)
+        {
+            editor.clearMessage();
+        }
+        next = next + 1 < PARIS_LETTERS ? next + 1 : 0;
+    });
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+}
+
+
+void bench_keyer_element()
+{
+    // One dot at 20 words per minute: press, release and the polls of the
+    // silence after it
+    MorseKeyer keyer;
+    uint32_t now = 0;
+    bench_result result = benchRun("MorseKeyer element", [&]() {
+        bool dash;
+        keyer.press(now);
+        now += 60000;
+        keyer.release(now, dash);
+        now += 60000;
+        sink = keyer.poll(now);
+    });
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+}
+
+
+void bench_tone_detector_block()
+{
+    // One 10 ms block of AudioInput: a 700 Hz tone at 8 kHz around the middle
+    // of the ADC range
+    const uint32_t sample_rate = 8000;
+    const size_t block_size = 80;
+    int16_t samples[block_size];
+    for (size_t i = 0; i < block_size; i++)
+    {
+        samples[i] = (int16_t)lround(2048 + 500 * sin(2 * M_PI * 700 * i / sample_rate));
+    }
+
+    ToneDetector detector(sample_rate, 700, block_size);
+    bench_result result = benchRun("ToneDetector block", [&]() {
+        sink = detector.process(samples);
+    });
+    printf("ToneDetector: %.0f samples/s, %.0fx real time\n",
+           block_size * 1e9 / result.ns_per_op,
+           block_size * 1e9 / result.ns_per_op / sample_rate);
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(bench_morse_decode);
+    RUN_TEST(bench_morse_encode);
+    RUN_TEST(bench_editor_letter);
+    RUN_TEST(bench_keyer_element);
+    RUN_TEST(bench_tone_detector_block);
+    return UNITY_END();
+}
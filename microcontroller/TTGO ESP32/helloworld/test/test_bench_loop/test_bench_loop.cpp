@@ -0,0 +1,163 @@
+#include <unity.h>
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+#include <bench.hpp>
+#include <host.hpp>
+
+#include "buttons.hpp"
+#include "dictionary.hpp"
+#include "dictionary_data.hpp"
+#include "display.hpp"
+#include "editor.hpp"
+#include "keyer.hpp"
+
+
+static const uint8_t WRITE_PIN = 27;
+
+/**
+ * A loop iteration every 10 ms of keying at 20 words per minute, whose unit
+ * is 60 ms.
+ */
+static const uint32_t STEP_US = 10000;
+static const uint32_t UNIT_STEPS = 6;
+
+/**
+ * The text keyed over and over, as key-down and key-up lengths in units.
+ */
+struct key_step {
+    bool down;
+    uint32_t units;
+};
+
+
+/**
+ * Appends the key steps of the text to the steps, returning their number.
+ */
+static size_t keyText(const char* text, key_step* steps, size_t capacity)
+{
+    size_t count = 0;
+    for (; *text != '\0' && count + 2 < capacity; text++)
+    {
+        if (*text == ' ')
+        {
+            steps[count - 1].units = 7;
+            continue;
+        }
+        char elements[MORSE_MAX_ELEMENTS + 1];
+        morseToString(morseEncode(*text), elements, sizeof(elements));
+        for (const char* element = elements; *element != '\0'; element++)
+        {
+            steps[count++] = {true, *element == '-' ? 3u : 1u};
+            steps[count++] = {false, 1};
+        }
+        steps[count - 1].units = 3;
+    }
+    return count;
+}
+
+
+void setUp()
+{
+    hostUseSimulatedClock(1000000);
+    pinMode(WRITE_PIN, INPUT_PULLUP);
+}
+
+
+void tearDown()
+{
+    detachInterrupt(WRITE_PIN);
+    hostUseRealClock();
+}
+
+
+void bench_loop_iteration()
+{
+    // The input, decoding and screen work of loop() in the firmware: button
+    // edges into the keyer and editor, the completion of the last word and
+    // the screen. The network and power parts of loop() run on the board's
+    // own drivers and are not part of it.
+    TFT_eSPI tft;
+    tft.setRotation(3);
+    ScreenRenderer screen(tft);
+    TEST_ASSERT_TRUE(screen.begin());
+    ButtonInput buttons;
+    buttons.attach(WRITE_PIN);
+    MorseKeyer keyer;
+    MessageEditor editor;
+    Dictionary dictionary(DICTIONARY_IMAGE, DICTIONARY_IMAGE_SIZE);
+    char completion[Dictionary::MAX_DEPTH + 1] = "";
+
+    key_step steps[256];
+    size_t step_count = keyText("THE QUICK BROWN FOX ", steps, 256);
+    size_t step = 0;
+    uint32_t step_left = 0;
+
+    unsigned long pixels = tft.getPixelsWritten();
+    unsigned long iterations = 0;
+    bench_result result = benchRun("loop() iteration", [&]() {
+        // The key changes as the text is keyed
+        if (step_left == 0)
+        {
+            hostSetPin(WRITE_PIN, steps[step].down ? LOW : HIGH);
+            step_left = steps[step].units * UNIT_STEPS;
+            step = step + 1 < step_count ? step + 1 : 0;
+        }
+        step_left--;
+        hostAdvanceClock(STEP_US);
+
+        ButtonInput::button_event event;
+        while (buttons.poll(event))
+        {
+            bool dash;
+            if (event.pressed)
+            {
+                keyer.press(event.time_us);
+            }
+            else if (keyer.release(event.time_us, dash))
+            {
+                editor.addElement(dash);
+            }
+        }
+        switch (keyer.poll(micros()))
+        {
+        case MorseKeyer::LETTER_BREAK:
+            if (editor.closeLetter() == MessageEditor::MESSAGE_FULL)
+            {
+                editor.clearMessage();
+            }
+            break;
+        case MorseKeyer::WORD_BREAK:
+            editor.addWordSpace();
+            break;
+        case MorseKeyer::NO_BREAK:
+            break;
+        }
+
+        unsigned long now = millis();
+        bool blink_on = (now / 500) % 2 == 0;
+        screen.setField(0, 10, 10, 2, editor.getLetter(), blink_on);
+        screen.setField(1, 10, 80, 2, editor.getMessage());
+        const char* word = editor.getLastWord();
+        if (dictionary.setPrefix(word, strlen(word)))
+        {
+            dictionary.getCompletion(completion, sizeof(completion));
+        }
+        screen.setField(2, 10, 115, 1, completion);
+        screen.render(now);
+        iterations++;
+    });
+
+    printf("loop() iteration: %.1f bytes pushed over SPI/op\n",
+           2.0 * (tft.getPixelsWritten() - pixels) / iterations);
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+    TEST_ASSERT_GREATER_THAN(0, strlen(editor.getMessage()));
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(bench_loop_iteration);
+    return UNITY_END();
+}
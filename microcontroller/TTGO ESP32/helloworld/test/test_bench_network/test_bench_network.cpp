@@ -0,0 +1,237 @@
+#include <unity.h>
+
+#include <WiFi.h>
+#include <bench.hpp>
+#include <host.hpp>
+#include <loopback_server.hpp>
+
+#include "network.hpp"
+
+
+/**
+ * Counts what is written to it and drops it.
+ */
+class NullPrint : public Print
+{
+public:
+    size_t write(uint8_t c) override
+    {
+        (void)c;
+        bytes++;
+        return 1;
+    }
+
+    size_t write(const uint8_t* data, size_t length) override
+    {
+        (void)data;
+        bytes += length;
+        return length;
+    }
+
+    size_t bytes = 0;
+};
+
+
+/**
+ * A response to /api/device/message/pending/get with the messages, as the
+ * server sends it.
+ */
+static std::string fetchResponse(int count = 4)
+{
+    std::string body = "{\"messages\": [";
+    for (int i = 0; i < count; i++)
+    {
+        if (i > 0)
+        {
+            body += ", ";
+        }
+        body += "{\"macAddress\": \"24:0A:C4:00:00:02\", "
+                "\"content\": \"CQ CQ DE TTGO K\", "
+                "\"time\": \"Sat, 14 May 2022 10:00:" + std::to_string(10 + i) +
+                " GMT\"}";
+    }
+    body += "], \"pending\": 0}";
+    return LoopbackServer::respond(200, "application/json", body);
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void bench_form_write()
+{
+    // A batch of two messages, with characters that must be percent-encoded
+    FormDataFormatter form;
+    form.addPair("macAddress", "24:0A:C4:00:00:01");
+    form.addPair("message", "MEET AT 5? BRING A&B");
+    form.addPair("age", "1200");
+    form.addPair("message", "CQ CQ DE TTGO K");
+    form.addPair("age", "300");
+
+    NullPrint out;
+    bench_result result = benchRun("FormDataFormatter::writeTo", [&]() {
+        form.writeTo(out);
+    });
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+    TEST_ASSERT_EQUAL(0, out.bytes % form.getContentLength());
+}
+
+
+void bench_form_content_length()
+{
+    FormDataFormatter form;
+    form.addPair("macAddress", "24:0A:C4:00:00:01");
+    form.addPair("message", "MEET AT 5? BRING A&B");
+
+    volatile size_t length;
+    bench_result result = benchRun("FormDataFormatter::getContentLength",
+                                   [&]() { length = form.getContentLength(); });
+    (void)length;
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+}
+
+
+void bench_fetch_json()
+{
+    // The whole exchange over loopback: writing the request, then parsing
+    // the response as it is read off the socket
+    std::string response = fetchResponse();
+    LoopbackServer server([&](const LoopbackServer::request&) {
+        return response;
+    });
+    TEST_ASSERT_TRUE(server.begin());
+
+    ApplicationNetworkClient client("127.0.0.1", server.getPort());
+    ApplicationNetworkClient::message_map messages[4];
+    int fetched = 0;
+    benchRun("fetchPendingMessages (4, JSON)", [&]() {
+        fetched = client.fetchPendingMessages(messages, 4);
+    });
+    TEST_ASSERT_EQUAL(4, fetched);
+    TEST_ASSERT_EQUAL_STRING("CQ CQ DE TTGO K", messages[3].content.c_str());
+    server.end();
+}
+
+
+/**
+ * Fetches the messages as fetchPendingMessages() did before it parsed the
+ * stream: the body read a byte at a time into a String, then parsed whole
+ * into a document, here sized so that every message fits.
+ */
+static int legacyFetch(uint16_t port,
+                       ApplicationNetworkClient::message_map* messages,
+                       int capacity)
+{
+    WiFiClient socket;
+    socket.connect("127.0.0.1", port);
+    socket.print("POST /api/device/message/pending/get HTTP/1.1\r\n"
+                 "Connection: close\r\nContent-Length: 0\r\n\r\n");
+
+    int line_length = 0;
+    while (true)
+    {
+        while (!socket.available() && socket.connected())
+        {
+        }
+        int c = socket.read();
+        if (c < 0 || (c == '\n' && line_length == 0))
+        {
+            break;
+        }
+        line_length = c == '\n' ? 0 : c == '\r' ? line_length : line_length + 1;
+    }
+    String response;
+    while (socket.available())
+    {
+        response += (char)socket.read();
+    }
+    socket.stop();
+
+    DynamicJsonDocument doc(2 * response.length());
+    deserializeJson(doc, response.c_str(), response.length());
+    JsonArray array = doc["messages"];
+    int count = 0;
+    for (; count < capacity; count++)
+    {
+        JsonObject message = array[count];
+        if (message.isNull())
+        {
+            break;
+        }
+        messages[count].macAddress = message["macAddress"].as<const char*>();
+        messages[count].content = message["content"].as<const char*>();
+        messages[count].time = message["time"].as<const char*>();
+    }
+    return count;
+}
+
+
+/**
+ * Returns the most heap the fetch held at once, keeping what it fetched.
+ */
+template <typename Fetch>
+static long heapPeak(Fetch fetch)
+{
+    ApplicationNetworkClient::message_map messages[4];
+    hostResetHeapPeak();
+    TEST_ASSERT_EQUAL(4, fetch(messages));
+    return hostGetHeapPeak();
+}
+
+
+/*
+ * The parse holds one message at a time besides those kept, so its peak does
+ * not grow with the response. Reading the whole body first makes it grow with
+ * every message the server sends.
+ */
+void bench_fetch_memory()
+{
+    int count = 4;
+    std::string response;
+    LoopbackServer server([&](const LoopbackServer::request&) {
+        return response;
+    });
+    TEST_ASSERT_TRUE(server.begin());
+    ApplicationNetworkClient client("127.0.0.1", server.getPort());
+
+    long streamed[2];
+    long whole[2];
+    const int counts[2] = {4, 32};
+    for (int i = 0; i < 2; i++)
+    {
+        count = counts[i];
+        response = fetchResponse(count);
+        streamed[i] = heapPeak([&](ApplicationNetworkClient::message_map* m) {
+            return client.fetchPendingMessages(m, 4);
+        });
+        // The server answers one connection at a time
+        client.disconnect();
+        whole[i] = heapPeak([&](ApplicationNetworkClient::message_map* m) {
+            return legacyFetch(server.getPort(), m, 4);
+        });
+        printf("fetch 4 of %d messages (%u B): %ld B heap peak streamed, "
+               "%ld B read whole\n", count, (unsigned)response.size(),
+               streamed[i], whole[i]);
+    }
+    TEST_ASSERT_EQUAL(streamed[0], streamed[1]);
+    TEST_ASSERT_TRUE(whole[1] > whole[0]);
+    server.end();
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(bench_form_write);
+    RUN_TEST(bench_form_content_length);
+    RUN_TEST(bench_fetch_json);
+    RUN_TEST(bench_fetch_memory);
+    return UNITY_END();
+}
@@ -0,0 +1,176 @@
+#include <unity.h>
+
+#include <WiFi.h>
+#include <bench.hpp>
+#include <loopback_server.hpp>
+
+#include "network.hpp"
+
+
+static const char* const MAC_ADDRESS = "24:0A:C4:00:00:01";
+static const char* const MESSAGE = "CQ CQ DE TTGO K";
+
+
+static LoopbackServer* server;
+
+
+/**
+ * The form body as the formatter built it before: the pairs appended to a
+ * String as they were added, then copied out whole.
+ */
+static String legacyForm(const char* message)
+{
+    String output;
+    output += "macAddress";
+    output += "=";
+    output += MAC_ADDRESS;
+    output += "&";
+    output += "message";
+    output += "=";
+    output += message;
+    return String(output);
+}
+
+
+/**
+ * A request and response as writeToServer() and getResponseFromServer() made
+ * them through HttpClient before: a new connection per request, each part of
+ * the head printed on its own, the body written a byte at a time, and the
+ * response read a byte at a time into a growing String.
+ */
+static String legacyExchange(WiFiClient& socket, const char* path,
+                             const char* message)
+{
+    String content = legacyForm(message);
+
+    socket.connect("127.0.0.1", server->getPort());
+    socket.print("POST");
+    socket.print(" ");
+    socket.print(path);
+    socket.println(" HTTP/1.1");
+    socket.print("Host");
+    socket.print(": ");
+    socket.print("127.0.0.1");
+    socket.print(":");
+    socket.print((unsigned)server->getPort());
+    socket.println();
+    socket.print("User-Agent");
+    socket.print(": ");
+    socket.println("Arduino/2.2.0");
+    socket.print("Connection");
+    socket.print(": ");
+    socket.println("close");
+    socket.print("Content-Type");
+    socket.print(": ");
+    socket.println("application/x-www-form-urlencoded");
+    socket.print("Content-Length");
+    socket.print(": ");
+    socket.println(content.length());
+    socket.println();
+    for (unsigned int i = 0; i < content.length(); i++)
+    {
+        socket.write((uint8_t)content.charAt(i));
+    }
+
+    // Status line and headers, up to the empty line
+    int line_length = 0;
+    while (true)
+    {
+        while (!socket.available() && socket.connected())
+        {
+        }
+        int c = socket.read();
+        if (c < 0)
+        {
+            break;
+        }
+        if (c == '\n')
+        {
+            if (line_length == 0)
+            {
+                break;
+            }
+            line_length = 0;
+        }
+        else if (c != '\r')
+        {
+            line_length++;
+        }
+    }
+
+    String response = String();
+    while (socket.available())
+    {
+        response += (char)socket.read();
+    }
+    socket.stop();
+    return response;
+}
+
+
+void setUp()
+{
+    // No body, so that only the request and the response head are measured
+    server = new LoopbackServer([](const LoopbackServer::request&) {
+        return LoopbackServer::respond(200, "application/json", "");
+    });
+    TEST_ASSERT_TRUE(server->begin());
+}
+
+
+void tearDown()
+{
+    server->end();
+    delete server;
+}
+
+
+void bench_send_before()
+{
+    WiFiClient socket;
+    String response;
+    benchRun("sendMessage before (HttpClient, String)", [&]() {
+        response = legacyExchange(socket, "/api/device/message/receive",
+                                  MESSAGE);
+    });
+    TEST_ASSERT_EQUAL(0, response.length());
+}
+
+
+/*
+ * The request is written with one send whether or not the connection is
+ * reused. The allocations left are those of the JSON library, if any.
+ */
+void bench_send_new_connection()
+{
+    ApplicationNetworkClient client("127.0.0.1", server->getPort());
+    client.setKeepAlive(false);
+    bool sent = false;
+    bench_result result = benchRun("sendMessage, new connection", [&]() {
+        sent = client.sendMessage(MESSAGE);
+    });
+    TEST_ASSERT_TRUE(sent);
+    TEST_ASSERT_EQUAL(1, result.sends_per_op);
+}
+
+
+void bench_send_reused_connection()
+{
+    ApplicationNetworkClient client("127.0.0.1", server->getPort());
+    bool sent = false;
+    bench_result result = benchRun("sendMessage, reused connection", [&]() {
+        sent = client.sendMessage(MESSAGE);
+    });
+    TEST_ASSERT_TRUE(sent);
+    TEST_ASSERT_EQUAL(1, result.sends_per_op);
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(bench_send_before);
+    RUN_TEST(bench_send_new_connection);
+    RUN_TEST(bench_send_reused_connection);
+    return UNITY_END();
+}
@@ -0,0 +1,204 @@
+#include <unity.h>
+
+#include <bench.hpp>
+#include <loopback_server.hpp>
+
+#include "network.hpp"
+#include "wire.hpp"
+
+
+static const char* const MAC_ADDRESS = "24:0A:C4:00:00:02";
+static const char* const MESSAGE = "CQ CQ DE TTGO K";
+static const char* const TIME = "Sat, 14 May 2022 10:00:00 GMT";
+static const uint32_t SECONDS = 1652522400;
+
+
+/**
+ * Counts what is written to it and drops it.
+ */
+class NullPrint : public Print
+{
+public:
+    size_t write(uint8_t c) override
+    {
+        (void)c;
+        return 1;
+    }
+
+    size_t write(const uint8_t* data, size_t length) override
+    {
+        (void)data;
+        return length;
+    }
+};
+
+
+/**
+ * A message as the server sends it in JSON.
+ */
+static std::string jsonMessage()
+{
+    return std::string("{\"macAddress\": \"") + MAC_ADDRESS + "\", "
+           "\"content\": \"" + MESSAGE + "\", \"time\": \"" + TIME + "\"}";
+}
+
+
+/**
+ * The same message framed by the binary protocol.
+ */
+static std::string binaryMessage()
+{
+    uint8_t frame[64] = {0x24, 0x0A, 0xC4, 0x00, 0x00, 0x02};
+    wirePut32(frame + WIRE_ID_SIZE, SECONDS);
+    size_t length = WIRE_ID_SIZE + 4 +
+        wirePackText(MESSAGE, frame + WIRE_ID_SIZE + 4,
+                     sizeof(frame) - WIRE_ID_SIZE - 4);
+    uint8_t head[2];
+    wirePut16(head, length);
+    return std::string((const char*)head, 2) +
+           std::string((const char*)frame, length);
+}
+
+
+/**
+ * A pending/get response with four messages in either protocol.
+ */
+static std::string fetchResponse(bool binary)
+{
+    std::string body = binary ? std::string("\0\0\4", 3) : "{\"messages\": [";
+    for (int i = 0; i < 4; i++)
+    {
+        if (binary)
+        {
+            body += binaryMessage();
+        }
+        else
+        {
+            body += (i > 0 ? ", " : "") + jsonMessage();
+        }
+    }
+    if (!binary)
+    {
+        body += "], \"pending\": 0}";
+    }
+    return LoopbackServer::respond(200, binary ?
+        "application/octet-stream" : "application/json", body);
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void bench_encode()
+{
+    FormDataFormatter form;
+    form.addPair("message", MESSAGE);
+    NullPrint out;
+    bench_result result = benchRun("encode message, form", [&]() {
+        form.writeTo(out);
+    });
+    printf("\t%u B\n", (unsigned)form.getContentLength());
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+
+    uint8_t packed[64];
+    size_t size = 0;
+    result = benchRun("encode message, binary", [&]() {
+        size = wirePackText(MESSAGE, packed, sizeof(packed));
+    });
+    printf("\t%u B\n", (unsigned)size);
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+    TEST_ASSERT_TRUE(size < form.getContentLength());
+}
+
+
+void bench_decode()
+{
+    std::string json = jsonMessage();
+    StaticJsonDocument<64> filter;
+    filter["macAddress"] = true;
+    filter["content"] = true;
+    filter["time"] = true;
+    char content[128];
+    benchRun("decode message, JSON", [&]() {
+        StaticJsonDocument<512> doc;
+        deserializeJson(doc, json.c_str(), json.size(),
+                        DeserializationOption::Filter(filter));
+        strncpy(content, doc["content"].as<const char*>(), sizeof(content));
+    });
+    printf("\t%u B\n", (unsigned)json.size());
+    TEST_ASSERT_EQUAL_STRING(MESSAGE, content);
+
+    std::string binary = binaryMessage();
+    const uint8_t* text = (const uint8_t*)binary.data() + 2 + WIRE_ID_SIZE + 4;
+    size_t text_size = binary.size() - 2 - WIRE_ID_SIZE - 4;
+    bench_result result = benchRun("decode message, binary", [&]() {
+        wireUnpackText(text, text_size, content, sizeof(content));
+    });
+    printf("\t%u B\n", (unsigned)binary.size());
+    TEST_ASSERT_EQUAL_STRING(MESSAGE, content);
+    TEST_ASSERT_EQUAL(0, result.allocs_per_op);
+}
+
+
+/*
+ * Whole exchanges over loopback, which is where the protocols differ in the
+ * bytes each side has to send.
+ */
+void bench_exchange()
+{
+    const ApplicationNetworkClient::wire_protocol protocols[] = {
+        ApplicationNetworkClient::FORM_PROTOCOL,
+        ApplicationNetworkClient::BINARY_PROTOCOL
+    };
+    for (ApplicationNetworkClient::wire_protocol protocol : protocols)
+    {
+        bool binary = protocol == ApplicationNetworkClient::BINARY_PROTOCOL;
+        std::string fetch_response = fetchResponse(binary);
+        std::string send_response = binary ?
+            LoopbackServer::respond(200, "application/octet-stream",
+                                    std::string("\0\3", 2)) :
+            LoopbackServer::respond(200, "application/json",
+                                    "{\"pending\": 3}");
+        LoopbackServer server([&](const LoopbackServer::request& request) {
+            return request.path.find("pending/get") != std::string::npos ?
+                fetch_response : send_response;
+        });
+        TEST_ASSERT_TRUE(server.begin());
+        ApplicationNetworkClient client("127.0.0.1", server.getPort());
+        client.setProtocol(protocol);
+
+        bool sent = false;
+        benchRun(binary ? "sendMessage, binary" : "sendMessage, form", [&]() {
+            sent = client.sendMessage(MESSAGE);
+        });
+        TEST_ASSERT_TRUE(sent);
+        TEST_ASSERT_EQUAL(3, client.getPendingCount());
+
+        ApplicationNetworkClient::message_map messages[4];
+        int fetched = 0;
+        benchRun(binary ? "fetchPendingMessages (4), binary" :
+                          "fetchPendingMessages (4), form", [&]() {
+            fetched = client.fetchPendingMessages(messages, 4);
+        });
+        TEST_ASSERT_EQUAL(4, fetched);
+        TEST_ASSERT_EQUAL_STRING(MESSAGE, messages[3].content.c_str());
+        server.end();
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(bench_encode);
+    RUN_TEST(bench_decode);
+    RUN_TEST(bench_exchange);
+    return UNITY_END();
+}
@@ -0,0 +1,307 @@
+#include <unity.h>
+
+#include <Arduino.h>
+#include <driver/gpio.h>
+#include <host.hpp>
+
+#include "buttons.hpp"
+
+
+static const uint8_t SEND_PIN = 25;
+static const uint8_t WRITE_PIN = 27;
+
+
+/**
+ * Moves the clock past the debounce time of the last edge.
+ */
+static void settle()
+{
+    hostAdvanceClock(ButtonInput::DEBOUNCE_US);
+}
+
+
+void setUp()
+{
+    hostUseSimulatedClock(1000000);
+    pinMode(SEND_PIN, INPUT_PULLUP);
+    pinMode(WRITE_PIN, INPUT_PULLUP);
+    ulTaskNotifyTake(pdTRUE, 0);
+}
+
+
+void tearDown()
+{
+    detachInterrupt(SEND_PIN);
+    detachInterrupt(WRITE_PIN);
+    hostUseRealClock();
+}
+
+
+void test_queues_timestamped_edges()
+{
+    ButtonInput buttons;
+    TEST_ASSERT_TRUE(buttons.attach(WRITE_PIN));
+    settle();
+
+    hostSetPin(WRITE_PIN, LOW);
+    uint32_t pressed_at = micros();
+    hostAdvanceClock(125000);
+    hostSetPin(WRITE_PIN, HIGH);
+
+    ButtonInput::button_event event;
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_EQUAL_UINT8(WRITE_PIN, event.pin);
+    TEST_ASSERT_TRUE(event.pressed);
+    TEST_ASSERT_EQUAL_UINT32(pressed_at, event.time_us);
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_FALSE(event.pressed);
+    TEST_ASSERT_EQUAL_UINT32(pressed_at + 125000, event.time_us);
+    TEST_ASSERT_FALSE(buttons.poll(event));
+}
+
+
+void test_ignores_bounce()
+{
+    ButtonInput buttons;
+    buttons.attach(WRITE_PIN);
+    settle();
+
+    hostSetPin(WRITE_PIN, LOW);
+    hostAdvanceClock(200);
+    hostSetPin(WRITE_PIN, HIGH);
+    hostAdvanceClock(200);
+    hostSetPin(WRITE_PIN, LOW);
+
+    ButtonInput::button_event event;
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_TRUE(event.pressed);
+    TEST_ASSERT_FALSE(buttons.poll(event));
+    TEST_ASSERT_TRUE(buttons.isPressed(WRITE_PIN));
+}
+
+
+void test_notifies_wake_task()
+{
+    ButtonInput buttons;
+    buttons.attach(SEND_PIN);
+    buttons.setWakeTask(xTaskGetCurrentTaskHandle());
+    settle();
+
+    hostSetPin(SEND_PIN, LOW);
+    TEST_ASSERT_EQUAL_UINT32(1, ulTaskNotifyTake(pdTRUE, 0));
+    TEST_ASSERT_EQUAL_UINT32(0, ulTaskNotifyTake(pdTRUE, 0));
+}
+
+
+void test_resync_catches_missed_edge()
+{
+    ButtonInput buttons;
+    buttons.attach(SEND_PIN);
+    settle();
+
+    // Edge interrupts do not fire in light sleep: the level changes unseen
+    digitalWrite(SEND_PIN, LOW);
+    ButtonInput::button_event event;
+    TEST_ASSERT_FALSE(buttons.poll(event));
+
+    buttons.resync();
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_EQUAL_UINT8(SEND_PIN, event.pin);
+    TEST_ASSERT_TRUE(event.pressed);
+
+    buttons.resync();
+    TEST_ASSERT_FALSE(buttons.poll(event));
+}
+
+
+void test_counts_dropped_events()
+{
+    ButtonInput buttons;
+    buttons.attach(WRITE_PIN);
+    for (int i = 0; i < 40; i++)
+    {
+        settle();
+        hostSetPin(WRITE_PIN, i % 2 == 0 ? LOW : HIGH);
+    }
+    TEST_ASSERT_EQUAL(8, buttons.getDroppedEvents());
+}
+
+
+/*
+ * What setupPowerSaving() used to do: a low-level wakeup replaces the edge
+ * interrupt, so a held button interrupts without end and its release is
+ * never seen.
+ */
+void test_low_level_wakeup_storms_while_held()
+{
+    ButtonInput buttons;
+    buttons.attach(SEND_PIN);
+    settle();
+    gpio_wakeup_enable((gpio_num_t)SEND_PIN, GPIO_INTR_LOW_LEVEL);
+
+    hostSetPin(SEND_PIN, LOW);
+    TEST_ASSERT_TRUE(hostGetInterrupts(SEND_PIN) >= 1000);
+
+    settle();
+    hostSetPin(SEND_PIN, HIGH);
+    ButtonInput::button_event event;
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_TRUE(event.pressed);
+    TEST_ASSERT_FALSE(buttons.poll(event));
+}
+
+
+void test_wakeup_interrupts_once_per_change()
+{
+    ButtonInput buttons;
+    buttons.attach(SEND_PIN);
+    buttons.enableWakeup();
+    settle();
+
+    hostSetPin(SEND_PIN, LOW);
+    uint32_t pressed_at = micros();
+    hostAdvanceClock(2000000);
+    TEST_ASSERT_EQUAL(1, hostGetInterrupts(SEND_PIN));
+    hostSetPin(SEND_PIN, HIGH);
+    TEST_ASSERT_EQUAL(2, hostGetInterrupts(SEND_PIN));
+
+    ButtonInput::button_event event;
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_TRUE(event.pressed);
+    TEST_ASSERT_EQUAL_UINT32(pressed_at, event.time_us);
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_FALSE(event.pressed);
+    TEST_ASSERT_EQUAL_UINT32(pressed_at + 2000000, event.time_us);
+    TEST_ASSERT_FALSE(buttons.poll(event));
+}
+
+
+/*
+ * An interrupt rejected as bounce still moves the pin off its level, so
+ * bounce costs one interrupt per change and not a storm.
+ */
+void test_wakeup_ignores_bounce_without_storm()
+{
+    ButtonInput buttons;
+    buttons.attach(WRITE_PIN);
+    buttons.enableWakeup();
+    settle();
+
+    hostSetPin(WRITE_PIN, LOW);
+    hostAdvanceClock(200);
+    hostSetPin(WRITE_PIN, HIGH);
+    hostAdvanceClock(200);
+    hostSetPin(WRITE_PIN, LOW);
+    TEST_ASSERT_EQUAL(3, hostGetInterrupts(WRITE_PIN));
+
+    ButtonInput::button_event event;
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_TRUE(event.pressed);
+    TEST_ASSERT_FALSE(buttons.poll(event));
+
+    settle();
+    hostSetPin(WRITE_PIN, HIGH);
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_FALSE(event.pressed);
+}
+
+
+/*
+ * A button already held when the wakeup is enabled, or pressed unseen in
+ * light sleep, is armed for its release.
+ */
+void test_wakeup_arms_held_button_for_release()
+{
+    ButtonInput buttons;
+    buttons.attach(SEND_PIN);
+    settle();
+    digitalWrite(SEND_PIN, LOW);
+    buttons.enableWakeup();
+    TEST_ASSERT_EQUAL(0, hostGetInterrupts(SEND_PIN));
+
+    buttons.resync();
+    settle();
+    hostSetPin(SEND_PIN, HIGH);
+    TEST_ASSERT_EQUAL(1, hostGetInterrupts(SEND_PIN));
+
+    ButtonInput::button_event event;
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_TRUE(event.pressed);
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_FALSE(event.pressed);
+}
+
+
+void test_keeps_order_of_edges_across_buttons()
+{
+    ButtonInput buttons;
+    buttons.attach(SEND_PIN);
+    buttons.attach(WRITE_PIN);
+    settle();
+
+    // The write button is pressed within the debounce time of the send
+    // button, which only debounces its own edges
+    hostSetPin(SEND_PIN, LOW);
+    hostAdvanceClock(300);
+    hostSetPin(WRITE_PIN, LOW);
+    settle();
+    hostSetPin(SEND_PIN, HIGH);
+
+    ButtonInput::button_event event;
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_EQUAL_UINT8(SEND_PIN, event.pin);
+    TEST_ASSERT_TRUE(event.pressed);
+    uint32_t first_us = event.time_us;
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_EQUAL_UINT8(WRITE_PIN, event.pin);
+    TEST_ASSERT_TRUE(event.pressed);
+    TEST_ASSERT_EQUAL_UINT32(first_us + 300, event.time_us);
+    TEST_ASSERT_TRUE(buttons.poll(event));
+    TEST_ASSERT_EQUAL_UINT8(SEND_PIN, event.pin);
+    TEST_ASSERT_FALSE(event.pressed);
+    TEST_ASSERT_FALSE(buttons.poll(event));
+
+    TEST_ASSERT_FALSE(buttons.isPressed(SEND_PIN));
+    TEST_ASSERT_TRUE(buttons.isPressed(WRITE_PIN));
+}
+
+
+void test_attaches_at_most_max_buttons()
+{
+    ButtonInput buttons;
+    for (size_t i = 0; i < ButtonInput::MAX_BUTTONS; i++)
+    {
+        pinMode(30 + i, INPUT_PULLUP);
+        TEST_ASSERT_TRUE(buttons.attach(30 + i));
+    }
+    pinMode(SEND_PIN, INPUT_PULLUP);
+    TEST_ASSERT_FALSE(buttons.attach(SEND_PIN));
+    for (size_t i = 0; i < ButtonInput::MAX_BUTTONS; i++)
+    {
+        detachInterrupt(30 + i);
+    }
+
+    // The button left out never queues anything
+    settle();
+    hostSetPin(SEND_PIN, LOW);
+    ButtonInput::button_event event;
+    TEST_ASSERT_FALSE(buttons.poll(event));
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_queues_timestamped_edges);
+    RUN_TEST(test_ignores_bounce);
+    RUN_TEST(test_notifies_wake_task);
+    RUN_TEST(test_resync_catches_missed_edge);
+    RUN_TEST(test_counts_dropped_events);
+    RUN_TEST(test_low_level_wakeup_storms_while_held);
+    RUN_TEST(test_wakeup_interrupts_once_per_change);
+    RUN_TEST(test_wakeup_ignores_bounce_without_storm);
+    RUN_TEST(test_wakeup_arms_held_button_for_release);
+    RUN_TEST(test_keeps_order_of_edges_across_buttons);
+    RUN_TEST(test_attaches_at_most_max_buttons);
+    return UNITY_END();
+}
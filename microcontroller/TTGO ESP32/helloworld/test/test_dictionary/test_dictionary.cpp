@@ -0,0 +1,217 @@
+#include <string.h>
+#include <unity.h>
+
+#include <string>
+
+#include "dictionary.hpp"
+
+
+/**
+ * The image tools/build_dictionary.py makes of these words, most likely
+ * first:
+ *
+ *     THE
+ *     TO
+ *     THERE
+ *     TEA
+ *     QSO
+ *     ABCDEFGHIJKLMNOPQRSTUVWXYZ
+ *
+ * The last is longer than Dictionary::MAX_DEPTH.
+ */
+static const uint8_t IMAGE[] = {
+    0x4D, 0x44, 0x49, 0x43, 0x01, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xFF, 0x01,
+    0x01, 0x00, 0x5A, 0x00, 0x00, 0x08, 0x01, 0x01, 0x00, 0x59, 0x00, 0x00,
+    0x0B, 0x01, 0x01, 0x00, 0x58, 0x00, 0x00, 0x12, 0x01, 0x01, 0x00, 0x57,
+    0x00, 0x00, 0x19, 0x01, 0x01, 0x00, 0x56, 0x00, 0x00, 0x20, 0x01, 0x01,
+    0x00, 0x55, 0x00, 0x00, 0x27, 0x01, 0x01, 0x00, 0x54, 0x00, 0x00, 0x2E,
+    0x01, 0x01, 0x00, 0x53, 0x00, 0x00, 0x35, 0x01, 0x01, 0x00, 0x52, 0x00,
+    0x00, 0x3C, 0x01, 0x01, 0x00, 0x51, 0x00, 0x00, 0x43, 0x01, 0x01, 0x00,
+    0x50, 0x00, 0x00, 0x4A, 0x01, 0x01, 0x00, 0x4F, 0x00, 0x00, 0x51, 0x01,
+    0x01, 0x00, 0x4E, 0x00, 0x00, 0x58, 0x01, 0x01, 0x00, 0x4D, 0x00, 0x00,
+    0x5F, 0x01, 0x01, 0x00, 0x4C, 0x00, 0x00, 0x66, 0x01, 0x01, 0x00, 0x4B,
+    0x00, 0x00, 0x6D, 0x01, 0x01, 0x00, 0x4A, 0x00, 0x00, 0x74, 0x01, 0x01,
+    0x00, 0x49, 0x00, 0x00, 0x7B, 0x01, 0x01, 0x00, 0x48, 0x00, 0x00, 0x82,
+    0x01, 0x01, 0x00, 0x47, 0x00, 0x00, 0x89, 0x01, 0x01, 0x00, 0x46, 0x00,
+    0x00, 0x90, 0x01, 0x01, 0x00, 0x45, 0x00, 0x00, 0x97, 0x01, 0x01, 0x00,
+    0x44, 0x00, 0x00, 0x9E, 0x01, 0x01, 0x00, 0x43, 0x00, 0x00, 0xA5, 0x01,
+    0x01, 0x00, 0x42, 0x00, 0x00, 0xAC, 0x80, 0x34, 0xFF, 0x01, 0x34, 0x00,
+    0x4F, 0x00, 0x00, 0xBA, 0x01, 0x34, 0x00, 0x53, 0x00, 0x00, 0xBD, 0x80,
+    0x67, 0xFF, 0x01, 0x67, 0x00, 0x41, 0x00, 0x00, 0xCB, 0x80, 0x9A, 0xFF,
+    0x01, 0x9A, 0x00, 0x45, 0x00, 0x00, 0xD5, 0x81, 0xFF, 0xFF, 0x52, 0x00,
+    0x00, 0xD8, 0x01, 0xFF, 0x00, 0x45, 0x00, 0x00, 0xDF, 0x80, 0xCD, 0xFF,
+    0x03, 0xFF, 0x01, 0x45, 0x00, 0x00, 0xCE, 0x48, 0x00, 0x00, 0xE6, 0x4F,
+    0x00, 0x00, 0xED, 0x03, 0xFF, 0x02, 0x41, 0x00, 0x00, 0xB3, 0x51, 0x00,
+    0x00, 0xC4, 0x54, 0x00, 0x00, 0xF0,
+};
+
+static const char* const LONG_WORD = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+
+/**
+ * Checks the completion the dictionary offers for the prefix it follows.
+ */
+static void assertCompletion(const char* expected, const Dictionary& dictionary)
+{
+    char completion[Dictionary::MAX_DEPTH + 8];
+    size_t length = dictionary.getCompletion(completion, sizeof(completion));
+    TEST_ASSERT_EQUAL_STRING(expected, completion);
+    TEST_ASSERT_EQUAL(strlen(expected), length);
+}
+
+
+/**
+ * Follows the prefix and checks the completion offered for it.
+ */
+static void assertCompletes(const char* expected, Dictionary& dictionary,
+                            const char* prefix)
+{
+    dictionary.setPrefix(prefix, strlen(prefix));
+    assertCompletion(expected, dictionary);
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_completes_to_the_most_likely_word()
+{
+    Dictionary dictionary(IMAGE, sizeof(IMAGE));
+    TEST_ASSERT_TRUE(dictionary.isValid());
+    assertCompletes("HE", dictionary, "T");
+    assertCompletes("E", dictionary, "TH");
+    assertCompletes("E", dictionary, "THER");
+    assertCompletes("A", dictionary, "TE");
+    assertCompletes("SO", dictionary, "Q");
+}
+
+
+void test_no_completion_for_a_whole_word_or_empty_prefix()
+{
+    Dictionary dictionary(IMAGE, sizeof(IMAGE));
+    assertCompletes("", dictionary, "THE");
+    assertCompletes("", dictionary, "TO");
+    assertCompletes("", dictionary, "");
+}
+
+
+void test_folds_lower_case()
+{
+    Dictionary dictionary(IMAGE, sizeof(IMAGE));
+    assertCompletes("HE", dictionary, "t");
+    assertCompletes("E", dictionary, "tHeR");
+
+    // A prefix that differs only in case is the same prefix
+    TEST_ASSERT_FALSE(dictionary.setPrefix("THER", 4));
+    assertCompletion("E", dictionary);
+}
+
+
+void test_mismatched_prefix_has_no_completion()
+{
+    Dictionary dictionary(IMAGE, sizeof(IMAGE));
+    assertCompletes("", dictionary, "X");
+    assertCompletes("", dictionary, "THX");
+    assertCompletes("", dictionary, "THXE");
+
+    // Stepping back to where the prefix matched offers completions again
+    assertCompletes("E", dictionary, "TH");
+    assertCompletes("", dictionary, "TOE");
+    assertCompletes("HE", dictionary, "T");
+}
+
+
+void test_set_prefix_reports_changes()
+{
+    Dictionary dictionary(IMAGE, sizeof(IMAGE));
+    TEST_ASSERT_TRUE(dictionary.setPrefix("TH", 2));
+    TEST_ASSERT_FALSE(dictionary.setPrefix("TH", 2));
+    TEST_ASSERT_TRUE(dictionary.setPrefix("T", 1));
+    TEST_ASSERT_TRUE(dictionary.setPrefix("", 0));
+    TEST_ASSERT_FALSE(dictionary.setPrefix("", 0));
+}
+
+
+void test_completion_is_cut_to_the_buffer()
+{
+    Dictionary dictionary(IMAGE, sizeof(IMAGE));
+    dictionary.setPrefix("A", 1);
+    char completion[4];
+    TEST_ASSERT_EQUAL(3, dictionary.getCompletion(completion,
+                                                  sizeof(completion)));
+    TEST_ASSERT_EQUAL_STRING("BCD", completion);
+    TEST_ASSERT_EQUAL(0, dictionary.getCompletion(completion, 0));
+}
+
+
+void test_prefix_beyond_max_depth()
+{
+    Dictionary dictionary(IMAGE, sizeof(IMAGE));
+    std::string word = LONG_WORD;
+    std::string within = word.substr(0, Dictionary::MAX_DEPTH);
+    std::string beyond = word.substr(0, Dictionary::MAX_DEPTH + 1);
+    assertCompletes("YZ", dictionary, within.c_str());
+
+    // The letters beyond MAX_DEPTH are not followed, so there is no completion
+    assertCompletes("", dictionary, beyond.c_str());
+    assertCompletes("", dictionary, word.c_str());
+
+    // The letters beyond cannot be compared, so a change there is a change
+    std::string changed = within + "QQ";
+    TEST_ASSERT_TRUE(dictionary.setPrefix(changed.c_str(), changed.size()));
+    assertCompletion("", dictionary);
+
+    // Going back within MAX_DEPTH starts over, and completes again
+    TEST_ASSERT_TRUE(dictionary.setPrefix(within.c_str(), within.size()));
+    assertCompletion("YZ", dictionary);
+    assertCompletes("E", dictionary, "TH");
+}
+
+
+void test_bad_images_are_empty()
+{
+    uint8_t image[sizeof(IMAGE)];
+
+    memcpy(image, IMAGE, sizeof(image));
+    image[0] = 'X';
+    Dictionary bad_magic(image, sizeof(image));
+    TEST_ASSERT_FALSE(bad_magic.isValid());
+    assertCompletes("", bad_magic, "T");
+
+    memcpy(image, IMAGE, sizeof(image));
+    image[4] = 2;
+    Dictionary bad_version(image, sizeof(image));
+    TEST_ASSERT_FALSE(bad_version.isValid());
+    assertCompletes("", bad_version, "T");
+
+    // The root lies beyond the end of a truncated image
+    Dictionary truncated(IMAGE, sizeof(IMAGE) - 1);
+    TEST_ASSERT_FALSE(truncated.isValid());
+    assertCompletes("", truncated, "T");
+
+    Dictionary header_only(IMAGE, 4);
+    TEST_ASSERT_FALSE(header_only.isValid());
+    assertCompletes("", header_only, "T");
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_completes_to_the_most_likely_word);
+    RUN_TEST(test_no_completion_for_a_whole_word_or_empty_prefix);
+    RUN_TEST(test_folds_lower_case);
+    RUN_TEST(test_mismatched_prefix_has_no_completion);
+    RUN_TEST(test_set_prefix_reports_changes);
+    RUN_TEST(test_completion_is_cut_to_the_buffer);
+    RUN_TEST(test_prefix_beyond_max_depth);
+    RUN_TEST(test_bad_images_are_empty);
+    return UNITY_END();
+}
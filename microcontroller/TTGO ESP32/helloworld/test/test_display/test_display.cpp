@@ -0,0 +1,158 @@
+#include <unity.h>
+
+#include <string>
+
+#include <TFT_eSPI.h>
+
+#include "display.hpp"
+
+
+static TFT_eSPI* tft;
+static ScreenRenderer* screen;
+
+
+void setUp()
+{
+    tft = new TFT_eSPI();
+    tft->setRotation(1);
+    screen = new ScreenRenderer(*tft);
+    TEST_ASSERT_TRUE(screen->begin());
+}
+
+
+void tearDown()
+{
+    delete screen;
+    delete tft;
+}
+
+
+void test_counts_what_reaches_the_panel()
+{
+    screen->setField(0, 10, 10, 2, "HELLO");
+    TEST_ASSERT_TRUE(screen->render(0));
+
+    // Five characters of 12x16 pixels at two bytes each
+    TEST_ASSERT_EQUAL(5 * 12 * 16, tft->getPixelsWritten());
+    TEST_ASSERT_EQUAL(2 * tft->getPixelsWritten(), screen->getTotalBytes());
+}
+
+
+void test_idle_screen_pushes_nothing()
+{
+    screen->setField(0, 10, 10, 2, "HELLO");
+    screen->render(0);
+    unsigned long pixels = tft->getPixelsWritten();
+
+    screen->setField(0, 10, 10, 2, "HELLO");
+    TEST_ASSERT_FALSE(screen->render(10));
+    TEST_ASSERT_EQUAL(pixels, tft->getPixelsWritten());
+}
+
+
+void test_only_changed_columns_are_pushed()
+{
+    screen->setField(0, 10, 10, 2, "HELLO");
+    screen->render(0);
+    unsigned long pixels = tft->getPixelsWritten();
+
+    screen->setField(0, 10, 10, 2, "HELP");
+    TEST_ASSERT_TRUE(screen->render(10));
+
+    // From the fourth character to the end of the longer text
+    TEST_ASSERT_EQUAL(pixels + 2 * 12 * 16, tft->getPixelsWritten());
+}
+
+
+void test_moved_field_is_cleared_and_redrawn()
+{
+    screen->setField(1, 0, 40, 1, "ABC");
+    screen->render(0);
+    unsigned long pixels = tft->getPixelsWritten();
+
+    screen->setField(1, 0, 60, 1, "ABC");
+    screen->render(10);
+    TEST_ASSERT_EQUAL(pixels + 2 * 3 * 6 * 8, tft->getPixelsWritten());
+}
+
+
+void test_bytes_per_second_window()
+{
+    screen->setField(0, 0, 0, 1, "A");
+    screen->render(0);
+    TEST_ASSERT_EQUAL(0, screen->getBytesPerSecond());
+
+    screen->setField(0, 0, 0, 1, "B");
+    screen->render(1000);
+    TEST_ASSERT_EQUAL(2 * 2 * 6 * 8, screen->getBytesPerSecond());
+}
+
+
+void test_alert_covers_and_restores_fields()
+{
+    screen->setField(0, 10, 10, 2, "HI");
+    screen->render(0);
+
+    screen->showAlert("SENT", 0);
+    TEST_ASSERT_TRUE(screen->isAlertShown(500));
+    unsigned long delay;
+    TEST_ASSERT_TRUE(screen->getAlertDelay(500, delay));
+    TEST_ASSERT_EQUAL(500, delay);
+    screen->render(500);
+
+    unsigned long pixels = tft->getPixelsWritten();
+    TEST_ASSERT_FALSE(screen->isAlertShown(ScreenRenderer::ALERT_MS));
+    TEST_ASSERT_TRUE(screen->render(ScreenRenderer::ALERT_MS));
+    TEST_ASSERT_GREATER_THAN(pixels, tft->getPixelsWritten());
+    TEST_ASSERT_FALSE(screen->getAlertDelay(ScreenRenderer::ALERT_MS, delay));
+}
+
+
+void test_cleared_field_is_blanked_once()
+{
+    screen->setField(2, 0, 80, 1, "ABC");
+    screen->render(0);
+    unsigned long pixels = tft->getPixelsWritten();
+
+    screen->clearField(2);
+    TEST_ASSERT_TRUE(screen->render(10));
+    TEST_ASSERT_EQUAL(pixels + 3 * 6 * 8, tft->getPixelsWritten());
+    TEST_ASSERT_FALSE(screen->render(20));
+}
+
+
+void test_cursor_blink_pushes_one_column()
+{
+    screen->setField(0, 10, 10, 2, "HELLO", true);
+    screen->render(0);
+    unsigned long pixels = tft->getPixelsWritten();
+
+    screen->setField(0, 10, 10, 2, "HELLO", false);
+    TEST_ASSERT_TRUE(screen->render(500));
+    TEST_ASSERT_EQUAL(pixels + 12 * 16, tft->getPixelsWritten());
+}
+
+
+void test_text_past_the_edge_is_cut_off()
+{
+    std::string text(30, 'W');
+    screen->setField(0, 0, 0, 2, text.c_str());
+    TEST_ASSERT_TRUE(screen->render(0));
+    TEST_ASSERT_EQUAL(tft->width() * 16, tft->getPixelsWritten());
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_counts_what_reaches_the_panel);
+    RUN_TEST(test_idle_screen_pushes_nothing);
+    RUN_TEST(test_only_changed_columns_are_pushed);
+    RUN_TEST(test_moved_field_is_cleared_and_redrawn);
+    RUN_TEST(test_bytes_per_second_window);
+    RUN_TEST(test_alert_covers_and_restores_fields);
+    RUN_TEST(test_cleared_field_is_blanked_once);
+    RUN_TEST(test_cursor_blink_pushes_one_column);
+    RUN_TEST(test_text_past_the_edge_is_cut_off);
+    return UNITY_END();
+}
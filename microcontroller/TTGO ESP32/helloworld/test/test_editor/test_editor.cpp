@@ -0,0 +1,215 @@
+#include <string.h>
+#include <unity.h>
+
+#include <string>
+
+#include "editor.hpp"
+
+
+/**
+ * Keys the elements of a letter, given as '.' and '-', and closes it.
+ */
+static MessageEditor::letter_result keyLetter(MessageEditor& editor,
+                                              const char* elements)
+{
+    for (; *elements != '\0'; elements++)
+    {
+        editor.addElement(*elements == '-');
+    }
+    return editor.closeLetter();
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_decodes_letters_into_message()
+{
+    MessageEditor editor;
+    TEST_ASSERT_EQUAL(MessageEditor::LETTER_ADDED, keyLetter(editor, "...."));
+    TEST_ASSERT_EQUAL(MessageEditor::LETTER_ADDED, keyLetter(editor, ".."));
+    TEST_ASSERT_EQUAL_STRING("HI", editor.getMessage());
+    TEST_ASSERT_EQUAL_STRING("", editor.getLetter());
+    TEST_ASSERT_FALSE(editor.hasElements());
+}
+
+
+void test_decodes_digits_and_prosigns()
+{
+    MessageEditor editor;
+    keyLetter(editor, ".----");
+    keyLetter(editor, "...-.-");
+    TEST_ASSERT_EQUAL_STRING("1<SK>", editor.getMessage());
+}
+
+
+void test_keeps_invalid_letter_for_correction()
+{
+    MessageEditor editor;
+    TEST_ASSERT_EQUAL(MessageEditor::LETTER_INVALID,
+                      keyLetter(editor, "......."));
+    TEST_ASSERT_EQUAL_STRING(".......", editor.getLetter());
+    TEST_ASSERT_EQUAL_STRING("", editor.getMessage());
+
+    editor.removeElement();
+    editor.removeElement();
+    TEST_ASSERT_EQUAL(MessageEditor::LETTER_ADDED, editor.closeLetter());
+    TEST_ASSERT_EQUAL_STRING("5", editor.getMessage());
+}
+
+
+void test_empty_letter_adds_space()
+{
+    MessageEditor editor;
+    keyLetter(editor, ".");
+    TEST_ASSERT_EQUAL(MessageEditor::SPACE_ADDED, editor.closeLetter());
+    TEST_ASSERT_EQUAL_STRING("E ", editor.getMessage());
+}
+
+
+void test_word_space_is_not_doubled()
+{
+    MessageEditor editor;
+    TEST_ASSERT_FALSE(editor.addWordSpace());
+    keyLetter(editor, "-");
+    TEST_ASSERT_TRUE(editor.addWordSpace());
+    TEST_ASSERT_FALSE(editor.addWordSpace());
+    TEST_ASSERT_EQUAL_STRING("T ", editor.getMessage());
+}
+
+
+void test_last_word_follows_the_last_space()
+{
+    MessageEditor editor;
+    TEST_ASSERT_EQUAL_STRING("", editor.getLastWord());
+    keyLetter(editor, "....");
+    keyLetter(editor, ".");
+    TEST_ASSERT_EQUAL_STRING("HE", editor.getLastWord());
+    editor.addWordSpace();
+    TEST_ASSERT_EQUAL_STRING("", editor.getLastWord());
+    keyLetter(editor, ".-..");
+    TEST_ASSERT_EQUAL_STRING("L", editor.getLastWord());
+}
+
+
+void test_add_text_completes_word()
+{
+    MessageEditor editor;
+    keyLetter(editor, "....");
+    TEST_ASSERT_TRUE(editor.addText("ELLO"));
+    TEST_ASSERT_EQUAL_STRING("HELLO", editor.getMessage());
+}
+
+
+void test_recent_word_outlasts_one_space()
+{
+    MessageEditor editor;
+    size_t length;
+    editor.getRecentWord(length);
+    TEST_ASSERT_EQUAL(0, length);
+    keyLetter(editor, "....");
+    keyLetter(editor, ".");
+    TEST_ASSERT_EQUAL_STRING("HE", editor.getRecentWord(length));
+    TEST_ASSERT_EQUAL(2, length);
+    editor.addWordSpace();
+    const char* word = editor.getRecentWord(length);
+    TEST_ASSERT_EQUAL(2, length);
+    TEST_ASSERT_EQUAL(0, strncmp("HE", word, length));
+    keyLetter(editor, ".-..");
+    TEST_ASSERT_EQUAL_STRING("L", editor.getRecentWord(length));
+    TEST_ASSERT_EQUAL(1, length);
+}
+
+
+void test_complete_word_goes_before_closing_space()
+{
+    MessageEditor editor;
+    keyLetter(editor, "....");
+    TEST_ASSERT_TRUE(editor.completeWord("I"));
+    TEST_ASSERT_EQUAL_STRING("HI ", editor.getMessage());
+
+    keyLetter(editor, "....");
+    keyLetter(editor, ".");
+    editor.addWordSpace();
+    TEST_ASSERT_TRUE(editor.completeWord("LLO"));
+    TEST_ASSERT_EQUAL_STRING("HI HELLO ", editor.getMessage());
+}
+
+
+void test_complete_word_that_does_not_fit_keeps_message()
+{
+    MessageEditor editor;
+    for (size_t i = 0; i < MessageEditor::MESSAGE_CAPACITY - 1; i++)
+    {
+        keyLetter(editor, ".");
+    }
+    editor.addWordSpace();
+    std::string before = editor.getMessage();
+    TEST_ASSERT_FALSE(editor.completeWord("EE"));
+    TEST_ASSERT_EQUAL_STRING(before.c_str(), editor.getMessage());
+}
+
+
+void test_remove_character_and_clear()
+{
+    MessageEditor editor;
+    keyLetter(editor, "-.-.");
+    keyLetter(editor, "---");
+    editor.removeCharacter();
+    TEST_ASSERT_EQUAL_STRING("C", editor.getMessage());
+    editor.clearMessage();
+    TEST_ASSERT_EQUAL_STRING("", editor.getMessage());
+}
+
+
+void test_full_message_refuses_letters()
+{
+    MessageEditor editor;
+    for (size_t i = 0; i < MessageEditor::MESSAGE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(MessageEditor::LETTER_ADDED, keyLetter(editor, "."));
+    }
+    TEST_ASSERT_EQUAL(MessageEditor::MESSAGE_FULL, keyLetter(editor, "."));
+    TEST_ASSERT_FALSE(editor.hasElements());
+    TEST_ASSERT_FALSE(editor.addText("E"));
+    TEST_ASSERT_EQUAL(MessageEditor::MESSAGE_CAPACITY,
+                      strlen(editor.getMessage()));
+}
+
+
+void test_letter_longer_than_any_symbol_is_refused()
+{
+    MessageEditor editor;
+    for (size_t i = 0; i < MORSE_MAX_ELEMENTS; i++)
+    {
+        TEST_ASSERT_TRUE(editor.addElement(false));
+    }
+    TEST_ASSERT_FALSE(editor.addElement(false));
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_decodes_letters_into_message);
+    RUN_TEST(test_decodes_digits_and_prosigns);
+    RUN_TEST(test_keeps_invalid_letter_for_correction);
+    RUN_TEST(test_empty_letter_adds_space);
+    RUN_TEST(test_word_space_is_not_doubled);
+    RUN_TEST(test_last_word_follows_the_last_space);
+    RUN_TEST(test_add_text_completes_word);
+    RUN_TEST(test_recent_word_outlasts_one_space);
+    RUN_TEST(test_complete_word_goes_before_closing_space);
+    RUN_TEST(test_complete_word_that_does_not_fit_keeps_message);
+    RUN_TEST(test_remove_character_and_clear);
+    RUN_TEST(test_full_message_refuses_letters);
+    RUN_TEST(test_letter_longer_than_any_symbol_is_refused);
+    return UNITY_END();
+}
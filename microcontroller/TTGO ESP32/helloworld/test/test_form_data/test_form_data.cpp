@@ -0,0 +1,125 @@
+#include <unity.h>
+
+#include <string>
+
+#include "network.hpp"
+
+
+/**
+ * Collects what is written to it.
+ */
+class StringPrint : public Print
+{
+public:
+    size_t write(uint8_t c) override
+    {
+        text += (char)c;
+        return 1;
+    }
+
+    size_t write(const uint8_t* data, size_t length) override
+    {
+        text.append((const char*)data, length);
+        return length;
+    }
+
+    std::string text;
+};
+
+
+/**
+ * Writes the form, checking that its length was announced exactly.
+ */
+static std::string write(const FormDataFormatter& form)
+{
+    StringPrint out;
+    size_t written = form.writeTo(out);
+    TEST_ASSERT_EQUAL(out.text.size(), written);
+    TEST_ASSERT_EQUAL(written, form.getContentLength());
+    return out.text;
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_writes_nothing_without_pairs()
+{
+    FormDataFormatter form;
+    std::string text = write(form);
+    TEST_ASSERT_EQUAL_STRING("", text.c_str());
+    TEST_ASSERT_EQUAL_STRING("application/x-www-form-urlencoded",
+                             form.getContentType());
+}
+
+
+void test_joins_pairs()
+{
+    FormDataFormatter form;
+    form.addPair("macAddress", "24-0A-C4");
+    form.addPair("limit", "4");
+    form.addPair("empty", "");
+    std::string text = write(form);
+    TEST_ASSERT_EQUAL_STRING("macAddress=24-0A-C4&limit=4&empty=",
+                             text.c_str());
+}
+
+
+/*
+ * The characters that used to corrupt the request, "&" and "=", are escaped
+ * along with everything outside the unreserved set.
+ */
+void test_percent_encodes_values_and_keys()
+{
+    FormDataFormatter form;
+    form.addPair("message", "A&B=C+D 50% ok?");
+    form.addPair("k y", "*-._~/:");
+    std::string text = write(form);
+    TEST_ASSERT_EQUAL_STRING(
+        "message=A%26B%3DC%2BD+50%25+ok%3F&k+y=*-._%7E%2F%3A", text.c_str());
+}
+
+
+void test_encodes_bytes_above_ascii_in_upper_case_hex()
+{
+    FormDataFormatter form;
+    form.addPair("message", "\xC3\xA9\x7F\x01");
+    std::string text = write(form);
+    TEST_ASSERT_EQUAL_STRING("message=%C3%A9%7F%01", text.c_str());
+}
+
+
+void test_ignores_pairs_beyond_capacity()
+{
+    FormDataFormatter form;
+    for (int i = 0; i < FormDataFormatter::MAX_PAIRS + 3; i++)
+    {
+        form.addPair("k", "v");
+    }
+    std::string expected = "k=v";
+    for (int i = 1; i < FormDataFormatter::MAX_PAIRS; i++)
+    {
+        expected += "&k=v";
+    }
+    std::string text = write(form);
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), text.c_str());
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_writes_nothing_without_pairs);
+    RUN_TEST(test_joins_pairs);
+    RUN_TEST(test_percent_encodes_values_and_keys);
+    RUN_TEST(test_encodes_bytes_above_ascii_in_upper_case_hex);
+    RUN_TEST(test_ignores_pairs_beyond_capacity);
+    return UNITY_END();
+}
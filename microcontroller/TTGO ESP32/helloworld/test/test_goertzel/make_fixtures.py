@@ -0,0 +1,80 @@
+"""Writes the WAV fixtures of test_goertzel.
+
+The recordings are made up the way the audio input samples them: 8 kHz mono,
+12 bit ADC readings around mid scale in 16 bit words. They are kept in the
+repository, so this only needs to be run again to change them:
+
+    python3 make_fixtures.py
+"""
+
+import math
+import os
+import random
+import struct
+import wave
+
+
+SAMPLE_RATE = 8000
+MID_SCALE = 2048
+
+MORSE = {
+    "H": "....", "I": "..", "O": "---", "S": "...",
+}
+
+
+def keying(text, unit_s):
+    """Returns the (on, seconds) spans that key the text."""
+    spans = []
+    for w, word in enumerate(text.split(" ")):
+        if w > 0:
+            spans.append((False, 7 * unit_s))
+        for l, letter in enumerate(word):
+            if l > 0:
+                spans.append((False, 3 * unit_s))
+            for e, element in enumerate(MORSE[letter]):
+                if e > 0:
+                    spans.append((False, unit_s))
+                spans.append((True, (3 if element == "-" else 1) * unit_s))
+    return spans
+
+
+def render(text, wpm, tone_hz, amplitude, noise=0.0, interference=0.0,
+           ramp_s=0.005, padding_s=0.4, seed=1):
+    """Returns the samples of the text keyed as a tone, with white noise and an
+    interfering tone of the given amplitudes."""
+    rng = random.Random(seed)
+    unit_s = 1.2 / wpm
+    spans = [(False, padding_s)] + keying(text, unit_s) + [(False, padding_s)]
+
+    samples = []
+    t = 0
+    for on, seconds in spans:
+        count = int(round(seconds * SAMPLE_RATE))
+        for i in range(count):
+            # The keying is shaped so the tone does not click
+            envelope = 0.0
+            if on:
+                edge = min(i, count - 1 - i) / (ramp_s * SAMPLE_RATE)
+                envelope = min(1.0, edge)
+            x = (amplitude * envelope *
+                 math.sin(2 * math.pi * tone_hz * t / SAMPLE_RATE))
+            x += interference * math.sin(2 * math.pi * 1100 * t / SAMPLE_RATE)
+            x += rng.gauss(0, noise)
+            samples.append(max(0, min(4095, int(round(MID_SCALE + x)))))
+            t += 1
+    return samples
+
+
+def write(name, samples):
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), name)
+    with wave.open(path, "wb") as wav:
+        wav.setnchannels(1)
+        wav.setsampwidth(2)
+        wav.setframerate(SAMPLE_RATE)
+        wav.writeframes(struct.pack("<%dh" % len(samples), *samples))
+
+
+if __name__ == "__main__":
+    write("sos_12wpm.wav", render("SOS", 12, 700, 600, noise=10))
+    write("hi_hi_12wpm_noisy.wav",
+          render("HI HI", 12, 700, 150, noise=60, interference=150, seed=2))
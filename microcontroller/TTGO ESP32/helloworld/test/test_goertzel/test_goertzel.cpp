@@ -0,0 +1,237 @@
+#include <math.h>
+#include <unity.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "goertzel.hpp"
+#include "keyer.hpp"
+#include "morse.hpp"
+
+
+/**
+ * The sampling of AudioInput, which is not built on the host.
+ */
+static const uint32_t SAMPLE_RATE = 8000;
+static const size_t BLOCK_SIZE = 80;
+static const uint32_t TONE_HZ = 700;
+
+
+static uint32_t readLittleEndian(const std::string& data, size_t offset,
+                                 size_t size)
+{
+    uint32_t value = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        value |= (uint32_t)(uint8_t)data[offset + i] << (8 * i);
+    }
+    return value;
+}
+
+
+/**
+ * Reads the samples of a 16 bit mono WAV fixture next to this file, found from
+ * the path it was compiled by or else in the working directory. The fixtures
+ * are written by make_fixtures.py.
+ */
+static std::vector<int16_t> readWav(const char* name)
+{
+    std::string path = __FILE__;
+    path = path.substr(0, path.find_last_of('/') + 1) + name;
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        file.open(name, std::ios::binary);
+    }
+    TEST_ASSERT_TRUE_MESSAGE(file.is_open(), path.c_str());
+    std::string data((std::istreambuf_iterator<char>(file)),
+                     std::istreambuf_iterator<char>());
+
+    TEST_ASSERT_TRUE(data.size() >= 12);
+    TEST_ASSERT_TRUE(data.compare(0, 4, "RIFF") == 0);
+    TEST_ASSERT_TRUE(data.compare(8, 4, "WAVE") == 0);
+
+    std::vector<int16_t> samples;
+    bool format_read = false;
+    for (size_t offset = 12; offset + 8 <= data.size(); )
+    {
+        std::string id = data.substr(offset, 4);
+        size_t size = readLittleEndian(data, offset + 4, 4);
+        size_t body = offset + 8;
+        TEST_ASSERT_TRUE(body + size <= data.size());
+
+        if (id == "fmt ")
+        {
+            TEST_ASSERT_EQUAL(1, readLittleEndian(data, body, 2));  // PCM
+            TEST_ASSERT_EQUAL(1, readLittleEndian(data, body + 2, 2));
+            TEST_ASSERT_EQUAL(SAMPLE_RATE, readLittleEndian(data, body + 4, 4));
+            TEST_ASSERT_EQUAL(16, readLittleEndian(data, body + 14, 2));
+            format_read = true;
+        }
+        else if (id == "data")
+        {
+            TEST_ASSERT_TRUE(format_read);
+            for (size_t i = 0; i + 1 < size; i += 2)
+            {
+                samples.push_back((int16_t)readLittleEndian(data, body + i, 2));
+            }
+        }
+        // Chunks are padded to an even size
+        offset = body + size + (size & 1);
+    }
+    TEST_ASSERT_FALSE(samples.empty());
+    return samples;
+}
+
+
+/**
+ * Returns blocks of a tone of the frequency and amplitude around the middle of
+ * the 12 bit ADC range.
+ */
+static std::vector<int16_t> makeTone(uint32_t tone_hz, double amplitude,
+                                     size_t blocks = 1)
+{
+    std::vector<int16_t> samples(blocks * BLOCK_SIZE);
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        samples[i] = (int16_t)lround(
+            2048 + amplitude * sin(2 * M_PI * tone_hz * i / SAMPLE_RATE)
+        );
+    }
+    return samples;
+}
+
+
+/**
+ * Decodes the samples as AudioInput and the main loop do: the tone detected
+ * in each block keys a MorseKeyer, whose breaks close letters and words.
+ */
+static std::string decode(const std::vector<int16_t>& samples)
+{
+    ToneDetector detector(SAMPLE_RATE, TONE_HZ, BLOCK_SIZE);
+    MorseKeyer keyer;
+    morse_code_t code = MORSE_EMPTY;
+    std::string text;
+
+    auto onBreak = [&](MorseKeyer::keyer_break found) {
+        if (found == MorseKeyer::LETTER_BREAK && code != MORSE_EMPTY)
+        {
+            const char* letter = morseDecode(code);
+            text += letter != NULL ? letter : "?";
+            code = MORSE_EMPTY;
+        }
+        else if (found == MorseKeyer::WORD_BREAK)
+        {
+            text += ' ';
+        }
+    };
+
+    uint32_t time_us = 0;
+    size_t blocks = samples.size() / BLOCK_SIZE;
+    for (size_t block = 0; block < blocks; block++)
+    {
+        time_us = (uint32_t)((uint64_t)block * BLOCK_SIZE * 1000000 / SAMPLE_RATE);
+        bool was_on = detector.isOn();
+        bool on = detector.process(&samples[block * BLOCK_SIZE]);
+        if (on && !was_on)
+        {
+            keyer.press(time_us);
+        }
+        else if (!on && was_on)
+        {
+            bool dash;
+            if (keyer.release(time_us, dash))
+            {
+                code = morseAppend(code, dash);
+            }
+        }
+        onBreak(keyer.poll(time_us));
+    }
+
+    // The silence after the recording closes the last letter, and may be long
+    // enough to close a word as well
+    onBreak(keyer.poll(time_us + 3 * keyer.getUnit()));
+    if (!text.empty() && text.back() == ' ')
+    {
+        text.pop_back();
+    }
+    return text;
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_tone_in_bin_is_on()
+{
+    ToneDetector detector(SAMPLE_RATE, TONE_HZ, BLOCK_SIZE);
+    std::vector<int16_t> samples = makeTone(TONE_HZ, 500);
+    TEST_ASSERT_TRUE(detector.process(samples.data()));
+    TEST_ASSERT_UINT32_WITHIN(32, 256, detector.getLevel());
+}
+
+
+void test_level_does_not_depend_on_volume()
+{
+    ToneDetector detector(SAMPLE_RATE, TONE_HZ, BLOCK_SIZE);
+    std::vector<int16_t> loud = makeTone(TONE_HZ, 1500);
+    std::vector<int16_t> quiet = makeTone(TONE_HZ, 30);
+    detector.process(loud.data());
+    uint32_t loud_level = detector.getLevel();
+    detector.process(quiet.data());
+    TEST_ASSERT_UINT32_WITHIN(16, loud_level, detector.getLevel());
+}
+
+
+void test_tone_outside_bin_is_off()
+{
+    ToneDetector detector(SAMPLE_RATE, TONE_HZ, BLOCK_SIZE);
+    std::vector<int16_t> samples = makeTone(1100, 500);
+    TEST_ASSERT_FALSE(detector.process(samples.data()));
+    TEST_ASSERT_LESS_THAN(ToneDetector::OFF_LEVEL, detector.getLevel());
+}
+
+
+void test_offset_without_tone_is_off()
+{
+    ToneDetector detector(SAMPLE_RATE, TONE_HZ, BLOCK_SIZE);
+    std::vector<int16_t> samples = makeTone(TONE_HZ, 0);
+    TEST_ASSERT_FALSE(detector.process(samples.data()));
+    TEST_ASSERT_EQUAL(0, detector.getLevel());
+}
+
+
+void test_decodes_recording()
+{
+    std::string text = decode(readWav("sos_12wpm.wav"));
+    TEST_ASSERT_EQUAL_STRING("SOS", text.c_str());
+}
+
+
+void test_decodes_noisy_recording()
+{
+    // A weak signal in noise, with a tone as strong at 1100 Hz
+    std::string text = decode(readWav("hi_hi_12wpm_noisy.wav"));
+    TEST_ASSERT_EQUAL_STRING("HI HI", text.c_str());
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_tone_in_bin_is_on);
+    RUN_TEST(test_level_does_not_depend_on_volume);
+    RUN_TEST(test_tone_outside_bin_is_off);
+    RUN_TEST(test_offset_without_tone_is_off);
+    RUN_TEST(test_decodes_recording);
+    RUN_TEST(test_decodes_noisy_recording);
+    return UNITY_END();
+}
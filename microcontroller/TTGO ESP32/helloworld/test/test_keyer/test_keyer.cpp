@@ -0,0 +1,193 @@
+#include <unity.h>
+
+#include "keyer.hpp"
+
+
+static const uint32_t UNIT_US = MorseKeyer::INITIAL_UNIT_US;
+
+
+/**
+ * Presses the key at the time for the duration and returns whether the press
+ * was a dash.
+ */
+static bool key(MorseKeyer& keyer, uint32_t time_us, uint32_t duration_us)
+{
+    bool dash = false;
+    keyer.press(time_us);
+    TEST_ASSERT_TRUE(keyer.release(time_us + duration_us, dash));
+    return dash;
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_classifies_against_initial_unit()
+{
+    MorseKeyer keyer;
+    TEST_ASSERT_FALSE(key(keyer, 0, UNIT_US));
+    TEST_ASSERT_TRUE(key(keyer, 2 * UNIT_US, 3 * UNIT_US));
+}
+
+
+void test_release_without_press_is_ignored()
+{
+    MorseKeyer keyer;
+    bool dash;
+    TEST_ASSERT_FALSE(keyer.release(1000, dash));
+}
+
+
+void test_reports_letter_then_word_break_once()
+{
+    MorseKeyer keyer;
+    key(keyer, 0, UNIT_US);
+    uint32_t released = UNIT_US;
+
+    TEST_ASSERT_EQUAL(MorseKeyer::NO_BREAK, keyer.poll(released + UNIT_US));
+    TEST_ASSERT_EQUAL(MorseKeyer::LETTER_BREAK,
+                      keyer.poll(released + 2 * UNIT_US));
+    TEST_ASSERT_EQUAL(MorseKeyer::NO_BREAK, keyer.poll(released + 3 * UNIT_US));
+    TEST_ASSERT_EQUAL(MorseKeyer::WORD_BREAK,
+                      keyer.poll(released + 5 * UNIT_US));
+    TEST_ASSERT_EQUAL(MorseKeyer::NO_BREAK,
+                      keyer.poll(released + 50 * UNIT_US));
+}
+
+
+void test_next_break_delay()
+{
+    MorseKeyer keyer;
+    uint32_t delay_us;
+    TEST_ASSERT_FALSE(keyer.getNextBreak(0, delay_us));
+
+    keyer.press(0);
+    TEST_ASSERT_FALSE(keyer.getNextBreak(0, delay_us));
+    bool dash;
+    keyer.release(UNIT_US, dash);
+
+    TEST_ASSERT_TRUE(keyer.getNextBreak(UNIT_US, delay_us));
+    TEST_ASSERT_EQUAL_UINT32(2 * UNIT_US, delay_us);
+    keyer.poll(3 * UNIT_US);
+    TEST_ASSERT_TRUE(keyer.getNextBreak(3 * UNIT_US, delay_us));
+    TEST_ASSERT_EQUAL_UINT32(3 * UNIT_US, delay_us);
+}
+
+
+void test_cancel_drops_pending_breaks()
+{
+    MorseKeyer keyer;
+    key(keyer, 0, UNIT_US);
+    keyer.cancel();
+    TEST_ASSERT_EQUAL(MorseKeyer::NO_BREAK, keyer.poll(10 * UNIT_US));
+}
+
+
+void test_adapts_to_faster_keying()
+{
+    // 20 words per minute is a 60 ms unit
+    const uint32_t fast_us = 60000;
+    MorseKeyer keyer;
+    uint32_t now = 0;
+
+    // Dots and gaps alone bring the unit down, after which dashes that were
+    // too short at the initial speed are told apart
+    for (int i = 0; i < 40; i++)
+    {
+        bool dash = i >= 12 && (i % 2) == 1;
+        TEST_ASSERT_EQUAL(dash, key(keyer, now, dash ? 3 * fast_us : fast_us));
+        now += (dash ? 3 * fast_us : fast_us) + fast_us;
+    }
+    TEST_ASSERT_UINT32_WITHIN(5000, fast_us, keyer.getUnit());
+    TEST_ASSERT_UINT32_WITHIN(2, 20, keyer.getWordsPerMinute());
+}
+
+
+void test_held_key_does_not_change_unit()
+{
+    MorseKeyer keyer;
+    TEST_ASSERT_TRUE(key(keyer, 0, 20 * UNIT_US));
+    TEST_ASSERT_EQUAL_UINT32(UNIT_US, keyer.getUnit());
+}
+
+
+void test_unit_is_clamped()
+{
+    MorseKeyer keyer;
+    uint32_t now = 0;
+    for (int i = 0; i < 100; i++)
+    {
+        key(keyer, now, 1000);
+        now += 2000;
+    }
+    TEST_ASSERT_EQUAL_UINT32(MorseKeyer::MIN_UNIT_US, keyer.getUnit());
+}
+
+
+void test_adapts_to_slower_keying()
+{
+    // 6 words per minute is a 200 ms unit
+    const uint32_t slow_us = 200000;
+    MorseKeyer keyer;
+    uint32_t now = 0;
+    for (int i = 0; i < 40; i++)
+    {
+        bool dash = i >= 12 && (i % 2) == 1;
+        TEST_ASSERT_EQUAL(dash, key(keyer, now, dash ? 3 * slow_us : slow_us));
+        now += (dash ? 3 * slow_us : slow_us) + slow_us;
+
+        // The gaps inside the letter never close it
+        TEST_ASSERT_EQUAL(MorseKeyer::NO_BREAK, keyer.poll(now));
+    }
+    TEST_ASSERT_UINT32_WITHIN(10000, slow_us, keyer.getUnit());
+    TEST_ASSERT_UINT32_WITHIN(1, 6, keyer.getWordsPerMinute());
+}
+
+
+void test_breaks_follow_the_adapted_unit()
+{
+    const uint32_t fast_us = 60000;
+    MorseKeyer keyer;
+    uint32_t now = 0;
+    for (int i = 0; i < 20; i++)
+    {
+        key(keyer, now, fast_us);
+        now += 2 * fast_us;
+    }
+    uint32_t unit_us = keyer.getUnit();
+    uint32_t released = now - fast_us;
+    TEST_ASSERT_TRUE(2 * unit_us < 2 * UNIT_US - fast_us);
+
+    // The letter closes after the silence of the faster unit, long before the
+    // initial unit would have closed it
+    TEST_ASSERT_EQUAL(MorseKeyer::NO_BREAK,
+                      keyer.poll(released + 2 * unit_us - 1));
+    TEST_ASSERT_EQUAL(MorseKeyer::LETTER_BREAK,
+                      keyer.poll(released + 2 * unit_us));
+    TEST_ASSERT_EQUAL(MorseKeyer::WORD_BREAK,
+                      keyer.poll(released + 5 * unit_us));
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_classifies_against_initial_unit);
+    RUN_TEST(test_release_without_press_is_ignored);
+    RUN_TEST(test_reports_letter_then_word_break_once);
+    RUN_TEST(test_next_break_delay);
+    RUN_TEST(test_cancel_drops_pending_breaks);
+    RUN_TEST(test_adapts_to_faster_keying);
+    RUN_TEST(test_held_key_does_not_change_unit);
+    RUN_TEST(test_unit_is_clamped);
+    RUN_TEST(test_adapts_to_slower_keying);
+    RUN_TEST(test_breaks_follow_the_adapted_unit);
+    return UNITY_END();
+}
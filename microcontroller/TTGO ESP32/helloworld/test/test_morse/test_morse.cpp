@@ -0,0 +1,123 @@
+#include <string.h>
+#include <unity.h>
+
+#include "morse.hpp"
+
+
+/**
+ * The tables the decoder searched before the lookup table: the letters and
+ * their elements, compared one by one.
+ */
+static const int NUM_CHAR = 26;
+static const char* const LEGACY_MORSE[NUM_CHAR] = {
+    ".-", "-...", "-.-.", "-..", ".", "..-.", "--.", "....",
+    "..", ".---", "-.-", ".-..", "--", "-.", "---", ".--.", "--.-",
+    ".-.", "...", "-", "..-", "...-", ".--", "-..-", "-.--", "--.."
+};
+static const char* const LEGACY_LETTER[NUM_CHAR] = {
+    "A", "B", "C", "D", "E", "F", "G", "H",
+    "I", "J", "K", "L", "M", "N", "O", "P", "Q",
+    "R", "S", "T", "U", "V", "W", "X", "Y", "Z"
+};
+
+
+/**
+ * Decodes the elements as decodeMessage() did, returning NULL where it showed
+ * INVALID.
+ */
+static const char* legacyDecode(const char* elements)
+{
+    for (int i = 0; i < NUM_CHAR; i++)
+    {
+        if (strcmp(elements, LEGACY_MORSE[i]) == 0)
+        {
+            return LEGACY_LETTER[i];
+        }
+    }
+    return NULL;
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_letters_decode_as_before()
+{
+    for (int i = 0; i < NUM_CHAR; i++)
+    {
+        morse_code_t code = morseFromString(LEGACY_MORSE[i]);
+        TEST_ASSERT_NOT_EQUAL(MORSE_INVALID, code);
+        TEST_ASSERT_EQUAL_STRING(LEGACY_LETTER[i], morseDecode(code));
+    }
+}
+
+
+void test_letters_encode_as_before()
+{
+    char elements[MORSE_MAX_ELEMENTS + 1];
+    for (int i = 0; i < NUM_CHAR; i++)
+    {
+        char letter = LEGACY_LETTER[i][0];
+        morseToString(morseEncode(letter), elements, sizeof(elements));
+        TEST_ASSERT_EQUAL_STRING(LEGACY_MORSE[i], elements);
+        morseToString(morseEncode(letter - 'A' + 'a'), elements,
+                      sizeof(elements));
+        TEST_ASSERT_EQUAL_STRING(LEGACY_MORSE[i], elements);
+    }
+}
+
+
+/*
+ * Every code of up to MORSE_MAX_ELEMENTS elements decodes to the letter it
+ * decoded to before. Codes that were INVALID before decode to nothing or to
+ * a symbol the old table did not have, never to a letter.
+ */
+void test_every_code_agrees_with_legacy_decoder()
+{
+    char elements[MORSE_MAX_ELEMENTS + 1];
+    for (morse_code_t code = MORSE_EMPTY + 1; code < MORSE_TABLE_SIZE; code++)
+    {
+        morseToString(code, elements, sizeof(elements));
+        TEST_ASSERT_EQUAL(code, morseFromString(elements));
+
+        const char* legacy = legacyDecode(elements);
+        const char* text = morseDecode(code);
+        if (legacy != NULL)
+        {
+            TEST_ASSERT_EQUAL_STRING(legacy, text);
+        }
+        else if (text != NULL)
+        {
+            TEST_ASSERT_FALSE(text[1] == '\0' && text[0] >= 'A' &&
+                              text[0] <= 'Z');
+        }
+    }
+}
+
+
+void test_rejects_empty_invalid_and_overlong()
+{
+    TEST_ASSERT_NULL(morseDecode(MORSE_EMPTY));
+    TEST_ASSERT_NULL(morseDecode(MORSE_INVALID));
+    TEST_ASSERT_EQUAL(MORSE_INVALID, morseFromString(".-x"));
+    TEST_ASSERT_EQUAL(MORSE_INVALID, morseFromString(".........."));
+    TEST_ASSERT_EQUAL(MORSE_INVALID, morseEncode(' '));
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_letters_decode_as_before);
+    RUN_TEST(test_letters_encode_as_before);
+    RUN_TEST(test_every_code_agrees_with_legacy_decoder);
+    RUN_TEST(test_rejects_empty_invalid_and_overlong);
+    return UNITY_END();
+}
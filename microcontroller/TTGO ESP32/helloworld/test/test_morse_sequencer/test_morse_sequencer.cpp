@@ -0,0 +1,153 @@
+#include <unity.h>
+
+#include <string>
+
+#include "morse_sequencer.hpp"
+
+
+/**
+ * Plays the rest of the text of the sequencer, writing each unit the key is
+ * on as '=' and each unit it is off as '.', so "AE" is "=.===...=".
+ */
+static std::string play(MorseSequencer& sequencer)
+{
+    std::string units;
+    MorseSequencer::morse_step step;
+    while (sequencer.next(step))
+    {
+        TEST_ASSERT_TRUE(step.units > 0);
+        units.append(step.units, step.on ? '=' : '.');
+    }
+    return units;
+}
+
+
+/**
+ * Checks the units the text plays as.
+ */
+static void assertPlays(const char* expected, const char* text)
+{
+    MorseSequencer sequencer;
+    sequencer.start(text);
+    std::string units = play(sequencer);
+    TEST_ASSERT_EQUAL_STRING(expected, units.c_str());
+    TEST_ASSERT_FALSE(sequencer.isPlaying());
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_times_elements_letters_and_words()
+{
+    // One unit between elements, three between letters, seven between words
+    assertPlays("=.===", "A");
+    assertPlays("===.=.=", "D");
+    assertPlays("=.===...=", "AE");
+    assertPlays("=.......=", "E E");
+    assertPlays("===.===.===...=.===.=...=", "ORE");
+    assertPlays("=.=.=...===.......===.===.===", "ST O");
+}
+
+
+void test_lower_case_plays_as_upper_case()
+{
+    assertPlays("=.=.=...===.===.===...=.=.=", "sos");
+}
+
+
+void test_leading_and_trailing_spaces_play_nothing()
+{
+    // The sequence starts with the first element and ends with the last
+    assertPlays("=.......=", "  E E  ");
+    assertPlays("", "   ");
+    assertPlays("", "");
+}
+
+
+void test_skips_characters_without_symbol()
+{
+    // A skipped character between letters makes a word gap, as a space does
+    assertPlays("=.......=", "E#E");
+    assertPlays("=.......=", "E # ~E");
+    assertPlays("=", "#E~");
+    assertPlays("", "#~");
+}
+
+
+void test_last_step_is_an_element()
+{
+    MorseSequencer sequencer;
+    sequencer.start("TE ");
+    MorseSequencer::morse_step step;
+    MorseSequencer::morse_step last = {false, 0};
+    while (sequencer.next(step))
+    {
+        last = step;
+    }
+    TEST_ASSERT_TRUE(last.on);
+    TEST_ASSERT_EQUAL(1, last.units);
+}
+
+
+void test_stop_drops_the_rest()
+{
+    MorseSequencer sequencer;
+    sequencer.start("EE");
+    MorseSequencer::morse_step step;
+    TEST_ASSERT_TRUE(sequencer.next(step));
+    TEST_ASSERT_TRUE(sequencer.isPlaying());
+
+    // Not even the gap after the element that was played is left
+    sequencer.stop();
+    TEST_ASSERT_FALSE(sequencer.isPlaying());
+    TEST_ASSERT_FALSE(sequencer.next(step));
+}
+
+
+void test_start_replaces_the_text()
+{
+    MorseSequencer sequencer;
+    sequencer.start("SOS");
+    MorseSequencer::morse_step step;
+    sequencer.next(step);
+    sequencer.next(step);
+
+    sequencer.start("T");
+    std::string units = play(sequencer);
+    TEST_ASSERT_EQUAL_STRING("===", units.c_str());
+}
+
+
+void test_truncates_long_text()
+{
+    std::string text(MorseSequencer::CAPACITY + 10, 'E');
+    MorseSequencer sequencer;
+    sequencer.start(text.c_str());
+    std::string units = play(sequencer);
+
+    // Each E but the last plays as "=..."
+    TEST_ASSERT_EQUAL(4 * MorseSequencer::CAPACITY - 3, units.size());
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_times_elements_letters_and_words);
+    RUN_TEST(test_lower_case_plays_as_upper_case);
+    RUN_TEST(test_leading_and_trailing_spaces_play_nothing);
+    RUN_TEST(test_skips_characters_without_symbol);
+    RUN_TEST(test_last_step_is_an_element);
+    RUN_TEST(test_stop_drops_the_rest);
+    RUN_TEST(test_start_replaces_the_text);
+    RUN_TEST(test_truncates_long_text);
+    return UNITY_END();
+}
@@ -0,0 +1,157 @@
+#include <unity.h>
+
+#include <host.hpp>
+#include <loopback_server.hpp>
+
+#include "network.hpp"
+
+
+static const char* const COUNT_PATH = "/api/device/message/pending/count";
+static const char* const SEND_PATH = "/api/device/message/receive";
+static const char* const REGISTER_PATH = "/api/device/register";
+
+
+/**
+ * Answers every request, except that the request made on the first
+ * connection after `answered` others is met with a close, as a server does
+ * that times out an idle connection just as a request arrives.
+ */
+struct ClosingServer {
+    unsigned long answered = 1000;
+    unsigned long requests = 0;
+    std::string last_path;
+
+    std::string operator()(const LoopbackServer::request& request)
+    {
+        last_path = request.path;
+        if (request.connection == 1 && requests++ == answered)
+        {
+            return "";
+        }
+        if (request.path == COUNT_PATH)
+        {
+            return LoopbackServer::respond(200, "application/json",
+                                           "{\"count\": 3, \"pending\": 3}");
+        }
+        return LoopbackServer::respond(200, "application/json",
+                                       "{\"pending\": 3}");
+    }
+};
+
+
+static ClosingServer* behaviour;
+static LoopbackServer* server;
+static ApplicationNetworkClient* client;
+
+
+void setUp()
+{
+    behaviour = new ClosingServer();
+    server = new LoopbackServer([](const LoopbackServer::request& request) {
+        return (*behaviour)(request);
+    });
+    TEST_ASSERT_TRUE(server->begin());
+    client = new ApplicationNetworkClient("127.0.0.1", server->getPort());
+}
+
+
+void tearDown()
+{
+    delete client;
+    server->end();
+    delete server;
+    delete behaviour;
+}
+
+
+void test_reads_status_and_body()
+{
+    TEST_ASSERT_EQUAL(3, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(200, client->getLastStatusCode());
+    TEST_ASSERT_EQUAL(3, client->getPendingCount());
+}
+
+
+void test_reuses_connection()
+{
+    unsigned long connects = hostGetSocketStats().connects;
+    client->countPendingMessages();
+    client->countPendingMessages();
+    TEST_ASSERT_TRUE(client->sendMessage("HI"));
+
+    TEST_ASSERT_EQUAL(1, hostGetSocketStats().connects - connects);
+    TEST_ASSERT_EQUAL(3, client->getConnectionStats().requests);
+    TEST_ASSERT_EQUAL(2, client->getConnectionStats().reused);
+}
+
+
+void test_message_closed_without_answer_is_not_sent_again()
+{
+    behaviour->answered = 1;
+    client->makeVisible();
+    TEST_ASSERT_FALSE(client->sendMessage("HI"));
+
+    // The server got the message once; the outbox decides whether to retry
+    TEST_ASSERT_EQUAL(2, server->getRequests());
+    TEST_ASSERT_EQUAL(-1, client->getLastStatusCode());
+    TEST_ASSERT_EQUAL(1, client->getConnectionStats().failures);
+}
+
+
+void test_batch_closed_without_answer_is_not_sent_again()
+{
+    behaviour->answered = 1;
+    client->makeVisible();
+    const char* messages[] = {"HI", "THERE"};
+    unsigned long ages[] = {100, 50};
+    TEST_ASSERT_EQUAL(0, client->sendMessages(messages, ages, 2));
+    TEST_ASSERT_EQUAL(2, server->getRequests());
+}
+
+
+void test_idempotent_request_is_sent_again()
+{
+    behaviour->answered = 1;
+    client->makeVisible();
+    TEST_ASSERT_EQUAL(3, client->countPendingMessages());
+
+    TEST_ASSERT_EQUAL(3, server->getRequests());
+    TEST_ASSERT_EQUAL_STRING(COUNT_PATH, behaviour->last_path.c_str());
+    TEST_ASSERT_EQUAL(200, client->getLastStatusCode());
+    TEST_ASSERT_EQUAL(0, client->getConnectionStats().failures);
+}
+
+
+void test_register_is_sent_again()
+{
+    behaviour->answered = 1;
+    client->countPendingMessages();
+    client->makeVisible();
+
+    TEST_ASSERT_EQUAL(3, server->getRequests());
+    TEST_ASSERT_EQUAL_STRING(REGISTER_PATH, behaviour->last_path.c_str());
+    TEST_ASSERT_EQUAL(200, client->getLastStatusCode());
+}
+
+
+void test_request_on_new_connection_is_not_sent_again()
+{
+    // Only a reused connection can have gone stale
+    behaviour->answered = 0;
+    TEST_ASSERT_EQUAL(0, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(1, server->getRequests());
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_reads_status_and_body);
+    RUN_TEST(test_reuses_connection);
+    RUN_TEST(test_message_closed_without_answer_is_not_sent_again);
+    RUN_TEST(test_batch_closed_without_answer_is_not_sent_again);
+    RUN_TEST(test_idempotent_request_is_sent_again);
+    RUN_TEST(test_register_is_sent_again);
+    RUN_TEST(test_request_on_new_connection_is_not_sent_again);
+    return UNITY_END();
+}
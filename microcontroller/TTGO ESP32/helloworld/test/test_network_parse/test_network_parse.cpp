@@ -0,0 +1,248 @@
+#include <unity.h>
+
+#include <loopback_server.hpp>
+
+#include "network.hpp"
+
+
+static const char* const FETCH_PATH = "/api/device/message/pending/get";
+static const char* const COUNT_PATH = "/api/device/message/pending/count";
+
+
+/**
+ * A message of the response, with the fields the server sends.
+ */
+static std::string message(int i)
+{
+    return "{\"macAddress\": \"24:0A:C4:00:00:0" + std::to_string(i) + "\", "
+           "\"content\": \"MESSAGE " + std::to_string(i) + "\", "
+           "\"time\": \"Sat, 14 May 2022 10:00:0" + std::to_string(i) +
+           " GMT\"}";
+}
+
+
+/**
+ * A response body with the messages numbered from 1 up to the count.
+ */
+static std::string messages(int count, int pending)
+{
+    std::string body = "{\"messages\": [";
+    for (int i = 1; i <= count; i++)
+    {
+        body += (i > 1 ? ", " : "") + message(i);
+    }
+    return body + "], \"pending\": " + std::to_string(pending) + "}";
+}
+
+
+static std::string body;
+static int status;
+static LoopbackServer* server;
+static ApplicationNetworkClient* client;
+static ApplicationNetworkClient::message_map fetched[4];
+
+
+void setUp()
+{
+    body = "";
+    status = 200;
+    server = new LoopbackServer([](const LoopbackServer::request& request) {
+        if (request.path != FETCH_PATH && request.path != COUNT_PATH)
+        {
+            return LoopbackServer::respond(404, "text/html", "");
+        }
+        return LoopbackServer::respond(status, "application/json", body);
+    });
+    TEST_ASSERT_TRUE(server->begin());
+    client = new ApplicationNetworkClient("127.0.0.1", server->getPort());
+    for (ApplicationNetworkClient::message_map& m : fetched)
+    {
+        m = ApplicationNetworkClient::message_map();
+    }
+}
+
+
+void tearDown()
+{
+    delete client;
+    server->end();
+    delete server;
+}
+
+
+void test_reads_messages_and_pending()
+{
+    body = messages(2, 5);
+    TEST_ASSERT_EQUAL(2, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL_STRING("24:0A:C4:00:00:01", fetched[0].macAddress.c_str());
+    TEST_ASSERT_EQUAL_STRING("MESSAGE 1", fetched[0].content.c_str());
+    TEST_ASSERT_EQUAL_STRING("Sat, 14 May 2022 10:00:01 GMT",
+                             fetched[0].time.c_str());
+    TEST_ASSERT_EQUAL_STRING("MESSAGE 2", fetched[1].content.c_str());
+    TEST_ASSERT_EQUAL(5, client->getPendingCount());
+}
+
+
+void test_skips_unknown_fields_of_any_type()
+{
+    body = "{\"server\": {\"version\": [1, 2, {\"x\": \"]}\"}]}, "
+           "\"pending\": 1, \"flag\": true, \"none\": null, \"ratio\": -0.5, "
+           "\"messages\": [{\"id\": 7, \"content\": \"HI\", "
+           "\"extra\": {\"nested\": [\"a\", \"b\"]}, "
+           "\"macAddress\": \"24:0A:C4:00:00:09\", \"time\": \"now\"}]}";
+    TEST_ASSERT_EQUAL(1, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL_STRING("HI", fetched[0].content.c_str());
+    TEST_ASSERT_EQUAL_STRING("24:0A:C4:00:00:09", fetched[0].macAddress.c_str());
+    TEST_ASSERT_EQUAL_STRING("now", fetched[0].time.c_str());
+    TEST_ASSERT_EQUAL(1, client->getPendingCount());
+}
+
+
+void test_keeps_escaped_quotes_in_content()
+{
+    body = "{\"messages\": [{\"content\": \"SAY \\\"HI\\\"\", "
+           "\"macAddress\": \"m\", \"time\": \"t\"}], \"pending\": 0}";
+    TEST_ASSERT_EQUAL(1, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL_STRING("SAY \"HI\"", fetched[0].content.c_str());
+}
+
+
+/*
+ * Messages beyond the capacity are read past without being stored, and the
+ * pending count after them is still picked up.
+ */
+void test_skips_messages_beyond_capacity()
+{
+    body = messages(9, 12);
+    TEST_ASSERT_EQUAL(4, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL_STRING("MESSAGE 4", fetched[3].content.c_str());
+    TEST_ASSERT_EQUAL(12, client->getPendingCount());
+
+    // The whole body was read, so the connection carries the next request
+    unsigned long reconnects = client->getConnectionStats().reconnects;
+    body = messages(1, 11);
+    TEST_ASSERT_EQUAL(1, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL(reconnects, client->getConnectionStats().reconnects);
+}
+
+
+void test_reads_empty_list()
+{
+    body = "{\"messages\": [], \"pending\": 0}";
+    TEST_ASSERT_EQUAL(0, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL(0, client->getPendingCount());
+
+    body = "{}";
+    TEST_ASSERT_EQUAL(0, client->fetchPendingMessages(fetched, 4));
+}
+
+
+/*
+ * The messages read before the error are kept, the pending count is not
+ * trusted, and the connection is closed since its position in the body is
+ * unknown.
+ */
+void test_stops_at_malformed_body()
+{
+    body = "{\"messages\": [" + message(1) + " " + message(2) +
+           "], \"pending\": 3}";
+    TEST_ASSERT_EQUAL(1, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL_STRING("MESSAGE 1", fetched[0].content.c_str());
+    TEST_ASSERT_EQUAL(-1, client->getPendingCount());
+
+    unsigned long reconnects = client->getConnectionStats().reconnects;
+    body = messages(1, 0);
+    TEST_ASSERT_EQUAL(1, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL(reconnects + 1, client->getConnectionStats().reconnects);
+}
+
+
+void test_rejects_truncated_and_non_object_bodies()
+{
+    const char* const bodies[] = {
+        "", "[]", "\"messages\"", "{\"messages\": [{\"content\": \"HI\"",
+        "{\"messages\": {}}", "{\"pending\": x}", "{\"messages\" []}",
+    };
+    for (const char* text : bodies)
+    {
+        body = text;
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, client->fetchPendingMessages(fetched, 4),
+                                      text);
+    }
+    TEST_ASSERT_EQUAL(-1, client->getPendingCount());
+}
+
+
+void test_ignores_body_of_error_status()
+{
+    status = 500;
+    body = messages(2, 2);
+    TEST_ASSERT_EQUAL(0, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL(500, client->getLastStatusCode());
+    TEST_ASSERT_EQUAL(-1, client->getPendingCount());
+    TEST_ASSERT_TRUE(fetched[0].content.isEmpty());
+}
+
+
+/*
+ * Whatever the parser leaves of the body is drained, so the connection stays
+ * in step for the next request.
+ */
+void test_drains_rest_of_body()
+{
+    body = messages(1, 0) + "  \r\n\r\n";
+    TEST_ASSERT_EQUAL(1, client->fetchPendingMessages(fetched, 4));
+    unsigned long reconnects = client->getConnectionStats().reconnects;
+
+    body = messages(2, 0);
+    TEST_ASSERT_EQUAL(2, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL(reconnects, client->getConnectionStats().reconnects);
+}
+
+
+void test_reads_count_from_stream()
+{
+    body = "{\"server\": {\"version\": [1, \"}\"]}, \"count\": 3, "
+           "\"pending\": 3}";
+    TEST_ASSERT_EQUAL(3, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(3, client->getPendingCount());
+
+    // The count carries the next request on the same connection
+    unsigned long reconnects = client->getConnectionStats().reconnects;
+    body = "{\"pending\": 0, \"count\": 0}";
+    TEST_ASSERT_EQUAL(0, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(0, client->getPendingCount());
+    TEST_ASSERT_EQUAL(reconnects, client->getConnectionStats().reconnects);
+}
+
+
+void test_malformed_count_closes_connection()
+{
+    body = "{\"count\": 2, \"pending\": 2}";
+    client->countPendingMessages();
+    unsigned long reconnects = client->getConnectionStats().reconnects;
+
+    body = "{\"count\": 4 \"pending\": 4}";
+    client->countPendingMessages();
+    body = "{\"count\": 1, \"pending\": 1}";
+    TEST_ASSERT_EQUAL(1, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(reconnects + 1, client->getConnectionStats().reconnects);
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_reads_messages_and_pending);
+    RUN_TEST(test_skips_unknown_fields_of_any_type);
+    RUN_TEST(test_keeps_escaped_quotes_in_content);
+    RUN_TEST(test_skips_messages_beyond_capacity);
+    RUN_TEST(test_reads_empty_list);
+    RUN_TEST(test_stops_at_malformed_body);
+    RUN_TEST(test_rejects_truncated_and_non_object_bodies);
+    RUN_TEST(test_ignores_body_of_error_status);
+    RUN_TEST(test_drains_rest_of_body);
+    RUN_TEST(test_reads_count_from_stream);
+    RUN_TEST(test_malformed_count_closes_connection);
+    return UNITY_END();
+}
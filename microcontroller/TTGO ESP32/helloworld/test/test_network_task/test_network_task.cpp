@@ -0,0 +1,240 @@
+#include <unity.h>
+
+#include <mutex>
+#include <vector>
+
+#include <host.hpp>
+#include <loopback_server.hpp>
+
+#include "network_task.hpp"
+
+
+static const char* const SEND_PATH = "/api/device/message/receive";
+static const char* const BATCH_PATH = "/api/device/message/receive/batch";
+
+
+/**
+ * Answers message requests with the status set for their route and records
+ * them, in order.
+ */
+struct MessageServer {
+    int send_status = 200;
+    int batch_status = 200;
+    std::mutex mutex;
+    std::vector<LoopbackServer::request> requests;
+
+    std::string operator()(const LoopbackServer::request& request)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        requests.push_back(request);
+        int status = request.path == BATCH_PATH ? batch_status : send_status;
+        return LoopbackServer::respond(status, "application/json",
+                                       "{\"pending\": 0}");
+    }
+
+    std::vector<LoopbackServer::request> getRequests()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return requests;
+    }
+};
+
+
+static MessageServer* behaviour;
+static LoopbackServer* server;
+static NetworkTask* task;
+
+
+void setUp()
+{
+    behaviour = new MessageServer();
+    server = new LoopbackServer([](const LoopbackServer::request& request) {
+        return (*behaviour)(request);
+    });
+    TEST_ASSERT_TRUE(server->begin());
+
+    // A task runs until the program ends, so what it uses is never freed
+    ApplicationNetworkClient* client =
+        new ApplicationNetworkClient("127.0.0.1", server->getPort());
+    MemoryOutboxStorage* storage = new MemoryOutboxStorage();
+    Outbox* outbox = new Outbox(*storage);
+    TEST_ASSERT_TRUE(outbox->begin(millis()));
+    task = new NetworkTask(*client, *outbox);
+}
+
+
+void tearDown()
+{
+    server->end();
+    delete server;
+    delete behaviour;
+}
+
+
+/**
+ * Waits up to the timeout for the next completion.
+ */
+static bool waitForCompletion(NetworkTask::network_completion& completion,
+                              unsigned long timeout_ms = 1000)
+{
+    unsigned long start = millis();
+    while (!task->poll(completion))
+    {
+        if (millis() - start > timeout_ms)
+        {
+            return false;
+        }
+        delay(1);
+    }
+    return true;
+}
+
+
+static size_t countRequests(const char* path)
+{
+    size_t count = 0;
+    for (const LoopbackServer::request& request : behaviour->getRequests())
+    {
+        if (request.path == path)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+
+void test_queued_message_is_reported_sent_with_its_batch()
+{
+    task->setBatching(4, 200);
+    TEST_ASSERT_TRUE(task->begin());
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "HI"));
+
+    NetworkTask::network_completion completion;
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_EQUAL(NetworkTask::SEND, completion.type);
+    TEST_ASSERT_EQUAL(1, completion.count);
+    TEST_ASSERT_EQUAL(0, countRequests(BATCH_PATH));
+
+    // The batch goes out once the latency has passed, and says so
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_EQUAL(NetworkTask::SEND, completion.type);
+    TEST_ASSERT_EQUAL(0, completion.count);
+    TEST_ASSERT_EQUAL(0, completion.pending);
+    TEST_ASSERT_EQUAL(1, countRequests(BATCH_PATH));
+}
+
+
+void test_full_batch_is_reported_sent()
+{
+    task->setBatching(2, 10000);
+    TEST_ASSERT_TRUE(task->begin());
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "A"));
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "B"));
+
+    NetworkTask::network_completion completion;
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_EQUAL(1, completion.count);
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_EQUAL(0, completion.count);
+    TEST_ASSERT_EQUAL(1, countRequests(BATCH_PATH));
+
+    // Nothing is left to report
+    TEST_ASSERT_FALSE(waitForCompletion(completion, 100));
+}
+
+
+void test_missing_batch_route_falls_back_to_single_sends()
+{
+    behaviour->batch_status = 404;
+    task->setBatching(2, 10000);
+    TEST_ASSERT_TRUE(task->begin());
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "A"));
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "B"));
+
+    NetworkTask::network_completion completion;
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_EQUAL(0, completion.count);
+
+    std::vector<LoopbackServer::request> requests = behaviour->getRequests();
+    TEST_ASSERT_EQUAL(3, requests.size());
+    TEST_ASSERT_TRUE(requests[0].path == BATCH_PATH);
+    TEST_ASSERT_TRUE(requests[1].path == SEND_PATH);
+    TEST_ASSERT_TRUE(requests[1].body.find("message=A") != std::string::npos);
+    TEST_ASSERT_TRUE(requests[2].path == SEND_PATH);
+    TEST_ASSERT_TRUE(requests[2].body.find("message=B") != std::string::npos);
+
+    // The batch route is not tried again
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "C"));
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "D"));
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_EQUAL(0, completion.count);
+    TEST_ASSERT_EQUAL(1, countRequests(BATCH_PATH));
+    TEST_ASSERT_EQUAL(4, countRequests(SEND_PATH));
+}
+
+
+void test_missing_routes_keep_messages()
+{
+    behaviour->batch_status = 404;
+    behaviour->send_status = 404;
+    task->setBatching(2, 10000);
+    TEST_ASSERT_TRUE(task->begin());
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "A"));
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "B"));
+
+    NetworkTask::network_completion completion;
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_EQUAL(2, completion.count);
+}
+
+
+void test_rejected_batch_is_dropped()
+{
+    behaviour->batch_status = 400;
+    task->setBatching(2, 10000);
+    TEST_ASSERT_TRUE(task->begin());
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "A"));
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "B"));
+
+    NetworkTask::network_completion completion;
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_EQUAL(0, completion.count);
+    TEST_ASSERT_EQUAL(0, countRequests(SEND_PATH));
+}
+
+
+void test_failed_batch_is_kept()
+{
+    behaviour->batch_status = 500;
+    task->setBatching(2, 10000);
+    TEST_ASSERT_TRUE(task->begin());
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "A"));
+    TEST_ASSERT_TRUE(task->submit(NetworkTask::SEND, 0, "B"));
+
+    NetworkTask::network_completion completion;
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_TRUE(waitForCompletion(completion));
+    TEST_ASSERT_EQUAL(2, completion.count);
+    TEST_ASSERT_EQUAL(0, countRequests(SEND_PATH));
+
+    // A failed retry is not reported
+    TEST_ASSERT_FALSE(waitForCompletion(completion, 100));
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_queued_message_is_reported_sent_with_its_batch);
+    RUN_TEST(test_full_batch_is_reported_sent);
+    RUN_TEST(test_missing_batch_route_falls_back_to_single_sends);
+    RUN_TEST(test_missing_routes_keep_messages);
+    RUN_TEST(test_rejected_batch_is_dropped);
+    RUN_TEST(test_failed_batch_is_kept);
+    return UNITY_END();
+}
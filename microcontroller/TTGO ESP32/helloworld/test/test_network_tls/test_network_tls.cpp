@@ -0,0 +1,270 @@
+#include <unity.h>
+
+#include <WiFiClientSecure.h>
+#include <loopback_server.hpp>
+
+#include <openssl/pem.h>
+#include <openssl/x509v3.h>
+
+#include "network.hpp"
+
+
+static const char* const FETCH_PATH = "/api/device/message/pending/get";
+static const char* const COUNT_PATH = "/api/device/message/pending/count";
+
+
+/**
+ * A CA and a certificate it signed for 127.0.0.1, with the key of each, in
+ * PEM form as the device is given them.
+ */
+struct authority {
+    std::string ca;
+    std::string certificate;
+    std::string key;
+};
+
+
+static std::string toPem(X509* certificate)
+{
+    BIO* bio = BIO_new(BIO_s_mem());
+    PEM_write_bio_X509(bio, certificate);
+    char* data;
+    long length = BIO_get_mem_data(bio, &data);
+    std::string pem(data, length);
+    BIO_free(bio);
+    return pem;
+}
+
+
+static std::string toPem(EVP_PKEY* key)
+{
+    BIO* bio = BIO_new(BIO_s_mem());
+    PEM_write_bio_PrivateKey(bio, key, NULL, NULL, 0, NULL, NULL);
+    char* data;
+    long length = BIO_get_mem_data(bio, &data);
+    std::string pem(data, length);
+    BIO_free(bio);
+    return pem;
+}
+
+
+/**
+ * Returns a certificate for the key, valid for a day and signed by the
+ * issuer, or self-signed if the issuer is NULL.
+ */
+static X509* makeCertificate(const char* name, EVP_PKEY* key,
+                             X509* issuer, EVP_PKEY* issuer_key)
+{
+    X509* certificate = X509_new();
+    X509_set_version(certificate, 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(certificate),
+                     issuer == NULL ? 1 : 2);
+    X509_gmtime_adj(X509_getm_notBefore(certificate), -60);
+    X509_gmtime_adj(X509_getm_notAfter(certificate), 86400);
+    X509_set_pubkey(certificate, key);
+    X509_NAME_add_entry_by_txt(X509_get_subject_name(certificate), "CN",
+                               MBSTRING_ASC, (const unsigned char*)name, -1,
+                               -1, 0);
+    X509_set_issuer_name(certificate, issuer == NULL ?
+        X509_get_subject_name(certificate) : X509_get_subject_name(issuer));
+
+    X509V3_CTX context;
+    X509V3_set_ctx_nodb(&context);
+    X509V3_set_ctx(&context, issuer == NULL ? certificate : issuer, certificate,
+                   NULL, NULL, 0);
+    const char* constraints = issuer == NULL ? "critical,CA:TRUE" : "CA:FALSE";
+    X509_EXTENSION* extension = X509V3_EXT_conf_nid(
+        NULL, &context, NID_basic_constraints, constraints);
+    X509_add_ext(certificate, extension, -1);
+    X509_EXTENSION_free(extension);
+    if (issuer != NULL)
+    {
+        extension = X509V3_EXT_conf_nid(NULL, &context, NID_subject_alt_name,
+                                        "IP:127.0.0.1");
+        X509_add_ext(certificate, extension, -1);
+        X509_EXTENSION_free(extension);
+    }
+
+    X509_sign(certificate, issuer_key, EVP_sha256());
+    return certificate;
+}
+
+
+/**
+ * Makes a new CA and a server certificate it signed.
+ */
+static authority makeAuthority()
+{
+    EVP_PKEY* ca_key = EVP_EC_gen("P-256");
+    X509* ca = makeCertificate("Test CA", ca_key, NULL, ca_key);
+    EVP_PKEY* key = EVP_EC_gen("P-256");
+    X509* certificate = makeCertificate("127.0.0.1", key, ca, ca_key);
+
+    authority made = {toPem(ca), toPem(certificate), toPem(key)};
+    X509_free(certificate);
+    X509_free(ca);
+    EVP_PKEY_free(key);
+    EVP_PKEY_free(ca_key);
+    return made;
+}
+
+
+/**
+ * A response body with the messages, padded between them so the body spans
+ * several TLS records and reads.
+ */
+static std::string messages(int count, size_t padding)
+{
+    std::string body = "{\"messages\": [";
+    for (int i = 1; i <= count; i++)
+    {
+        body += (i > 1 ? "," + std::string(padding, ' ') : "") +
+                "{\"macAddress\": \"24:0A:C4:00:00:0" + std::to_string(i) +
+                "\", \"content\": \"MESSAGE " + std::to_string(i) +
+                "\", \"time\": \"now\"}";
+    }
+    return body + "], \"pending\": 0}";
+}
+
+
+static authority issued;
+static authority other;
+static std::string body;
+static bool closing;
+static LoopbackServer* server;
+static ApplicationNetworkClient* client;
+static ApplicationNetworkClient::message_map fetched[4];
+
+
+/**
+ * Returns the number of handshakes the client has paid for.
+ */
+static unsigned long handshakes()
+{
+    return static_cast<WiFiClientSecure&>(client->getWifiClient())
+        .getHandshakes();
+}
+
+
+void setUp()
+{
+    body = "";
+    closing = false;
+    server = new LoopbackServer([](const LoopbackServer::request& request) {
+        if (request.path == FETCH_PATH)
+        {
+            return LoopbackServer::respond(200, "application/json", body,
+                                           closing);
+        }
+        if (request.path == COUNT_PATH)
+        {
+            return LoopbackServer::respond(200, "application/json",
+                                           "{\"count\": 3, \"pending\": 3}",
+                                           closing);
+        }
+        return LoopbackServer::respond(404, "text/html", "", closing);
+    });
+    TEST_ASSERT_TRUE(server->beginSecure(issued.certificate, issued.key));
+    client = new ApplicationNetworkClient("127.0.0.1", server->getPort());
+    for (ApplicationNetworkClient::message_map& m : fetched)
+    {
+        m = ApplicationNetworkClient::message_map();
+    }
+}
+
+
+void tearDown()
+{
+    delete client;
+    server->end();
+    delete server;
+}
+
+
+void test_verified_request()
+{
+    client->setSecure(issued.ca.c_str());
+    TEST_ASSERT_TRUE(client->isSecure());
+    TEST_ASSERT_EQUAL(3, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(200, client->getLastStatusCode());
+    TEST_ASSERT_EQUAL(1, handshakes());
+}
+
+
+void test_keep_alive_pays_one_handshake()
+{
+    client->setSecure(issued.ca.c_str());
+    for (int request = 0; request < 5; request++)
+    {
+        TEST_ASSERT_EQUAL(3, client->countPendingMessages());
+    }
+    TEST_ASSERT_EQUAL(1, handshakes());
+    TEST_ASSERT_EQUAL(4, client->getConnectionStats().reused);
+
+    client->setKeepAlive(false);
+    client->countPendingMessages();
+    client->countPendingMessages();
+    TEST_ASSERT_EQUAL(3, handshakes());
+}
+
+
+void test_unknown_ca_is_refused()
+{
+    client->setSecure(other.ca.c_str());
+    TEST_ASSERT_EQUAL(0, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(-1, client->getLastStatusCode());
+    TEST_ASSERT_EQUAL(0, server->getRequests());
+    TEST_ASSERT_EQUAL(0, handshakes());
+}
+
+
+void test_insecure_accepts_any_certificate()
+{
+    client->setSecure(NULL);
+    TEST_ASSERT_EQUAL(3, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(1, handshakes());
+}
+
+
+void test_fetches_body_spanning_records()
+{
+    client->setSecure(issued.ca.c_str());
+    body = messages(4, 20000);
+    TEST_ASSERT_EQUAL(4, client->fetchPendingMessages(fetched, 4));
+    TEST_ASSERT_EQUAL_STRING("MESSAGE 1", fetched[0].content.c_str());
+    TEST_ASSERT_EQUAL_STRING("MESSAGE 4", fetched[3].content.c_str());
+    TEST_ASSERT_EQUAL(0, client->getPendingCount());
+
+    // The whole body was read, so the connection is still usable
+    TEST_ASSERT_EQUAL(3, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(1, handshakes());
+}
+
+
+void test_reconnects_after_server_closes()
+{
+    client->setSecure(issued.ca.c_str());
+    closing = true;
+    TEST_ASSERT_EQUAL(3, client->countPendingMessages());
+    closing = false;
+    TEST_ASSERT_EQUAL(3, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(3, client->countPendingMessages());
+    TEST_ASSERT_EQUAL(2, handshakes());
+    TEST_ASSERT_EQUAL(0, client->getConnectionStats().failures);
+}
+
+
+int main(int argc, char** argv)
+{
+    issued = makeAuthority();
+    other = makeAuthority();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_verified_request);
+    RUN_TEST(test_keep_alive_pays_one_handshake);
+    RUN_TEST(test_unknown_ca_is_refused);
+    RUN_TEST(test_insecure_accepts_any_certificate);
+    RUN_TEST(test_fetches_body_spanning_records);
+    RUN_TEST(test_reconnects_after_server_closes);
+    return UNITY_END();
+}
@@ -0,0 +1,309 @@
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#include <string>
+
+#include "outbox.hpp"
+
+
+/**
+ * Memory storage that counts the writes, which wear the flash on the device.
+ */
+class CountingStorage : public MemoryOutboxStorage
+{
+public:
+    size_t counter_writes = 0;
+    size_t slot_writes = 0;
+
+    bool writeHead(uint32_t head) override
+    {
+        counter_writes++;
+        return MemoryOutboxStorage::writeHead(head);
+    }
+
+    bool writeTail(uint32_t tail) override
+    {
+        counter_writes++;
+        return MemoryOutboxStorage::writeTail(tail);
+    }
+
+    bool writeSlot(size_t slot, const char* message) override
+    {
+        slot_writes++;
+        return MemoryOutboxStorage::writeSlot(slot, message);
+    }
+};
+
+
+/**
+ * Checks the message at the index, counted from the oldest.
+ */
+static void assertMessage(const char* expected, Outbox& outbox,
+                          size_t index = 0)
+{
+    char message[Outbox::MESSAGE_CAPACITY + 1];
+    TEST_ASSERT_TRUE(outbox.peek(index, message, sizeof(message)));
+    TEST_ASSERT_EQUAL_STRING(expected, message);
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_keeps_messages_in_order()
+{
+    MemoryOutboxStorage storage;
+    Outbox outbox(storage);
+    TEST_ASSERT_TRUE(outbox.begin(0));
+    TEST_ASSERT_TRUE(outbox.empty());
+
+    TEST_ASSERT_TRUE(outbox.push("A", 10));
+    TEST_ASSERT_TRUE(outbox.push("B", 20));
+    TEST_ASSERT_EQUAL(2, outbox.size());
+    assertMessage("A", outbox);
+    assertMessage("B", outbox, 1);
+    TEST_ASSERT_EQUAL(20, outbox.getQueuedAt(1));
+
+    outbox.pop();
+    assertMessage("B", outbox);
+    TEST_ASSERT_EQUAL(20, outbox.getQueuedAt(0));
+    outbox.pop(5);
+    TEST_ASSERT_TRUE(outbox.empty());
+
+    char message[8];
+    TEST_ASSERT_FALSE(outbox.peek(message, sizeof(message)));
+}
+
+
+void test_refuses_messages_when_full()
+{
+    MemoryOutboxStorage storage;
+    Outbox outbox(storage);
+    outbox.begin(0);
+    for (size_t i = 0; i < Outbox::CAPACITY; i++)
+    {
+        TEST_ASSERT_TRUE(outbox.push("X", 0));
+    }
+    TEST_ASSERT_FALSE(outbox.push("Y", 0));
+    TEST_ASSERT_EQUAL(Outbox::CAPACITY, outbox.size());
+}
+
+
+void test_reuses_slots_in_order()
+{
+    MemoryOutboxStorage storage;
+    Outbox outbox(storage);
+    outbox.begin(0);
+
+    // Keeping a few messages queued while going round the slots several
+    // times checks every wrap-around of the index
+    char message[8];
+    size_t next_pushed = 0;
+    size_t next_popped = 0;
+    for (size_t round = 0; round < 5 * Outbox::CAPACITY; round++)
+    {
+        while (outbox.size() < 5)
+        {
+            snprintf(message, sizeof(message), "M%u", (unsigned)next_pushed++);
+            TEST_ASSERT_TRUE(outbox.push(message, next_pushed));
+        }
+        snprintf(message, sizeof(message), "M%u", (unsigned)next_popped++);
+        assertMessage(message, outbox);
+        TEST_ASSERT_EQUAL(next_popped, outbox.getQueuedAt(0));
+        outbox.pop();
+    }
+}
+
+
+void test_restores_messages_from_storage()
+{
+    MemoryOutboxStorage storage;
+    {
+        Outbox outbox(storage);
+        outbox.begin(0);
+        for (size_t i = 0; i < Outbox::CAPACITY - 2; i++)
+        {
+            outbox.push("OLD", 0);
+            outbox.pop();
+        }
+        outbox.push("A", 0);
+        outbox.push("B", 0);
+        outbox.push("C", 0);
+        outbox.push("D", 0);
+        outbox.pop();
+    }
+
+    // The queue left behind wraps around the end of the slots
+    Outbox outbox(storage);
+    TEST_ASSERT_TRUE(outbox.begin(500));
+    TEST_ASSERT_EQUAL(3, outbox.size());
+    assertMessage("B", outbox);
+    assertMessage("C", outbox, 1);
+    assertMessage("D", outbox, 2);
+    TEST_ASSERT_EQUAL(500, outbox.getQueuedAt(2));
+}
+
+
+void test_starts_over_on_invalid_counters()
+{
+    MemoryOutboxStorage storage;
+    storage.writeHead(3);
+    storage.writeTail(3 + Outbox::CAPACITY + 1);
+    Outbox outbox(storage);
+    TEST_ASSERT_TRUE(outbox.begin(0));
+    TEST_ASSERT_TRUE(outbox.empty());
+    TEST_ASSERT_TRUE(outbox.push("A", 0));
+    assertMessage("A", outbox);
+}
+
+
+void test_refuses_messages_too_long()
+{
+    MemoryOutboxStorage storage;
+    Outbox outbox(storage);
+    outbox.begin(0);
+
+    std::string longest(Outbox::MESSAGE_CAPACITY, 'E');
+    TEST_ASSERT_FALSE(outbox.push((longest + "E").c_str(), 0));
+    TEST_ASSERT_TRUE(outbox.empty());
+
+    TEST_ASSERT_TRUE(outbox.push(longest.c_str(), 0));
+    assertMessage(longest.c_str(), outbox);
+}
+
+
+void test_writes_one_slot_and_counter_per_message()
+{
+    CountingStorage storage;
+    Outbox outbox(storage);
+    outbox.begin(0);
+    TEST_ASSERT_EQUAL(0, storage.counter_writes);
+
+    outbox.push("A", 0);
+    outbox.push("B", 0);
+    outbox.push("C", 0);
+    TEST_ASSERT_EQUAL(3, storage.slot_writes);
+    TEST_ASSERT_EQUAL(3, storage.counter_writes);
+
+    // A batch is removed with one write, and nothing removed writes nothing
+    outbox.pop(3);
+    outbox.pop(3);
+    TEST_ASSERT_EQUAL(4, storage.counter_writes);
+
+    // Reading the queue back after a restart writes nothing
+    Outbox restored(storage);
+    restored.begin(0);
+    TEST_ASSERT_EQUAL(4, storage.counter_writes);
+    TEST_ASSERT_EQUAL(3, storage.slot_writes);
+}
+
+
+void test_skips_unchanged_slot_writes()
+{
+    CountingStorage storage;
+    Outbox outbox(storage);
+    outbox.begin(0);
+    for (size_t i = 0; i < Outbox::CAPACITY; i++)
+    {
+        outbox.push("CQ", 0);
+        outbox.pop();
+    }
+    TEST_ASSERT_EQUAL(Outbox::CAPACITY, storage.slot_writes);
+
+    // Going round again with the same message only writes the tail
+    outbox.push("CQ", 0);
+    TEST_ASSERT_EQUAL(Outbox::CAPACITY, storage.slot_writes);
+    assertMessage("CQ", outbox);
+
+    outbox.push("QRZ", 0);
+    TEST_ASSERT_EQUAL(Outbox::CAPACITY + 1, storage.slot_writes);
+    assertMessage("QRZ", outbox, 1);
+}
+
+
+void test_backoff_doubles_within_jitter()
+{
+    MemoryOutboxStorage storage;
+    Outbox outbox(storage);
+    outbox.begin(0);
+    outbox.push("A", 0);
+    TEST_ASSERT_TRUE(outbox.isDue(0));
+
+    // No entropy waits half the backoff, all of it waits the whole backoff
+    unsigned long now = 1000;
+    unsigned long backoff = Outbox::MIN_BACKOFF_MS;
+    for (int failure = 0; failure < 12; failure++)
+    {
+        outbox.onFailure(now, 0);
+        TEST_ASSERT_EQUAL(backoff / 2, outbox.getDelay(now));
+        TEST_ASSERT_FALSE(outbox.isDue(now + backoff / 2 - 1));
+        TEST_ASSERT_TRUE(outbox.isDue(now + backoff / 2));
+        backoff = backoff * 2 > Outbox::MAX_BACKOFF_MS ?
+            Outbox::MAX_BACKOFF_MS : backoff * 2;
+    }
+    TEST_ASSERT_EQUAL(Outbox::MAX_BACKOFF_MS, backoff);
+
+    outbox.onFailure(now, 0xFFFFFFFF);
+    TEST_ASSERT_TRUE(outbox.getDelay(now) >= Outbox::MAX_BACKOFF_MS / 2);
+    TEST_ASSERT_TRUE(outbox.getDelay(now) <= Outbox::MAX_BACKOFF_MS);
+
+    // A delivery resets the backoff
+    outbox.onSuccess();
+    TEST_ASSERT_TRUE(outbox.isDue(now));
+    outbox.onFailure(now, Outbox::MIN_BACKOFF_MS / 2);
+    TEST_ASSERT_EQUAL(Outbox::MIN_BACKOFF_MS, outbox.getDelay(now));
+}
+
+
+void test_jitter_spans_half_to_all_of_the_backoff()
+{
+    MemoryOutboxStorage storage;
+    for (uint32_t entropy = 0; entropy < 5000; entropy += 7)
+    {
+        Outbox outbox(storage);
+        outbox.onFailure(0, entropy * 2654435761u);
+        unsigned long delay = outbox.getDelay(0);
+        TEST_ASSERT_TRUE(delay >= Outbox::MIN_BACKOFF_MS / 2);
+        TEST_ASSERT_TRUE(delay <= Outbox::MIN_BACKOFF_MS);
+    }
+}
+
+
+void test_delay_survives_millis_wrapping_around()
+{
+    MemoryOutboxStorage storage;
+    Outbox outbox(storage);
+    outbox.begin(0);
+    outbox.push("A", 0);
+    unsigned long now = 0xFFFFFFFFul - 100;
+    outbox.onFailure(now, 0);
+    TEST_ASSERT_EQUAL(Outbox::MIN_BACKOFF_MS / 2, outbox.getDelay(now));
+    TEST_ASSERT_FALSE(outbox.isDue(now + 500));
+    TEST_ASSERT_TRUE(outbox.isDue(now + Outbox::MIN_BACKOFF_MS / 2));
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_keeps_messages_in_order);
+    RUN_TEST(test_refuses_messages_when_full);
+    RUN_TEST(test_reuses_slots_in_order);
+    RUN_TEST(test_restores_messages_from_storage);
+    RUN_TEST(test_starts_over_on_invalid_counters);
+    RUN_TEST(test_refuses_messages_too_long);
+    RUN_TEST(test_writes_one_slot_and_counter_per_message);
+    RUN_TEST(test_skips_unchanged_slot_writes);
+    RUN_TEST(test_backoff_doubles_within_jitter);
+    RUN_TEST(test_jitter_spans_half_to_all_of_the_backoff);
+    RUN_TEST(test_delay_survives_millis_wrapping_around);
+    return UNITY_END();
+}
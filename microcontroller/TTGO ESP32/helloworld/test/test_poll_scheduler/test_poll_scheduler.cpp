@@ -0,0 +1,173 @@
+#include <unity.h>
+
+#include "poll_scheduler.hpp"
+
+
+/**
+ * When polling starts in the tests, well after boot as it does after the WiFi
+ * portal.
+ */
+static const unsigned long START = 600000;
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_first_poll_is_due_at_start()
+{
+    PollScheduler polls;
+    polls.begin(START);
+    TEST_ASSERT_TRUE(polls.isDue(START));
+    TEST_ASSERT_EQUAL(0, polls.getDelay(START));
+    TEST_ASSERT_EQUAL(PollScheduler::BASE_INTERVAL_MS, polls.getInterval());
+
+    polls.onPoll(START);
+    TEST_ASSERT_FALSE(polls.isDue(START + PollScheduler::BASE_INTERVAL_MS - 1));
+    TEST_ASSERT_TRUE(polls.isDue(START + PollScheduler::BASE_INTERVAL_MS));
+    TEST_ASSERT_EQUAL(1, polls.getPolls());
+}
+
+
+void test_backs_off_while_idle()
+{
+    PollScheduler polls;
+    polls.begin(START);
+    unsigned long now = START;
+    polls.onPendingCount(now, 0, false);
+    TEST_ASSERT_EQUAL(PollScheduler::MIN_INTERVAL_MS, polls.getInterval());
+
+    // Each unchanged count waits half as long again, up to the maximum
+    unsigned long interval = PollScheduler::MIN_INTERVAL_MS;
+    for (int poll = 0; poll < 10; poll++)
+    {
+        now += polls.getDelay(now);
+        polls.onPoll(now);
+        polls.onPendingCount(now, 0, false);
+        interval += interval / 2;
+        if (interval > PollScheduler::MAX_INTERVAL_MS)
+        {
+            interval = PollScheduler::MAX_INTERVAL_MS;
+        }
+        TEST_ASSERT_EQUAL(interval, polls.getInterval());
+        TEST_ASSERT_EQUAL(interval, polls.getDelay(now));
+    }
+    TEST_ASSERT_EQUAL(PollScheduler::MAX_INTERVAL_MS, polls.getInterval());
+}
+
+
+void test_shortens_after_activity()
+{
+    PollScheduler polls;
+    polls.begin(START);
+    unsigned long now = START;
+    for (int poll = 0; poll < 10; poll++)
+    {
+        polls.onPendingCount(now, 0, false);
+        now += polls.getDelay(now);
+    }
+    TEST_ASSERT_EQUAL(PollScheduler::MAX_INTERVAL_MS, polls.getInterval());
+
+    // A message sent brings the next poll forward
+    polls.onPendingCount(now, 0, false);
+    polls.onActivity(now + 1000);
+    TEST_ASSERT_EQUAL(PollScheduler::MIN_INTERVAL_MS, polls.getInterval());
+    TEST_ASSERT_EQUAL(PollScheduler::MIN_INTERVAL_MS, polls.getDelay(now + 1000));
+
+    // But does not put off a poll that is due sooner
+    polls.onActivity(now + 2000);
+    TEST_ASSERT_EQUAL(1000, polls.getDelay(now + 2000));
+}
+
+
+void test_new_messages_shorten_the_interval()
+{
+    PollScheduler polls;
+    polls.begin(START);
+    polls.onPendingCount(START, 0, false);
+    polls.onPendingCount(START, 0, false);
+    polls.onPendingCount(START, 0, false);
+    TEST_ASSERT_TRUE(polls.getInterval() > PollScheduler::MIN_INTERVAL_MS);
+
+    polls.onPendingCount(START, 2, false);
+    TEST_ASSERT_EQUAL(PollScheduler::MIN_INTERVAL_MS, polls.getInterval());
+}
+
+
+void test_piggybacked_count_skips_the_poll()
+{
+    PollScheduler polls;
+    polls.begin(START);
+    polls.onPoll(START);
+    polls.onPendingCount(START, 0, false);
+
+    // A send answered just before the poll was due puts it off by an interval
+    unsigned long now = START + PollScheduler::MIN_INTERVAL_MS - 10;
+    polls.onPendingCount(now, 0, true);
+    TEST_ASSERT_FALSE(polls.isDue(START + PollScheduler::MIN_INTERVAL_MS));
+    TEST_ASSERT_EQUAL(polls.getInterval(), polls.getDelay(now));
+    TEST_ASSERT_EQUAL(1, polls.getPiggybacked());
+    TEST_ASSERT_EQUAL(1, polls.getPolls());
+}
+
+
+void test_saved_per_hour_counts_from_start()
+{
+    PollScheduler polls;
+    polls.begin(START);
+    TEST_ASSERT_EQUAL(0, polls.getSavedPerHour(START));
+
+    // 720 polls an hour at the base interval; 200 were made instead
+    for (int poll = 0; poll < 200; poll++)
+    {
+        polls.onPoll(START + poll * 18000ul);
+    }
+    TEST_ASSERT_EQUAL(520, polls.getSavedPerHour(START + 3600000));
+}
+
+
+void test_saved_per_hour_is_negative_when_polling_more()
+{
+    PollScheduler polls;
+    polls.begin(START);
+    // 30 polls in a minute instead of 12
+    for (int poll = 0; poll < 30; poll++)
+    {
+        polls.onPoll(START + poll * 2000ul);
+    }
+    TEST_ASSERT_EQUAL(-18 * 60, polls.getSavedPerHour(START + 60000));
+}
+
+
+void test_handles_millis_wrapping_around()
+{
+    unsigned long start = 0xFFFFFFFFul - 1000;
+    PollScheduler polls;
+    polls.begin(start);
+    polls.onPoll(start);
+    TEST_ASSERT_FALSE(polls.isDue(start + 4000));
+    TEST_ASSERT_EQUAL(1000, polls.getDelay(start + 4000));
+    TEST_ASSERT_TRUE(polls.isDue(start + PollScheduler::BASE_INTERVAL_MS));
+    TEST_ASSERT_EQUAL(720 - 1, polls.getSavedPerHour(start + 3600000));
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_first_poll_is_due_at_start);
+    RUN_TEST(test_backs_off_while_idle);
+    RUN_TEST(test_shortens_after_activity);
+    RUN_TEST(test_new_messages_shorten_the_interval);
+    RUN_TEST(test_piggybacked_count_skips_the_poll);
+    RUN_TEST(test_saved_per_hour_counts_from_start);
+    RUN_TEST(test_saved_per_hour_is_negative_when_polling_more);
+    RUN_TEST(test_handles_millis_wrapping_around);
+    return UNITY_END();
+}
@@ -0,0 +1,123 @@
+#include <unity.h>
+
+#include <Arduino.h>
+#include <host.hpp>
+
+#include "power_scheduler.hpp"
+
+
+void setUp()
+{
+    hostUseSimulatedClock(5000000);
+}
+
+
+void tearDown()
+{
+    hostUseRealClock();
+}
+
+
+void test_sleeps_until_earliest_deadline()
+{
+    PowerScheduler power;
+    power.begin(millis());
+    power.addDelay(300);
+    power.addDeadline(millis() + 120);
+    power.addDelay(500);
+    TEST_ASSERT_EQUAL(120, power.getSleep());
+}
+
+
+void test_sleeps_at_most_the_maximum()
+{
+    PowerScheduler power;
+    power.begin(millis());
+    TEST_ASSERT_EQUAL(PowerScheduler::MAX_SLEEP_MS, power.getSleep());
+    power.addDelay(60000);
+    TEST_ASSERT_EQUAL(PowerScheduler::MAX_SLEEP_MS, power.getSleep());
+}
+
+
+void test_does_not_sleep_past_a_missed_deadline()
+{
+    PowerScheduler power;
+    unsigned long deadline = millis() + 100;
+    hostAdvanceClock(150000);
+    power.begin(millis());
+    power.addDeadline(deadline);
+    TEST_ASSERT_EQUAL(0, power.getSleep());
+
+    power.begin(millis());
+    power.addDeadline(millis());
+    TEST_ASSERT_EQUAL(0, power.getSleep());
+}
+
+
+void test_forgets_deadlines_of_the_last_round()
+{
+    PowerScheduler power;
+    power.begin(millis());
+    power.addDelay(10);
+    hostAdvanceClock(10000);
+    power.begin(millis());
+    TEST_ASSERT_EQUAL(PowerScheduler::MAX_SLEEP_MS, power.getSleep());
+}
+
+
+void test_handles_millis_wrapping_around()
+{
+    hostUseSimulatedClock((uint64_t)(0xFFFFFFFFul - 50) * 1000);
+    PowerScheduler power;
+    power.begin(millis());
+    power.addDeadline(millis() + 200);
+    TEST_ASSERT_EQUAL(200, power.getSleep());
+
+    unsigned long before = millis() - 10;
+    hostAdvanceClock(100000);
+    power.begin(millis());
+    power.addDeadline(before);
+    TEST_ASSERT_EQUAL(0, power.getSleep());
+}
+
+
+/*
+ * Runs the loop as it does with a blink every 500 ms and nothing else to do:
+ * nearly all the time is spent blocked, one wait per deadline.
+ */
+void test_accounts_time_in_each_state()
+{
+    PowerScheduler power;
+    unsigned long start = millis();
+    unsigned long active_before = power.getTime(PowerScheduler::ACTIVE, start);
+    for (int i = 0; i < 10; i++)
+    {
+        hostAdvanceClock(2000);
+        power.begin(millis());
+        power.addDelay(500 - millis() % 500);
+        power.enter(PowerScheduler::BLOCKED, millis());
+        delay(power.getSleep());
+        power.enter(PowerScheduler::ACTIVE, millis());
+    }
+
+    unsigned long now = millis();
+    unsigned long active = power.getTime(PowerScheduler::ACTIVE, now);
+    unsigned long blocked = power.getTime(PowerScheduler::BLOCKED, now);
+    TEST_ASSERT_EQUAL(10 * 500, now - start);
+    TEST_ASSERT_EQUAL(10 * 2, active - active_before);
+    TEST_ASSERT_EQUAL(10 * (500 - 2), blocked);
+    TEST_ASSERT_EQUAL(10, power.getBlocks());
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_sleeps_until_earliest_deadline);
+    RUN_TEST(test_sleeps_at_most_the_maximum);
+    RUN_TEST(test_does_not_sleep_past_a_missed_deadline);
+    RUN_TEST(test_forgets_deadlines_of_the_last_round);
+    RUN_TEST(test_handles_millis_wrapping_around);
+    RUN_TEST(test_accounts_time_in_each_state);
+    return UNITY_END();
+}
@@ -0,0 +1,238 @@
+#include <string.h>
+#include <unity.h>
+
+#include <string>
+
+#include "dictionary.hpp"
+#include "dictionary_data.hpp"
+#include "editor.hpp"
+#include "keyer.hpp"
+#include "send_gesture.hpp"
+
+
+static const uint32_t UNIT_US = MorseKeyer::INITIAL_UNIT_US;
+
+/**
+ * How often the loop runs in the tests; the device wakes at least this often
+ * for the cursor blink.
+ */
+static const uint32_t LOOP_US = 10000;
+
+
+/**
+ * The keying, completion and send handling of the main loop in the decoded
+ * mode, stepped on a clock of its own.
+ */
+struct Writer {
+    MessageEditor editor;
+    MorseKeyer keyer;
+    Dictionary dictionary;
+    SendGesture gesture;
+    char completion[Dictionary::MAX_DEPTH + 1];
+    uint32_t now_us;
+
+    Writer()
+        : dictionary(DICTIONARY_IMAGE, DICTIONARY_IMAGE_SIZE), completion(),
+          now_us(0)
+    {
+    }
+
+    /**
+     * Runs the loop until the time.
+     */
+    void runUntil(uint32_t time_us)
+    {
+        while (now_us < time_us)
+        {
+            now_us += LOOP_US;
+            switch (gesture.isHeld() ? MorseKeyer::NO_BREAK : keyer.poll(now_us))
+            {
+            case MorseKeyer::LETTER_BREAK:
+                editor.closeLetter();
+                break;
+            case MorseKeyer::WORD_BREAK:
+                editor.addWordSpace();
+                break;
+            case MorseKeyer::NO_BREAK:
+                break;
+            }
+
+            size_t length;
+            const char* word = editor.getRecentWord(length);
+            if (dictionary.setPrefix(word, length))
+            {
+                dictionary.getCompletion(completion, sizeof(completion));
+            }
+        }
+    }
+
+    /**
+     * Keys the elements of a letter, given as '.' and '-', at the initial
+     * speed of the keyer. Returns at the end of the last element.
+     */
+    void keyLetter(const char* elements)
+    {
+        for (const char* element = elements; *element != '\0'; element++)
+        {
+            if (element != elements)
+            {
+                runUntil(now_us + UNIT_US);
+            }
+            keyer.press(now_us);
+            runUntil(now_us + (*element == '-' ? 3 : 1) * UNIT_US);
+            bool dash;
+            if (keyer.release(now_us, dash))
+            {
+                editor.addElement(dash);
+            }
+        }
+    }
+
+    /**
+     * Keys the word and waits for the letter break after it.
+     */
+    void keyWord(const char* const* letters, size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (i > 0)
+            {
+                runUntil(now_us + 3 * UNIT_US);
+            }
+            keyLetter(letters[i]);
+        }
+        runUntil(now_us + 2 * UNIT_US + LOOP_US);
+    }
+
+    /**
+     * Holds send for the duration and handles the release as the loop does.
+     */
+    SendGesture::gesture holdSend(uint32_t duration_us)
+    {
+        gesture.press(now_us, completion);
+        runUntil(now_us + duration_us);
+        SendGesture::gesture result = gesture.release(now_us);
+        if (result == SendGesture::ACCEPT)
+        {
+            editor.completeWord(gesture.getCompletion());
+        }
+        return result;
+    }
+};
+
+
+/**
+ * HEL, which the dictionary completes.
+ */
+static const char* const HEL[] = {"....", ".", ".-.."};
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_press_sends()
+{
+    SendGesture gesture;
+    gesture.press(0, "LO");
+    TEST_ASSERT_TRUE(gesture.isHeld());
+    TEST_ASSERT_EQUAL(SendGesture::SEND, gesture.release(200000));
+    TEST_ASSERT_FALSE(gesture.isHeld());
+}
+
+
+void test_hold_accepts_completion_of_press()
+{
+    SendGesture gesture;
+    char completion[] = "LO";
+    gesture.press(1000, completion);
+    completion[0] = '\0';
+    TEST_ASSERT_EQUAL(SendGesture::ACCEPT,
+                      gesture.release(1000 + SendGesture::ACCEPT_HOLD_US));
+    TEST_ASSERT_EQUAL_STRING("LO", gesture.getCompletion());
+}
+
+
+void test_hold_without_completion_sends()
+{
+    SendGesture gesture;
+    gesture.press(0, "");
+    TEST_ASSERT_EQUAL(SendGesture::SEND,
+                      gesture.release(2 * SendGesture::ACCEPT_HOLD_US));
+}
+
+
+void test_release_without_press_sends()
+{
+    SendGesture gesture;
+    TEST_ASSERT_EQUAL(SendGesture::SEND,
+                      gesture.release(SendGesture::ACCEPT_HOLD_US));
+}
+
+
+void test_hold_after_letter_break_accepts()
+{
+    Writer writer;
+    writer.keyWord(HEL, 3);
+    TEST_ASSERT_EQUAL_STRING("HEL", writer.editor.getMessage());
+    std::string offered = writer.completion;
+    TEST_ASSERT_FALSE(offered.empty());
+
+    // The hold outlasts the word break, which waits for the release
+    writer.runUntil(writer.now_us + UNIT_US);
+    TEST_ASSERT_EQUAL(SendGesture::ACCEPT,
+                      writer.holdSend(SendGesture::ACCEPT_HOLD_US + 50000));
+    std::string expected = "HEL" + offered + " ";
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), writer.editor.getMessage());
+
+    // The break held back closes nothing more
+    writer.runUntil(writer.now_us + 10 * UNIT_US);
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), writer.editor.getMessage());
+}
+
+
+void test_hint_outlasts_word_break()
+{
+    Writer writer;
+    writer.keyWord(HEL, 3);
+    std::string offered = writer.completion;
+
+    // Long after the word break, the closed word is still offered
+    writer.runUntil(writer.now_us + 2000000);
+    TEST_ASSERT_EQUAL_STRING("HEL ", writer.editor.getMessage());
+    TEST_ASSERT_EQUAL_STRING(offered.c_str(), writer.completion);
+
+    TEST_ASSERT_EQUAL(SendGesture::ACCEPT,
+                      writer.holdSend(SendGesture::ACCEPT_HOLD_US));
+    std::string expected = "HEL" + offered + " ";
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), writer.editor.getMessage());
+}
+
+
+void test_short_press_after_letter_sends()
+{
+    Writer writer;
+    writer.keyWord(HEL, 3);
+    TEST_ASSERT_EQUAL(SendGesture::SEND, writer.holdSend(150000));
+    TEST_ASSERT_EQUAL_STRING("HEL", writer.editor.getMessage());
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_press_sends);
+    RUN_TEST(test_hold_accepts_completion_of_press);
+    RUN_TEST(test_hold_without_completion_sends);
+    RUN_TEST(test_release_without_press_sends);
+    RUN_TEST(test_hold_after_letter_break_accepts);
+    RUN_TEST(test_hint_outlasts_word_break);
+    RUN_TEST(test_short_press_after_letter_sends);
+    return UNITY_END();
+}
@@ -0,0 +1,197 @@
+#include <time.h>
+#include <unity.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <loopback_server.hpp>
+
+#include "network.hpp"
+#include "wire.hpp"
+
+
+/**
+ * A line of wire_vectors.txt, which the server's tests read as well.
+ */
+struct vector_line {
+    std::string kind;
+    std::vector<uint8_t> data;
+    std::vector<std::string> fields; // what follows the data
+};
+
+
+static std::vector<uint8_t> fromHex(const std::string& hex)
+{
+    std::vector<uint8_t> data;
+    for (size_t i = 0; i + 1 < hex.size(); i += 2)
+    {
+        data.push_back((uint8_t)strtoul(hex.substr(i, 2).c_str(), NULL, 16));
+    }
+    return data;
+}
+
+
+/**
+ * Reads the vectors of a kind from the file next to this one, found from the
+ * path it was compiled by or else in the working directory.
+ */
+static std::vector<vector_line> readVectors(const char* kind)
+{
+    std::string path = __FILE__;
+    path = path.substr(0, path.find_last_of('/') + 1) + "wire_vectors.txt";
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        file.open("wire_vectors.txt");
+    }
+    TEST_ASSERT_TRUE_MESSAGE(file.is_open(), path.c_str());
+
+    std::vector<vector_line> vectors;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::vector<std::string> fields;
+        std::stringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, '\t'))
+        {
+            fields.push_back(field);
+        }
+        if (fields.size() < 2 || fields[0] != kind)
+        {
+            continue;
+        }
+        vector_line vector = {fields[0], fromHex(fields[1]),
+                              std::vector<std::string>(fields.begin() + 2,
+                                                       fields.end())};
+        vectors.push_back(vector);
+    }
+    TEST_ASSERT_FALSE(vectors.empty());
+    return vectors;
+}
+
+
+/**
+ * Returns the field of the vector, or an empty string where an editor dropped
+ * the tab before an empty last field.
+ */
+static std::string field(const vector_line& vector, size_t index)
+{
+    return index < vector.fields.size() ? vector.fields[index] : "";
+}
+
+
+void setUp()
+{
+}
+
+
+void tearDown()
+{
+}
+
+
+void test_packs_text_as_the_server_does()
+{
+    for (const vector_line& vector : readVectors("text"))
+    {
+        std::string text = field(vector, 0);
+        uint8_t packed[256];
+        TEST_ASSERT_EQUAL_INT_MESSAGE(vector.data.size(),
+                                      wireTextSize(text.c_str()),
+                                      text.c_str());
+        TEST_ASSERT_EQUAL(vector.data.size(),
+                          wirePackText(text.c_str(), packed, sizeof(packed)));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY_MESSAGE(vector.data.data(), packed,
+                                             vector.data.size(), text.c_str());
+    }
+}
+
+
+void test_unpacks_text_of_the_server()
+{
+    for (const vector_line& vector : readVectors("text"))
+    {
+        std::string text = field(vector, 0);
+        char unpacked[WIRE_MAX_CHARACTERS + 1];
+        TEST_ASSERT_EQUAL(vector.data.size(),
+                          wireUnpackText(vector.data.data(), vector.data.size(),
+                                         unpacked, sizeof(unpacked)));
+        TEST_ASSERT_EQUAL_STRING(text.c_str(), unpacked);
+    }
+}
+
+
+void test_rejects_truncated_text()
+{
+    for (const vector_line& vector : readVectors("text"))
+    {
+        if (vector.data.size() < 2)
+        {
+            continue;
+        }
+        char unpacked[WIRE_MAX_CHARACTERS + 1];
+        TEST_ASSERT_EQUAL(0, wireUnpackText(vector.data.data(),
+                                            vector.data.size() - 1,
+                                            unpacked, sizeof(unpacked)));
+    }
+}
+
+
+/*
+ * The messages the server frames for /api/binary/message/pending/get are
+ * read back by the client with their sender, time and text.
+ */
+void test_fetches_messages_framed_by_the_server()
+{
+    std::vector<vector_line> vectors = readVectors("message");
+    std::string response;
+    response += (char)0;
+    response += (char)7;
+    response += (char)vectors.size();
+    for (const vector_line& vector : vectors)
+    {
+        response.append(vector.data.begin(), vector.data.end());
+    }
+
+    LoopbackServer server([&](const LoopbackServer::request&) {
+        return LoopbackServer::respond(200, "application/octet-stream",
+                                       response);
+    });
+    TEST_ASSERT_TRUE(server.begin());
+    ApplicationNetworkClient client("127.0.0.1", server.getPort());
+    client.setProtocol(ApplicationNetworkClient::BINARY_PROTOCOL);
+
+    ApplicationNetworkClient::message_map messages[4];
+    TEST_ASSERT_EQUAL(vectors.size(), client.fetchPendingMessages(messages, 4));
+    TEST_ASSERT_EQUAL(7, client.getPendingCount());
+    for (size_t i = 0; i < vectors.size(); i++)
+    {
+        std::string sender = field(vectors[i], 0);
+        std::string content = field(vectors[i], 2);
+        time_t seconds = (time_t)strtoul(field(vectors[i], 1).c_str(), NULL,
+                                         10);
+        struct tm sent_time;
+        gmtime_r(&seconds, &sent_time);
+        char sent_at[32];
+        strftime(sent_at, sizeof(sent_at), "%Y-%m-%d %I:%M:%S %p", &sent_time);
+
+        TEST_ASSERT_EQUAL_STRING(sender.c_str(), messages[i].macAddress.c_str());
+        TEST_ASSERT_EQUAL_STRING(sent_at, messages[i].time.c_str());
+        TEST_ASSERT_EQUAL_STRING(content.c_str(), messages[i].content.c_str());
+    }
+    server.end();
+}
+
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_packs_text_as_the_server_does);
+    RUN_TEST(test_unpacks_text_of_the_server);
+    RUN_TEST(test_rejects_truncated_text);
+    RUN_TEST(test_fetches_messages_framed_by_the_server);
+    return UNITY_END();
+}
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Builds the word completion dictionary of the device from a word list. See
+dictionary.hpp in the firmware for the layout of the image.
+
+The word list has one word per line, most likely first, optionally followed by
+a count of how often it is used. Blank lines and lines starting with # are
+skipped. Words are upper-cased, and words with characters the Morse decoder
+cannot produce are left out.
+
+Usage:
+
+    python3 tools/build_dictionary.py tools/words.txt src/dictionary_data.cpp
+"""
+
+import argparse
+import math
+import sys
+from typing import Dict, List, Optional, Tuple
+
+
+MAGIC = b'MDIC'
+VERSION = 1
+HEADER_SIZE = 8
+NO_CHILD = 0xFF
+MAX_CHILDREN = 63
+MAX_OFFSET = (1 << 24) - 1
+# Characters the decoder produces that can be part of a word
+ALPHABET = set('ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789\'-')
+
+
+class Node:
+    def __init__(self) -> None:
+        self.children: Dict[str, 'Node'] = {}
+        self.weight: Optional[int] = None  # set if a word ends here
+        self.best_weight = 0
+        self.best_child = NO_CHILD
+
+
+def read_words(path: str) -> List[Tuple[str, Optional[int]]]:
+    words = []
+    seen = set()
+    with open(path, encoding='utf-8') as word_file:
+        for line in word_file:
+            fields = line.split()
+            if not fields or fields[0].startswith('#'):
+                continue
+            word = fields[0].upper()
+            if word in seen or not set(word) <= ALPHABET:
+                continue
+            seen.add(word)
+            count = int(fields[1]) if len(fields) > 1 else None
+            words.append((word, count))
+    return words
+
+
+def assign_weights(words: List[Tuple[str, Optional[int]]]) -> List[Tuple[str, int]]:
+    """Scales the counts, or the ranks if there are none, to weights from 1 to
+    255. Counts are scaled logarithmically, as word use falls off steeply.
+    """
+    if not words:
+        return []
+    if all(count is not None for _, count in words):
+        top = math.log(max(count for _, count in words) + 1)
+        return [(word, max(1, round(255 * math.log(count + 1) / top)))
+                for word, count in words]
+    last = max(len(words) - 1, 1)
+    return [(word, 255 - rank * 254 // last) for rank, (word, _) in
+            enumerate(words)]
+
+
+def build_trie(words: List[Tuple[str, int]]) -> Node:
+    root = Node()
+    for word, weight in words:
+        node = root
+        for letter in word:
+            node = node.children.setdefault(letter, Node())
+        node.weight = weight
+    return root
+
+
+def rank_completions(node: Node) -> int:
+    """Records in every node the weight of the best word below it and the child
+    that leads to it. A word ending at the node beats its children on a tie, as
+    it is shorter.
+    """
+    node.best_weight = node.weight if node.weight is not None else 0
+    node.best_child = NO_CHILD
+    for index, letter in enumerate(sorted(node.children)):
+        weight = rank_completions(node.children[letter])
+        if weight > node.best_weight:
+            node.best_weight = weight
+            node.best_child = index
+    return node.best_weight
+
+
+def serialize(root: Node) -> bytes:
+    """Lays out the nodes children first, sharing identical subtrees, and
+    returns the image. The root comes last; the header points to it.
+    """
+    image = bytearray(HEADER_SIZE)
+    offsets: Dict[bytes, int] = {}
+
+    def place(node: Node) -> int:
+        letters = sorted(node.children)
+        if len(letters) > MAX_CHILDREN:
+            sys.exit(f'a node has more than {MAX_CHILDREN} children')
+        children = [(letter, place(node.children[letter])) for letter in letters]
+
+        flags = len(children) | (0x80 if node.weight is not None else 0)
+        record = bytes([flags, node.best_weight, node.best_child])
+        for letter, offset in children:
+            record += letter.encode('ascii') + offset.to_bytes(3, 'big')
+
+        # Identical records have identical subtrees, so one copy serves all
+        if record not in offsets:
+            offsets[record] = len(image)
+            image.extend(record)
+        if offsets[record] > MAX_OFFSET:
+            sys.exit('the dictionary does not fit in 24-bit offsets')
+        return offsets[record]
+
+    root_offset = place(root)
+    image[0:HEADER_SIZE] = MAGIC + bytes([VERSION]) + \
+        root_offset.to_bytes(3, 'big')
+    return bytes(image)
+
+
+def write_source(image: bytes, word_count: int, path: str) -> None:
+    lines = [
+        '// Generated by tools/build_dictionary.py, do not edit.',
+        '',
+        '#include "dictionary_data.hpp"',
+        '',
+        '',
+        f'// {word_count} words',
+        'const uint8_t DICTIONARY_IMAGE[] = {',
+    ]
+    for start in range(0, len(image), 12):
+        chunk = image[start:start + 12]
+        lines.append('    ' + ', '.join(f'0x{byte:02X}' for byte in chunk) + ',')
+    lines += [
+        '};',
+        '',
+        'const size_t DICTIONARY_IMAGE_SIZE = sizeof(DICTIONARY_IMAGE);',
+        '',
+    ]
+    with open(path, 'w', encoding='utf-8') as source:
+        source.write('\n'.join(lines))
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('words', help='word list, most likely first')
+    parser.add_argument('output', help='C++ source to write the image to')
+    args = parser.parse_args()
+
+    words = assign_weights(read_words(args.words))
+    root = build_trie(words)
+    rank_completions(root)
+    image = serialize(root)
+    write_source(image, len(words), args.output)
+    print(f'{len(words)} words, {len(image)} bytes')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,770 @@
+/**
+ * Simulates a fleet of devices against the server to see how it holds up with
+ * far more devices than there are boards. The devices run the firmware's own
+ * ApplicationNetworkClient, FormDataFormatter, Outbox and PollScheduler, built
+ * for Linux against the host implementation of the board in lib/host, so the
+ * server sees the requests the boards make.
+ *
+ * Each simulated device runs on a thread of its own, which lib/host gives a
+ * MAC address and socket counters of its own. It registers, keys messages at
+ * the rate of its keying profile and sends them through an outbox (one at a
+ * time or in batches), polls the pending count on its polling profile,
+ * fetches messages whenever some are pending, and unregisters at the end. At
+ * the end the throughput and the p50/p99/p999 latencies of every endpoint are
+ * reported.
+ *
+ * Build and run it with the server running:
+ *
+ *     pio run -e fleet
+ *     .pio/build/fleet/program --devices 1000 --duration 60 --keying active
+ *     .pio/build/fleet/program --protocol binary --batch 4 --poll fixed
+ *
+ * or with `make load` in the server directory. With --tls the devices talk
+ * HTTPS through the OpenSSL client of lib/host, verifying the server against
+ * the CA given with --ca as the boards do, so the cost of the handshakes shows
+ * up against `make run-tls`:
+ *
+ *     .pio/build/fleet/program --tls --ca ../../../server/certs/ca.pem
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <Arduino.h>
+#include <host.hpp>
+
+#include "network.hpp"
+#include "network_task.hpp"
+#include "outbox.hpp"
+#include "poll_scheduler.hpp"
+
+
+/**
+ * Stack size of a device thread. The JSON documents of the client live on the
+ * stack, as on the network task of the board.
+ */
+static const size_t DEVICE_STACK_SIZE = 256 * 1024;
+
+/**
+ * Mean seconds between the messages a device keys, 0 for a device that only
+ * reads.
+ */
+struct keying_profile {
+    const char* name;
+    double mean_s;
+};
+
+static const keying_profile KEYING_PROFILES[] = {
+    {"idle", 0},
+    {"casual", 60},
+    {"active", 15},
+    {"chatty", 3},
+};
+
+static const char* const WORDS[] = {
+    "HELLO", "WORLD", "CQ", "DE", "TEST", "HOW", "ARE", "YOU", "OK", "SEE",
+    "LATER", "THE", "WEATHER", "IS", "GOOD", "HERE", "73", "NAME", "QTH",
+    "RST", "599", "THANKS", "FOR", "CALL",
+};
+
+
+enum endpoint {
+    REGISTER,
+    RECEIVE,
+    RECEIVE_BATCH,
+    PENDING_COUNT,
+    PENDING_GET,
+    UNREGISTER,
+    ENDPOINTS
+};
+
+static const char* const ENDPOINT_NAMES[ENDPOINTS] = {
+    "register", "receive", "receive/batch", "pending/count", "pending/get",
+    "unregister",
+};
+
+
+struct fleet_options {
+    const char* host = "localhost";
+    short port = 5000;
+    size_t devices = 100;
+    double duration_s = 30;
+    double ramp_up_s = 5;
+    bool binary = false;
+    double keying_s = 60;
+    double message_words = 4;
+    size_t batch = 1;
+    bool adaptive = true;
+    unsigned long poll_interval_ms = PollScheduler::BASE_INTERVAL_MS;
+    bool keep_alive = true;
+    bool tls = false;
+    std::string ca_certificate; // PEM, empty to skip verification
+    unsigned long seed = 1;
+    const char* csv = NULL;
+};
+
+
+/**
+ * What a device measured. Latencies are in microseconds.
+ */
+struct device_stats {
+    std::vector<uint32_t> latencies_us[ENDPOINTS];
+    unsigned long errors[ENDPOINTS] = {};
+    unsigned long connects = 0;
+    unsigned long messages_sent = 0;
+    unsigned long messages_received = 0;
+    unsigned long messages_dropped = 0;
+};
+
+
+/**
+ * A simulated board: the client and the logic of the main loop and the
+ * network task that decide when it makes requests.
+ */
+class Device
+{
+public:
+    Device(const fleet_options& options, size_t index)
+        : options_(options), client_(options.host, options.port),
+          outbox_(storage_), random_(options.seed * 1000003 + index),
+          start_delay_ms_((unsigned long)(options.ramp_up_s * 1000 * index /
+                                          options.devices)),
+          next_poll_(0)
+    {
+        // Locally administered addresses, so they cannot collide with boards
+        mac_[0] = 0x02;
+        mac_[1] = 0xF1;
+        for (int i = 0; i < 4; i++)
+        {
+            mac_[2 + i] = (uint8_t)(index >> (8 * (3 - i)));
+        }
+        client_.setProtocol(options.binary ?
+            ApplicationNetworkClient::BINARY_PROTOCOL :
+            ApplicationNetworkClient::FORM_PROTOCOL);
+        client_.setKeepAlive(options.keep_alive);
+        if (options.tls)
+        {
+            client_.setSecure(options.ca_certificate.empty() ? NULL :
+                              options.ca_certificate.c_str());
+        }
+    }
+
+    /**
+     * Runs the device on the calling thread until its time is up.
+     */
+    void run()
+    {
+        // The client reads the MAC address of its thread on the first request
+        hostSetMacAddress(mac_);
+        outbox_.begin(millis());
+        delay(start_delay_ms_);
+
+        unsigned long now = millis();
+        unsigned long deadline = now + (unsigned long)(options_.duration_s * 1000);
+        unsigned long next_message = nextMessage(now);
+        next_poll_ = now + options_.poll_interval_ms;
+        polls_.begin(now);
+
+        if (call(REGISTER, [this]() { client_.makeVisible(); return true; }))
+        {
+            onPendingCount(true);
+            fetch();
+
+            while ((long)(deadline - (now = millis())) > 0)
+            {
+                if ((long)(now - next_message) >= 0)
+                {
+                    std::string message = compose();
+                    if (!outbox_.push(message.c_str(), now))
+                    {
+                        stats_.messages_dropped++;
+                    }
+                    next_message = nextMessage(now);
+                    polls_.onActivity(now);
+                }
+
+                if (isBatchDue(now))
+                {
+                    send();
+                    onPendingCount(true);
+                    fetch();
+                }
+                else if (isPollDue(now))
+                {
+                    onPoll(now);
+                    call(PENDING_COUNT, [this]() {
+                        client_.countPendingMessages();
+                        return true;
+                    });
+                    onPendingCount(false);
+                    fetch();
+                }
+
+                // Sleep until the next thing to do
+                now = millis();
+                unsigned long wake = deadline;
+                wake = earliest(now, wake, next_message);
+                wake = earliest(now, wake, now + getPollDelay(now));
+                if (!outbox_.empty())
+                {
+                    wake = earliest(now, wake, now + std::max(
+                        outbox_.getDelay(now), getBatchDelay(now)));
+                }
+                if ((long)(wake - now) > 0)
+                {
+                    delay(wake - now);
+                }
+            }
+
+            call(UNREGISTER, [this]() { client_.makeInvisible(); return true; });
+        }
+        client_.disconnect();
+        stats_.connects = hostGetSocketStats().connects;
+    }
+
+    const device_stats& getStats() const noexcept
+    {
+        return stats_;
+    }
+
+private:
+    /**
+     * Makes a request and records its latency, or an error if the request
+     * failed or was not answered with 200. Returns true if it succeeded.
+     */
+    template <typename Request>
+    bool call(endpoint name, Request request)
+    {
+        unsigned long start = micros();
+        bool succeeded = request() && client_.getLastStatusCode() == 200;
+        unsigned long elapsed = micros() - start;
+        if (!succeeded)
+        {
+            stats_.errors[name]++;
+            return false;
+        }
+        stats_.latencies_us[name].push_back((uint32_t)elapsed);
+        return true;
+    }
+
+    /**
+     * Delivers the oldest messages of the outbox as the network task does.
+     */
+    void send()
+    {
+        const int max_batch = ApplicationNetworkClient::MAX_BATCH_SIZE;
+        char messages[max_batch][Outbox::MESSAGE_CAPACITY + 1];
+        const char* batch[max_batch];
+        unsigned long ages_ms[max_batch];
+        unsigned long now = millis();
+
+        size_t count = 0;
+        while (count < options_.batch && count < outbox_.size() &&
+               outbox_.peek(count, messages[count], sizeof(messages[count])))
+        {
+            batch[count] = messages[count];
+            ages_ms[count] = now - outbox_.getQueuedAt(count);
+            count++;
+        }
+        if (count == 0)
+        {
+            outbox_.pop();
+            return;
+        }
+
+        int sent = 0;
+        if (options_.batch > 1)
+        {
+            call(RECEIVE_BATCH, [&]() {
+                sent = client_.sendMessages(batch, ages_ms, (int)count);
+                return sent > 0;
+            });
+        }
+        else if (call(RECEIVE, [&]() { return client_.sendMessage(batch[0]); }))
+        {
+            sent = 1;
+        }
+
+        if (sent > 0)
+        {
+            outbox_.pop(sent);
+            outbox_.onSuccess();
+            stats_.messages_sent += sent;
+            polls_.onActivity(millis());
+        }
+        else
+        {
+            outbox_.onFailure(millis(), (uint32_t)random_());
+        }
+    }
+
+    /**
+     * Fetches messages while the server reports some pending.
+     */
+    void fetch()
+    {
+        ApplicationNetworkClient::message_map messages[NetworkTask::PREFETCH_SIZE];
+        while (client_.getPendingCount() > 0)
+        {
+            int fetched = 0;
+            if (!call(PENDING_GET, [&]() {
+                    fetched = client_.fetchPendingMessages(
+                        messages, NetworkTask::PREFETCH_SIZE);
+                    return true;
+                }))
+            {
+                return;
+            }
+            onPendingCount(true);
+            stats_.messages_received += fetched;
+            polls_.onActivity(millis());
+            if (fetched == 0)
+            {
+                return;
+            }
+        }
+    }
+
+    bool isBatchDue(unsigned long now) const noexcept
+    {
+        return !outbox_.empty() && outbox_.isDue(now) &&
+               getBatchDelay(now) == 0;
+    }
+
+    unsigned long getBatchDelay(unsigned long now) const noexcept
+    {
+        if (outbox_.size() >= options_.batch)
+        {
+            return 0;
+        }
+        unsigned long waited = now - outbox_.getQueuedAt(0);
+        return waited >= NetworkTask::BATCH_LATENCY_MS ?
+            0 : NetworkTask::BATCH_LATENCY_MS - waited;
+    }
+
+    bool isPollDue(unsigned long now) const noexcept
+    {
+        return getPollDelay(now) == 0;
+    }
+
+    unsigned long getPollDelay(unsigned long now) const noexcept
+    {
+        if (options_.adaptive)
+        {
+            return polls_.getDelay(now);
+        }
+        return (long)(next_poll_ - now) > 0 ? next_poll_ - now : 0;
+    }
+
+    void onPoll(unsigned long now) noexcept
+    {
+        polls_.onPoll(now);
+        next_poll_ = now + options_.poll_interval_ms;
+    }
+
+    void onPendingCount(bool piggybacked) noexcept
+    {
+        int count = client_.getPendingCount();
+        if (count >= 0)
+        {
+            polls_.onPendingCount(millis(), count, piggybacked);
+        }
+    }
+
+    unsigned long nextMessage(unsigned long now)
+    {
+        if (options_.keying_s <= 0)
+        {
+            // Far enough away not to come, near enough not to wrap
+            return now + (1ul << 30);
+        }
+        std::exponential_distribution<double> interval(1 / options_.keying_s);
+        return now + (unsigned long)(interval(random_) * 1000);
+    }
+
+    std::string compose()
+    {
+        std::exponential_distribution<double> words(1 / options_.message_words);
+        std::uniform_int_distribution<size_t> word(
+            0, sizeof(WORDS) / sizeof(WORDS[0]) - 1);
+        size_t count = std::max((size_t)1, (size_t)words(random_));
+
+        std::string message;
+        for (size_t i = 0; i < count; i++)
+        {
+            std::string next = (i > 0 ? " " : "") + std::string(WORDS[word(random_)]);
+            if (message.size() + next.size() > Outbox::MESSAGE_CAPACITY)
+            {
+                break;
+            }
+            message += next;
+        }
+        return message;
+    }
+
+    /**
+     * Returns whichever of the times comes first after now.
+     */
+    static unsigned long earliest(unsigned long now, unsigned long a,
+                                  unsigned long b) noexcept
+    {
+        return a - now <= b - now ? a : b;
+    }
+
+    const fleet_options& options_;
+    uint8_t mac_[6];
+    ApplicationNetworkClient client_;
+    MemoryOutboxStorage storage_;
+    Outbox outbox_;
+    PollScheduler polls_;
+    std::mt19937 random_;
+    unsigned long start_delay_ms_;
+    unsigned long next_poll_;
+    device_stats stats_;
+};
+
+
+static void* runDevice(void* arg)
+{
+    static_cast<Device*>(arg)->run();
+    return NULL;
+}
+
+
+/**
+ * Returns the nearest-rank percentile of sorted values.
+ */
+static double percentile(const std::vector<uint32_t>& sorted, double fraction)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    size_t rank = (size_t)ceil(fraction * sorted.size());
+    return sorted[std::max((size_t)1, rank) - 1];
+}
+
+
+static void report(std::vector<uint32_t> (&latencies_us)[ENDPOINTS],
+                   const device_stats& total, double elapsed_s)
+{
+    printf("%-14s %9s %7s %9s %9s %9s %9s %9s\n", "endpoint", "requests",
+           "errors", "req/s", "p50 ms", "p99 ms", "p999 ms", "max ms");
+    unsigned long requests = 0;
+    for (int i = 0; i < ENDPOINTS; i++)
+    {
+        const std::vector<uint32_t>& sorted = latencies_us[i];
+        if (sorted.empty() && total.errors[i] == 0)
+        {
+            continue;
+        }
+        requests += sorted.size();
+        printf("%-14s %9zu %7lu %9.1f %9.1f %9.1f %9.1f %9.1f\n",
+               ENDPOINT_NAMES[i], sorted.size(), total.errors[i],
+               sorted.size() / elapsed_s, percentile(sorted, 0.5) / 1000,
+               percentile(sorted, 0.99) / 1000,
+               percentile(sorted, 0.999) / 1000,
+               percentile(sorted, 1.0) / 1000);
+    }
+    printf("\n%lu requests in %.1f s (%.1f/s) over %lu connections; "
+           "%lu messages sent, %lu received, %lu dropped with the outbox full\n",
+           requests, elapsed_s, requests / elapsed_s, total.connects,
+           total.messages_sent, total.messages_received,
+           total.messages_dropped);
+}
+
+
+static bool writeCsv(std::vector<uint32_t> (&latencies_us)[ENDPOINTS],
+                     const device_stats& total, const char* path)
+{
+    FILE* out = fopen(path, "w");
+    if (out == NULL)
+    {
+        return false;
+    }
+    fprintf(out, "endpoint,requests,errors,p50_ms,p99_ms,p999_ms,max_ms\n");
+    for (int i = 0; i < ENDPOINTS; i++)
+    {
+        const std::vector<uint32_t>& sorted = latencies_us[i];
+        fprintf(out, "%s,%zu,%lu,%.3f,%.3f,%.3f,%.3f\n", ENDPOINT_NAMES[i],
+                sorted.size(), total.errors[i], percentile(sorted, 0.5) / 1000,
+                percentile(sorted, 0.99) / 1000,
+                percentile(sorted, 0.999) / 1000,
+                percentile(sorted, 1.0) / 1000);
+    }
+    fclose(out);
+    return true;
+}
+
+
+/**
+ * Raises the limit of open files as far as allowed, since every device holds
+ * a socket.
+ */
+static void raiseFileLimit(rlim_t needed)
+{
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0)
+    {
+        return;
+    }
+    rlim_t wanted = limit.rlim_max == RLIM_INFINITY ?
+        needed : std::min(needed, limit.rlim_max);
+    if (limit.rlim_cur != RLIM_INFINITY && limit.rlim_cur < wanted)
+    {
+        limit.rlim_cur = wanted;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+    if (limit.rlim_cur != RLIM_INFINITY && limit.rlim_cur < needed)
+    {
+        fprintf(stderr, "Only %lu files may be open; some devices will fail "
+                "to connect\n", (unsigned long)limit.rlim_cur);
+    }
+}
+
+
+/**
+ * Reads the whole file into the contents. Returns false if it cannot be read.
+ */
+static bool readFile(const char* path, std::string& contents)
+{
+    FILE* in = fopen(path, "r");
+    if (in == NULL)
+    {
+        return false;
+    }
+    char buffer[4096];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), in)) > 0)
+    {
+        contents.append(buffer, count);
+    }
+    bool read = ferror(in) == 0;
+    fclose(in);
+    return read && !contents.empty();
+}
+
+
+static void usage(const char* program)
+{
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  --host HOST            server address (localhost)\n"
+        "  --port PORT            server port (5000)\n"
+        "  --devices N            simulated devices (100)\n"
+        "  --duration S           seconds every device runs for once started (30)\n"
+        "  --ramp-up S            seconds over which the devices are started (5)\n"
+        "  --protocol form|binary wire protocol (form)\n"
+        "  --keying idle|casual|active|chatty\n"
+        "                         how often each device sends a message (casual)\n"
+        "  --message-words N      mean number of words in a message (4)\n"
+        "  --batch N              messages per send, 1 to %d; over 1 uses\n"
+        "                         receive/batch (1)\n"
+        "  --poll adaptive|fixed  polling profile (adaptive)\n"
+        "  --poll-interval MS     milliseconds between fixed polls (%lu)\n"
+        "  --no-keep-alive        open a new connection for every request\n"
+        "  --tls                  talk HTTPS without verifying the server\n"
+        "  --ca FILE              talk HTTPS, trusting only the PEM CA\n"
+        "  --seed N               seed of the keying (1)\n"
+        "  --csv FILE             also write the latencies to the file\n",
+        program, ApplicationNetworkClient::MAX_BATCH_SIZE,
+        PollScheduler::BASE_INTERVAL_MS);
+}
+
+
+/**
+ * Reads the options into the options. Returns false if they are not valid.
+ */
+static bool parseOptions(int argc, char** argv, fleet_options& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char* option = argv[i];
+        if (strcmp(option, "--no-keep-alive") == 0)
+        {
+            options.keep_alive = false;
+            continue;
+        }
+        if (strcmp(option, "--tls") == 0)
+        {
+            options.tls = true;
+            continue;
+        }
+        if (i + 1 == argc)
+        {
+            return false;
+        }
+        const char* value = argv[++i];
+
+        if (strcmp(option, "--host") == 0)
+        {
+            options.host = value;
+        }
+        else if (strcmp(option, "--port") == 0)
+        {
+            options.port = (short)atoi(value);
+        }
+        else if (strcmp(option, "--devices") == 0)
+        {
+            options.devices = strtoul(value, NULL, 10);
+        }
+        else if (strcmp(option, "--duration") == 0)
+        {
+            options.duration_s = atof(value);
+        }
+        else if (strcmp(option, "--ramp-up") == 0)
+        {
+            options.ramp_up_s = atof(value);
+        }
+        else if (strcmp(option, "--protocol") == 0)
+        {
+            if (strcmp(value, "form") != 0 && strcmp(value, "binary") != 0)
+            {
+                return false;
+            }
+            options.binary = strcmp(value, "binary") == 0;
+        }
+        else if (strcmp(option, "--keying") == 0)
+        {
+            const keying_profile* found = NULL;
+            for (const keying_profile& profile : KEYING_PROFILES)
+            {
+                if (strcmp(value, profile.name) == 0)
+                {
+                    found = &profile;
+                }
+            }
+            if (found == NULL)
+            {
+                return false;
+            }
+            options.keying_s = found->mean_s;
+        }
+        else if (strcmp(option, "--message-words") == 0)
+        {
+            options.message_words = atof(value);
+        }
+        else if (strcmp(option, "--batch") == 0)
+        {
+            options.batch = strtoul(value, NULL, 10);
+        }
+        else if (strcmp(option, "--poll") == 0)
+        {
+            if (strcmp(value, "adaptive") != 0 && strcmp(value, "fixed") != 0)
+            {
+                return false;
+            }
+            options.adaptive = strcmp(value, "adaptive") == 0;
+        }
+        else if (strcmp(option, "--poll-interval") == 0)
+        {
+            options.poll_interval_ms = strtoul(value, NULL, 10);
+        }
+        else if (strcmp(option, "--seed") == 0)
+        {
+            options.seed = strtoul(value, NULL, 10);
+        }
+        else if (strcmp(option, "--csv") == 0)
+        {
+            options.csv = value;
+        }
+        else if (strcmp(option, "--ca") == 0)
+        {
+            if (!readFile(value, options.ca_certificate))
+            {
+                fprintf(stderr, "Could not read %s\n", value);
+                return false;
+            }
+            options.tls = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return options.devices >= 1 && options.batch >= 1 &&
+           options.batch <= (size_t)ApplicationNetworkClient::MAX_BATCH_SIZE &&
+           options.message_words > 0 && options.poll_interval_ms > 0;
+}
+
+
+int main(int argc, char** argv)
+{
+    fleet_options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+    raiseFileLimit(options.devices + 64);
+
+    std::vector<std::unique_ptr<Device>> devices;
+    for (size_t i = 0; i < options.devices; i++)
+    {
+        devices.emplace_back(new Device(options, i));
+    }
+
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+    pthread_attr_setstacksize(&attributes, DEVICE_STACK_SIZE);
+    std::vector<pthread_t> threads;
+    unsigned long start = millis();
+    for (std::unique_ptr<Device>& device : devices)
+    {
+        pthread_t thread;
+        if (pthread_create(&thread, &attributes, runDevice, device.get()) != 0)
+        {
+            fprintf(stderr, "Could only start %zu devices\n", threads.size());
+            break;
+        }
+        threads.push_back(thread);
+    }
+    pthread_attr_destroy(&attributes);
+    for (pthread_t thread : threads)
+    {
+        pthread_join(thread, NULL);
+    }
+    double elapsed_s = (millis() - start) / 1000.0;
+
+    // Devices that never started have nothing to add
+    std::vector<uint32_t> latencies_us[ENDPOINTS];
+    device_stats total;
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        const device_stats& stats = devices[i]->getStats();
+        for (int e = 0; e < ENDPOINTS; e++)
+        {
+            latencies_us[e].insert(latencies_us[e].end(),
+                                   stats.latencies_us[e].begin(),
+                                   stats.latencies_us[e].end());
+            total.errors[e] += stats.errors[e];
+        }
+        total.connects += stats.connects;
+        total.messages_sent += stats.messages_sent;
+        total.messages_received += stats.messages_received;
+        total.messages_dropped += stats.messages_dropped;
+    }
+    for (std::vector<uint32_t>& sorted : latencies_us)
+    {
+        std::sort(sorted.begin(), sorted.end());
+    }
+
+    report(latencies_us, total, elapsed_s);
+    if (options.csv != NULL && !writeCsv(latencies_us, total, options.csv))
+    {
+        fprintf(stderr, "Could not write %s\n", options.csv);
+        return 1;
+    }
+    return 0;
+}
@@ -2,12 +2,14 @@ from flask import Flask, Blueprint
 
 from helloworld.api.routes import database
 from helloworld.api.routes import device
+from helloworld.api.routes import binary
 
 
 blueprint: Blueprint = Blueprint('api', __name__, url_prefix='/api')
 
 blueprint.register_blueprint(database.blueprint)
 blueprint.register_blueprint(device.blueprint)
+blueprint.register_blueprint(binary.blueprint)
 
 
 def setup_api_routes(application: Flask) -> None:
@@ -0,0 +1,156 @@
+"""The same endpoints as the device routes, in the compact binary protocol
+described in helloworld.api.wire. Every request starts with the 6-byte id of
+the device. Errors are reported by status code alone, with an empty body.
+"""
+
+from datetime import datetime, timedelta
+from flask import Blueprint, Response, request
+from http.client import BAD_REQUEST, FORBIDDEN
+from typing import List, Optional
+
+from helloworld.api import wire
+from helloworld.api.routes.device import broadcast_message, broadcast_messages
+from helloworld import database
+
+
+blueprint: Blueprint = Blueprint('binary', __name__, url_prefix='/binary')
+message_blueprint: Blueprint = Blueprint('binary_message', __name__,
+                                         url_prefix='/message')
+
+
+def binary_response(data: bytes = b'', status: int = 200) -> Response:
+    return Response(data, status=status, mimetype='application/octet-stream')
+
+
+def pending_count(mac_address: str) -> Optional[int]:
+    """Returns the number of messages pending for the device, or None if the
+    device is not visible to the server.
+    """
+    try:
+        user: database.UserDevice = database.get_user(mac_address)
+    except database.DatabaseException:
+        return None
+    return user.count_pending_messages()
+
+
+@blueprint.route('/register', methods=['POST'])
+def register():
+    """Request format: id
+
+    Response format: u16 pending
+    """
+    try:
+        mac_address, _ = wire.decode_id(request.get_data())
+    except wire.WireError:
+        return binary_response(status=BAD_REQUEST)
+    
+    database.add_user(mac_address, mac_address)
+
+    return binary_response(wire.encode_pending(pending_count(mac_address)))
+
+
+@blueprint.route('/unregister', methods=['POST'])
+def unregister():
+    """Request format: id"""
+    try:
+        mac_address, _ = wire.decode_id(request.get_data())
+    except wire.WireError:
+        return binary_response(status=BAD_REQUEST)
+
+    database.remove_user(mac_address)
+
+    return binary_response()
+
+
+@message_blueprint.route('/receive', methods=['POST'])
+def receive():
+    """Request format: id, text
+
+    Response format: u16 pending ; 0xFFFF if the device is not visible
+    """
+    try:
+        mac_address, data = wire.decode_id(request.get_data())
+        message, _ = wire.decode_text(data)
+    except wire.WireError:
+        return binary_response(status=BAD_REQUEST)
+
+    broadcast_message(mac_address, message)
+
+    return binary_response(wire.encode_pending(pending_count(mac_address)))
+
+
+@message_blueprint.route('/receive/batch', methods=['POST'])
+def receive_batch():
+    """Request format: id, u8 count, then count messages of u32 age, text,
+        oldest first; the age counts the milliseconds before the request the
+        message was composed
+
+    Response format: u16 pending
+    """
+    try:
+        mac_address, data = wire.decode_id(request.get_data())
+        count, data = wire.decode_u8(data)
+        batch = []
+        for _ in range(count):
+            age, data = wire.decode_u32(data)
+            message, data = wire.decode_text(data)
+            batch.append((message, age))
+    except wire.WireError:
+        return binary_response(status=BAD_REQUEST)
+
+    now = datetime.now()
+    broadcast_messages(mac_address, [
+        (message, now - timedelta(milliseconds=age)) for message, age in batch
+    ])
+
+    return binary_response(wire.encode_pending(pending_count(mac_address)))
+
+
+@message_blueprint.route('/pending/count', methods=['POST'])
+def count_pending():
+    """Request format: id
+
+    Response format: u16 count
+    """
+    try:
+        mac_address, _ = wire.decode_id(request.get_data())
+    except wire.WireError:
+        return binary_response(status=BAD_REQUEST)
+
+    count = pending_count(mac_address)
+    if count is None:
+        return binary_response(status=FORBIDDEN)
+
+    return binary_response(wire.encode_pending(count))
+
+
+@message_blueprint.route('/pending/get', methods=['POST'])
+def get_pending():
+    """Request format: id, u8 limit
+
+    Response format: u16 pending, u8 count, then count messages of
+        u16 length, sender id, u32 time, text
+    """
+    try:
+        mac_address, data = wire.decode_id(request.get_data())
+    except wire.WireError:
+        return binary_response(status=BAD_REQUEST)
+    if len(data) < 1:
+        return binary_response(status=BAD_REQUEST)
+    limit = data[0]
+
+    try:
+        user: database.UserDevice = database.get_user(mac_address)
+        messages: List[database.Message] = user.get_pending_messages(limit)
+    except database.DatabaseException:
+        return binary_response(status=FORBIDDEN)
+
+    body = wire.encode_pending(user.count_pending_messages()) + \
+        wire.encode_u8(len(messages))
+    for message in messages:
+        body += wire.encode_message(message.sender_mac, message.content,
+                                    message.timestamp)
+    return binary_response(body)
+
+
+blueprint.register_blueprint(message_blueprint)
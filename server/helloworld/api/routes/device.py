@@ -1,6 +1,7 @@
-from flask import Blueprint, request
+from flask import Blueprint, current_app, request
 from http.client import BAD_REQUEST, FORBIDDEN
-from typing import List
+from datetime import datetime, timedelta
+from typing import Dict, List, Optional, Tuple
 
 from helloworld.api.error import ErrorType, ErrorBuilder, RequestErrorBuilder
 from helloworld import database
@@ -12,6 +13,54 @@ message_blueprint: Blueprint = Blueprint('message', __name__,
                                          url_prefix='/message')
 
 
+def pending_fields(mac_address: str) -> Dict[str, int]:
+    """Returns the fields that tell a device how many messages are pending for
+    it. These are added to every response so that devices learn about new
+    messages without having to poll for them. If the device is not visible to
+    the server, no fields are returned.
+    """
+    try:
+        user: database.UserDevice = database.get_user(mac_address)
+    except database.DatabaseException:
+        return {}
+    return {'pending': user.count_pending_messages()}
+
+
+def broadcast_messages(mac_address: str,
+                       messages: List[Tuple[str, Optional[datetime]]]) -> None:
+    """Adds the messages, given with the time each was composed at or None for
+    the current time, to the pending messages of every device other than the
+    sender, and then records them in the metrics. All the messages are stored
+    before any metrics are recorded, and a failure to record them is only
+    logged: the sender retries a request that fails, which would store the
+    messages again for everyone else.
+    """
+    def add_unread_messages(user: database.UserDevice) -> None:
+        if user.mac_address() != mac_address:
+            for message, timestamp in messages:
+                user.add_pending_message(message, mac_address, timestamp)
+
+    database.for_each_user(add_unread_messages)
+
+    for message, _ in messages:
+        try:
+            awsmetrics.put_metrics(1, "message", mac_address)
+            awsmetrics.put_logs(mac_address, message, awsmetrics.NUM_RETRIES,
+                                awsmetrics.sequenceToken)
+        except Exception:
+            current_app.logger.exception('Could not record the metrics of a '
+                                         'message from %s', mac_address)
+
+
+def broadcast_message(mac_address: str, message: str,
+                      timestamp: Optional[datetime] = None) -> None:
+    """Adds the message to the pending messages of every device other than
+    the sender and records it in the metrics. The message is stamped with the
+    current time unless the time it was composed at is given.
+    """
+    broadcast_messages(mac_address, [(message, timestamp)])
+
+
 @blueprint.route('/register', methods=['POST'])
 def register():
     """Required arguments:
@@ -22,6 +71,12 @@ def register():
 
         username -- the username of the device; if not specified the macAddress
             is used
+    
+    Response format:
+
+        {
+            pending (integer) ; messages pending for the device
+        }
     """
 
     mac_address = request.form.get('macAddress')
@@ -42,7 +97,7 @@ def register():
     
     database.add_user(mac_address, username)
 
-    return {}
+    return pending_fields(mac_address)
 
 
 @blueprint.route('/unregister', methods=['POST'])
@@ -75,6 +130,12 @@ def receive():
     
         macAddress -- the MAC address of the device
         message -- the message sent by the device
+    
+    Response format:
+
+        {
+            pending (integer) ; messages pending for the device, if visible
+        }
     """
     mac_address = request.form.get('macAddress')
     message = request.form.get('message')
@@ -93,16 +154,63 @@ def receive():
     if error_found:
         return error_builder.build(), BAD_REQUEST
     
-    def add_unread_message(user: database.UserDevice) -> None:
-        if user.mac_address() != mac_address:
-            user.add_pending_message(message, mac_address)
+    broadcast_message(mac_address, message)
+
+    return pending_fields(mac_address)
+
+
+@message_blueprint.route('/receive/batch', methods=['POST'])
+def receive_batch():
+    """Required arguments:
     
-    database.for_each_user(add_unread_message)
+        macAddress -- the MAC address of the device
+        message -- a message sent by the device; repeated for each message,
+            oldest first
+        age -- how many milliseconds before the request the message was
+            composed, as a non-negative integer; repeated in the same order as
+            message
+    
+    Response format:
 
-    awsmetrics.put_metrics(1, "message", mac_address)
-    awsmetrics.put_logs(mac_address, message, awsmetrics.NUM_RETRIES, awsmetrics.sequenceToken)
+        {
+            accepted (integer) ; messages added
+            pending (integer) ; messages pending for the device, if visible
+        }
+    """
+    mac_address = request.form.get('macAddress')
+    messages = request.form.getlist('message')
+    ages = request.form.getlist('age')
 
-    return {}
+    error_found = False
+    error_builder = RequestErrorBuilder()
+
+    if mac_address == None:
+        error_builder.add_argument_required('macAddress')
+        error_found = True
+
+    if len(messages) == 0:
+        error_builder.add_argument_required('message')
+        error_found = True
+
+    if not all(age.isnumeric() for age in ages):
+        error_builder.add_invalid_argument_type('age')
+        error_found = True
+    elif len(ages) != len(messages):
+        error_builder.add_invalid_argument_value('age')
+        error_found = True
+
+    if error_found:
+        return error_builder.build(), BAD_REQUEST
+
+    # The device has no clock of its own, so the times are taken relative to
+    # when the batch arrived
+    now = datetime.now()
+    broadcast_messages(mac_address, [
+        (message, now - timedelta(milliseconds=int(age)))
+        for message, age in zip(messages, ages)
+    ])
+
+    return {'accepted': len(messages), **pending_fields(mac_address)}
 
 
 @message_blueprint.route('/pending/count', methods=['POST'])
@@ -114,7 +222,8 @@ def count_pending():
     Response format:
     
         {
-            count (integer)        
+            count (integer)
+            pending (integer) ; same as count
         }
     """
     mac_address = request.form.get('macAddress')
@@ -139,7 +248,7 @@ def count_pending():
         )
         return error_builder.build(), FORBIDDEN
 
-    return {'count': count}
+    return {'count': count, 'pending': count}
 
 
 @message_blueprint.route('/pending/get', methods=['POST'])
@@ -154,6 +263,7 @@ def get_pending():
     
         {
             count (integer)
+            pending (integer) ; messages still pending after these
             messages (array)
             [
                 {
@@ -202,7 +312,11 @@ def get_pending():
         return error_builder.build(), FORBIDDEN
 
     message_list = [message.as_dict() for message in messages]
-    return {'count': len(message_list), 'messages': message_list}
+    return {
+        'count': len(message_list),
+        'pending': user.count_pending_messages(),
+        'messages': message_list
+    }
 
 @message_blueprint.route('/metric/retrieve', methods=['GET'])
 def retrieve_metrics():
@@ -0,0 +1,142 @@
+"""Encoding of the compact binary protocol spoken by devices as an alternative
+to form data and JSON. See wire.hpp in the device firmware for the layout of
+each request and response.
+"""
+
+import calendar
+import struct
+from datetime import datetime
+from typing import Tuple
+
+
+ID_SIZE = 6
+UNKNOWN_PENDING = 0xFFFF
+CHARSET = ' ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789.,?\'!/()&:;=+-_"$@<>#%*'
+ESCAPE = 63
+MAX_CHARACTERS = 255
+
+
+class WireError(Exception):
+    pass
+
+
+def decode_id(data: bytes) -> Tuple[str, bytes]:
+    """Returns the MAC address of the device id at the start of the data, in
+    the text form devices register with, and the data after it.
+    """
+    if len(data) < ID_SIZE:
+        raise WireError('device id is missing')
+    mac_address = ':'.join(f'{byte:02X}' for byte in data[:ID_SIZE])
+    return mac_address, data[ID_SIZE:]
+
+
+def encode_id(mac_address: str) -> bytes:
+    """Returns the device id of a MAC address in text form."""
+    try:
+        data = bytes(int(part, 16) for part in mac_address.split(':'))
+    except ValueError:
+        data = b''
+    if len(data) != ID_SIZE:
+        # Senders that are not devices have no id
+        return bytes(ID_SIZE)
+    return data
+
+
+def encode_text(text: str) -> bytes:
+    """Packs text at 6 bits a character, escaping characters outside of the
+    charset as their UTF-8 bytes. Text longer than MAX_CHARACTERS characters is
+    truncated.
+    """
+    characters = []
+    for char in text:
+        if char in CHARSET:
+            characters.append(char)
+        else:
+            characters.extend(chr(byte) for byte in char.encode('utf-8'))
+    characters = characters[:MAX_CHARACTERS]
+
+    bits = 0
+    bit_count = 0
+    for char in characters:
+        code = CHARSET.find(char)
+        if code < 0:
+            bits = (bits << 14) | (ESCAPE << 8) | ord(char)
+            bit_count += 14
+        else:
+            bits = (bits << 6) | code
+            bit_count += 6
+    padding = -bit_count % 8
+    bits <<= padding
+    return bytes([len(characters)]) + bits.to_bytes((bit_count + padding) // 8,
+                                                     'big')
+
+
+def decode_text(data: bytes) -> Tuple[str, bytes]:
+    """Unpacks text from the start of the data. Returns the text and the data
+    after it.
+    """
+    if len(data) < 1:
+        raise WireError('text is missing')
+    count = data[0]
+    value = int.from_bytes(data[1:], 'big')
+    total_bits = (len(data) - 1) * 8
+    position = 0
+
+    def take(width: int) -> int:
+        nonlocal position
+        if position + width > total_bits:
+            raise WireError('text is truncated')
+        position += width
+        return (value >> (total_bits - position)) & ((1 << width) - 1)
+
+    raw = bytearray()
+    for _ in range(count):
+        code = take(6)
+        if code == ESCAPE:
+            raw.append(take(8))
+        elif code < len(CHARSET):
+            raw.extend(CHARSET[code].encode('ascii'))
+        else:
+            raise WireError('text has an unknown character')
+    used = 1 + (position + 7) // 8
+    return raw.decode('utf-8', errors='replace'), data[used:]
+
+
+def encode_u8(value: int) -> bytes:
+    return struct.pack('>B', value)
+
+
+def encode_u16(value: int) -> bytes:
+    return struct.pack('>H', value)
+
+
+def decode_u8(data: bytes) -> Tuple[int, bytes]:
+    """Returns the u8 at the start of the data and the data after it."""
+    if len(data) < 1:
+        raise WireError('u8 is missing')
+    return data[0], data[1:]
+
+
+def decode_u32(data: bytes) -> Tuple[int, bytes]:
+    """Returns the u32 at the start of the data and the data after it."""
+    if len(data) < 4:
+        raise WireError('u32 is missing')
+    return struct.unpack('>I', data[:4])[0], data[4:]
+
+
+def encode_pending(pending: int) -> bytes:
+    """Encodes a pending count, which is None if the device is unknown."""
+    if pending is None:
+        return encode_u16(UNKNOWN_PENDING)
+    return encode_u16(min(pending, UNKNOWN_PENDING - 1))
+
+
+def encode_message(sender_mac: str, content: str, timestamp: datetime) -> bytes:
+    """Encodes a message with its length in front of it. The time is sent as
+    seconds since 1970 in the local time of the server, so that it reads the
+    same on the device as in the JSON responses.
+    """
+    seconds = calendar.timegm(timestamp.timetuple())
+    body = encode_id(sender_mac) + struct.pack('>I', seconds) + \
+        encode_text(content)
+    return encode_u16(len(body)) + body
@@ -1,10 +1,16 @@
 from flask import Flask
+from werkzeug.serving import WSGIRequestHandler
 
 from helloworld.api.base import setup_api_routes
 from helloworld.views.base import setup_view_routes
 
 
+# The development server closes the connection after every response unless it
+# speaks HTTP/1.1, which would make devices reconnect (and over HTTPS, redo the
+# handshake) for every request.
+WSGIRequestHandler.protocol_version = 'HTTP/1.1'
+
 app = Flask(__name__)
 
 setup_api_routes(app)
-setup_view_routes(app)
\ No newline at end of file
+setup_view_routes(app)
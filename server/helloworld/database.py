@@ -25,12 +25,16 @@ class UserDevice:
         """Sets the username of the device."""
         self._username = new_username
     
-    def add_pending_message(self, message: str, sender: str) -> None:
+    def add_pending_message(self, message: str, sender: str,
+                            timestamp: Optional[datetime] = None) -> None:
         """Adds the message to the list of messages that the user device has not
-        read yet.
+        read yet. The message is stamped with the current time unless the time
+        it was composed at is given.
         """
+        if timestamp is None:
+            timestamp = datetime.now()
         # Sender is gauranteed to be in the database so no need to check
-        self._unread_messages.append(Message(sender, message, datetime.now()))
+        self._unread_messages.append(Message(sender, message, timestamp))
     
     def get_pending_messages(self, limit: int = 1) -> List['Message']:
         """Returns a list of messages to read. This removes the messages from
@@ -0,0 +1,83 @@
+"""Checks that a batch of messages is stored exactly once even when recording
+its metrics fails partway through, since a device resends a batch whose
+request failed.
+"""
+
+import unittest
+from unittest import mock
+
+from helloworld import awsmetrics, database
+from helloworld.api import wire
+from helloworld.app import app
+
+
+SENDER = 'AA:BB:CC:DD:EE:01'
+RECEIVER = 'AA:BB:CC:DD:EE:02'
+
+
+class FailingMetrics:
+    """Stands in for awsmetrics.put_metrics and fails on the call given."""
+
+    def __init__(self, failing_call: int) -> None:
+        self._calls = 0
+        self._failing_call = failing_call
+
+    def __call__(self, *args, **kwargs) -> None:
+        self._calls += 1
+        if self._calls == self._failing_call:
+            raise RuntimeError('Unable to locate credentials')
+
+
+class BatchTest(unittest.TestCase):
+
+    def setUp(self):
+        database.DATABASE.clear()
+        database.add_user(SENDER)
+        database.add_user(RECEIVER)
+        self.client = app.test_client()
+        patcher = mock.patch.object(awsmetrics, 'put_logs')
+        patcher.start()
+        self.addCleanup(patcher.stop)
+        self.addCleanup(database.DATABASE.clear)
+
+    def pending_contents(self):
+        user = database.get_user(RECEIVER)
+        return [message.content for message in user.get_pending_messages(10)]
+
+    def test_form_batch_survives_failing_metrics(self):
+        with mock.patch.object(awsmetrics, 'put_metrics', FailingMetrics(2)), \
+                self.assertLogs(app.logger, 'ERROR'):
+            response = self.client.post(
+                '/api/device/message/receive/batch',
+                data={'macAddress': SENDER, 'message': ['A', 'B', 'C'],
+                      'age': ['300', '200', '100']})
+        self.assertEqual(response.status_code, 200)
+        self.assertEqual(response.get_json()['accepted'], 3)
+        self.assertEqual(self.pending_contents(), ['A', 'B', 'C'])
+        self.assertEqual(database.get_user(SENDER).count_pending_messages(),
+                         0)
+
+    def test_binary_batch_survives_failing_metrics(self):
+        body = wire.encode_id(SENDER) + wire.encode_u8(3)
+        for message in ['A', 'B', 'C']:
+            body += (0).to_bytes(4, 'big') + wire.encode_text(message)
+        with mock.patch.object(awsmetrics, 'put_metrics', FailingMetrics(2)), \
+                self.assertLogs(app.logger, 'ERROR'):
+            response = self.client.post(
+                '/api/binary/message/receive/batch', data=body,
+                content_type='application/octet-stream')
+        self.assertEqual(response.status_code, 200)
+        self.assertEqual(self.pending_contents(), ['A', 'B', 'C'])
+
+    def test_single_message_survives_failing_metrics(self):
+        with mock.patch.object(awsmetrics, 'put_metrics', FailingMetrics(1)), \
+                self.assertLogs(app.logger, 'ERROR'):
+            response = self.client.post(
+                '/api/device/message/receive',
+                data={'macAddress': SENDER, 'message': 'A'})
+        self.assertEqual(response.status_code, 200)
+        self.assertEqual(self.pending_contents(), ['A'])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,76 @@
+"""Checks the encoding of the binary protocol against the vectors the device
+firmware is tested with, so that both sides agree on every byte.
+"""
+
+import unittest
+from datetime import datetime
+from pathlib import Path
+
+from helloworld.api import wire
+
+
+VECTORS = Path(__file__).resolve().parents[2] / 'microcontroller' / \
+    'TTGO ESP32' / 'helloworld' / 'test' / 'test_wire' / 'wire_vectors.txt'
+
+
+def read_vectors(kind):
+    """Returns the data and the other fields of each vector of the kind. A
+    missing last field, such as empty text, reads as an empty string.
+    """
+    vectors = []
+    for line in VECTORS.read_text(encoding='utf-8').splitlines():
+        fields = line.split('\t')
+        if len(fields) < 2 or fields[0] != kind:
+            continue
+        vectors.append((bytes.fromhex(fields[1]), fields[2:]))
+    return vectors
+
+
+def field(fields, index):
+    return fields[index] if index < len(fields) else ''
+
+
+class TextTest(unittest.TestCase):
+
+    def test_encodes_as_the_device(self):
+        for data, fields in read_vectors('text'):
+            with self.subTest(text=field(fields, 0)):
+                self.assertEqual(wire.encode_text(field(fields, 0)), data)
+
+    def test_decodes_text_of_the_device(self):
+        for data, fields in read_vectors('text'):
+            with self.subTest(text=field(fields, 0)):
+                text, rest = wire.decode_text(data + b'\x2a')
+                self.assertEqual(text, field(fields, 0))
+                self.assertEqual(rest, b'\x2a')
+
+    def test_rejects_truncated_text(self):
+        for data, fields in read_vectors('text'):
+            if len(data) < 2:
+                continue
+            with self.subTest(text=field(fields, 0)):
+                with self.assertRaises(wire.WireError):
+                    wire.decode_text(data[:-1])
+
+
+class MessageTest(unittest.TestCase):
+
+    def test_frames_as_the_device_reads(self):
+        for data, fields in read_vectors('message'):
+            sender, seconds, content = (field(fields, i) for i in range(3))
+            with self.subTest(sender=sender):
+                timestamp = datetime.utcfromtimestamp(int(seconds))
+                self.assertEqual(
+                    wire.encode_message(sender, content, timestamp), data)
+
+                body = data[2:]
+                self.assertEqual(len(body), int.from_bytes(data[:2], 'big'))
+                mac_address, rest = wire.decode_id(body)
+                self.assertEqual(mac_address, sender)
+                sent, rest = wire.decode_u32(rest)
+                self.assertEqual(sent, int(seconds))
+                self.assertEqual(wire.decode_text(rest), (content, b''))
+
+
+if __name__ == '__main__':
+    unittest.main()